@@ -586,9 +586,9 @@ void Handler::SendToJSLoggingMediator(std::string message)
 	
 }
 
-bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, std::shared_ptr<const FaviconCache::Image> spImage)
 {
-	return _pMediator->ForwardFaviconBytes(browser, img);
+	return _pMediator->ForwardFaviconBytes(browser, spImage);
 }
 
 bool Handler::StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url)
@@ -164,7 +164,7 @@ public:
 	// Check if favicon was already loaded, if not download it
 	bool StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
 	// HandlerImageDownload interface methods
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, std::shared_ptr<const FaviconCache::Image> spImage);
 
 	// Decide whether to block ads
 	void BlockAds(bool blockAds) { _requestHandler->BlockAds(blockAds); }
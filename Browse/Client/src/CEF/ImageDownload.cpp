@@ -6,32 +6,116 @@
 
 #include "src/CEF/ImageDownload.h"
 #include "src/Utils/Logger.h"
+#include "include/cef_task.h"
+#include <functional>
+
+// Task to get back from the favicon cache thread to the UI thread
+class FaviconCacheTask : public CefTask
+{
+public:
+	FaviconCacheTask(std::function<void()> function) : _function(function) {};
+
+	void Execute() OVERRIDE { _function(); }
+
+private:
+	std::function<void()> _function;
+
+	IMPLEMENT_REFCOUNTING(FaviconCacheTask);
+};
 
 void PendingImageDownload::OnDownloadImageFinished(const CefString& image_url,
 	int http_status_code,
 	CefRefPtr<CefImage> image)
 {
 	//LogDebug("PendingImageDownload: Finished image download for url:\n", image_url.ToString());
-	_handler->ForwardFaviconBytes(_corresponding_browser, image);
-	_handler->FinishImageDownload(this);
+	std::shared_ptr<FaviconCache::Image> spImage;
+	if (image)
+	{
+		int width, height;
+		auto binary_value = image->GetAsBitmap(1.0, CEF_COLOR_TYPE_RGBA_8888, CEF_ALPHA_TYPE_PREMULTIPLIED, width, height);
+		if (!binary_value || binary_value->GetSize() == 0)
+		{
+			LogInfo("PendingImageDownload: Favicon CefImage conversion to bitmap failed.");
+		}
+		else if ((size_t)(width * height * 4) > binary_value->GetSize())
+		{
+			LogInfo("PendingImageDownload: Something went wrong when retrieving image's resolution. Aborting...");
+		}
+		else
+		{
+			// Copy bytes and put them into the cache
+			spImage = std::make_shared<FaviconCache::Image>();
+			spImage->width = width;
+			spImage->height = height;
+			spImage->data.resize(width * height * 4);
+			binary_value->GetData(static_cast<void*>(spImage->data.data()), spImage->data.size(), 0);
+		}
+	}
+	FaviconCache::instance().Store(_url, spImage);
+	_handler->FinishImageDownload(_url, spImage);
 }
 
 
 void HandlerImageInterface::StartImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url)
 {
-	CefRefPtr<PendingImageDownload> download(new PendingImageDownload(this, browser));
-	_downloads.push_back(download);
-	//LogDebug("HandlerImageInterface: Starting new image download for url:\n", img_url.ToString());
-	browser->GetHost()->DownloadImage(img_url, true, 0, false, download);
+	const std::string url = img_url.ToString();
+
+	// Attach to request that is already in flight
+	auto iter = _requests.find(url);
+	if (iter != _requests.end())
+	{
+		iter->second.browsers.push_back(browser);
+		return;
+	}
+	_requests[url].browsers.push_back(browser);
+
+	// Decoded favicon might be still in memory
+	if (auto spImage = FaviconCache::instance().Fetch(url))
+	{
+		FinishImageDownload(url, spImage);
+		return;
+	}
+
+	// Ask cache on disk, result is handed back to UI thread
+	FaviconCache::instance().Load(url, [this, url](std::shared_ptr<const FaviconCache::Image> spImage)
+	{
+		CefPostTask(TID_UI, new FaviconCacheTask([this, url, spImage]() { ReceiveCacheResult(url, spImage); }));
+	});
+}
+
+void HandlerImageInterface::FinishImageDownload(std::string img_url, std::shared_ptr<const FaviconCache::Image> spImage)
+{
+	auto iter = _requests.find(img_url);
+	if (iter == _requests.end()) { return; }
+
+	// Remove request before forwarding, so a forward may start new requests. Removal of download leads to object's destruction
+	const auto browsers = std::move(iter->second.browsers);
+	_requests.erase(iter);
+
+	// Forward image to all browsers which asked for it
+	if (spImage)
+	{
+		for (const auto& browser : browsers)
+		{
+			ForwardFaviconBytes(browser, spImage);
+		}
+	}
 }
 
-void HandlerImageInterface::FinishImageDownload(CefRefPtr<PendingImageDownload> download)
+void HandlerImageInterface::ReceiveCacheResult(std::string img_url, std::shared_ptr<const FaviconCache::Image> spImage)
 {
-	const auto& iter = std::find(_downloads.begin(), _downloads.end(), download);
-	// Remove download from vector by using its iterator in _downloads
-	if (iter != _downloads.end())
+	// Hit of cache
+	if (spImage)
 	{
-		// Removal of single ref-counted instance from vector leads to object's destruction
-		_downloads.erase(iter);
+		FinishImageDownload(img_url, spImage);
+		return;
 	}
-}
\ No newline at end of file
+
+	// Miss of cache, so download the image
+	auto iter = _requests.find(img_url);
+	if (iter == _requests.end() || iter->second.browsers.empty()) { return; }
+	CefRefPtr<PendingImageDownload> download(new PendingImageDownload(this, img_url));
+	iter->second.download = download;
+	//LogDebug("HandlerImageInterface: Starting new image download for url:\n", img_url);
+	iter->second.browsers.front()->GetHost()->DownloadImage(img_url, true, 0, false, download);
+}
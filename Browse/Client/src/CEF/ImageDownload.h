@@ -3,13 +3,19 @@
 // Author: Daniel Mueller (muellerd@uni-koblenz.de)
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Used for favicon retrieval
+// Used for favicon retrieval. Requests are first answered by the favicon
+// cache, only misses are downloaded. Parallel requests of the same URL are
+// merged into a single lookup.
 
 #ifndef IMAGEDOWNLOAD_H_
 #define IMAGEDOWNLOAD_H_
 
 #include "include/cef_browser.h"
-#include <algorithm>
+#include "src/Singletons/FaviconCache.h"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <memory>
 
 class HandlerImageInterface;	// Forward declaration
 
@@ -17,8 +23,8 @@ class PendingImageDownload : public CefDownloadImageCallback,
 	public CefRefCount
 {
 public:
-	PendingImageDownload(HandlerImageInterface* handler, CefRefPtr<CefBrowser> browser) :
-		_handler(handler), _corresponding_browser(browser) {};
+	PendingImageDownload(HandlerImageInterface* handler, std::string url) :
+		_handler(handler), _url(url) {};
 
 	void OnDownloadImageFinished(const CefString& image_url,
 		int http_status_code,
@@ -26,7 +32,7 @@ public:
 
 private:
 	HandlerImageInterface* _handler;
-	CefRefPtr<CefBrowser> _corresponding_browser;
+	std::string _url; // URL as requested, used as key for the cache
 
 	IMPLEMENT_REFCOUNTING(PendingImageDownload);
 };
@@ -35,14 +41,26 @@ private:
 class HandlerImageInterface
 {
 public:
-	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img) = 0;
+	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, std::shared_ptr<const FaviconCache::Image> spImage) = 0;
 
 	void StartImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
-	void FinishImageDownload(CefRefPtr<PendingImageDownload> download);
+	void FinishImageDownload(std::string img_url, std::shared_ptr<const FaviconCache::Image> spImage); // image may be nullptr
 
 
 private:
-	std::vector< CefRefPtr<PendingImageDownload> > _downloads;
+
+	// Called after cache lookup, on UI thread
+	void ReceiveCacheResult(std::string img_url, std::shared_ptr<const FaviconCache::Image> spImage);
+
+	// Request of an image which may be waited for by multiple browsers
+	struct ImageRequest
+	{
+		std::vector< CefRefPtr<CefBrowser> > browsers;
+		CefRefPtr<PendingImageDownload> download; // only set while downloading
+	};
+
+	// Requests which are in flight, either looked up in cache or downloaded
+	std::unordered_map<std::string, ImageRequest> _requests;
 };
 
 
@@ -445,40 +445,16 @@ void Mediator::SetCanGoForward(CefRefPtr<CefBrowser> browser, bool canGoForward)
     }
 }
 
-bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, std::shared_ptr<const FaviconCache::Image> spImage)
 {
 	if (const auto pTab = GetTab(browser))
 	{
-		if (!img)
+		if (!spImage)
 			return true;
 
-		int width, height;
-
-		auto binary_value = img->GetAsBitmap(1.0, CEF_COLOR_TYPE_RGBA_8888, CEF_ALPHA_TYPE_PREMULTIPLIED, width, height);
-		if (!binary_value)
-		{
-			LogInfo("Mediator: Favicon CefImage conversion to bitmap failed.");
-			return true;
-		}
-
-		const size_t byte_size = binary_value->GetSize();
-		if (byte_size == 0)
-		{
-			LogInfo("Mediator: Favicon CefImage conversion failed due to byte stream being empty.");
-			return true;
-		}
-		if (width * height * sizeof(unsigned char) > byte_size)
-		{
-			LogInfo("Mediator: Something went wrong when retrieving image's resolution. Aborting...");
-			return true;
-		}
-
-		// Write image bytes to unique_ptr
-		auto upData = std::unique_ptr< std::vector<unsigned char> >(new std::vector<unsigned char>());
-		upData->resize(byte_size / sizeof(unsigned char));
-		binary_value->GetData(static_cast<void*>(upData->data()), byte_size, 0);
-
-		pTab->ReceiveFaviconBytes(std::move(upData), width, height);
+		// Copy image bytes to unique_ptr, as cached image is shared
+		auto upData = std::unique_ptr< std::vector<unsigned char> >(new std::vector<unsigned char>(spImage->data));
+		pTab->ReceiveFaviconBytes(std::move(upData), spImage->width, spImage->height);
 		return true;
 	}
 	LogInfo("Mediator: Forwarding favicon bytes to Tab failed. It might not exist anymore.");
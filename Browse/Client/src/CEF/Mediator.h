@@ -105,8 +105,8 @@ public:
 	// ### FAVICON SETTING ###
 	void ResetFavicon(CefRefPtr<CefBrowser> browser);
 
-	// Get byte code from CefImage and send it to corresponding Tab
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	// Send decoded favicon to corresponding Tab
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, std::shared_ptr<const FaviconCache::Image> spImage);
 
 	// Check if favicon was already loaded before new image is also loaded
 	bool IsFaviconAlreadyAvailable(CefRefPtr<CefBrowser> browser, CefString img_url);
@@ -43,8 +43,11 @@ void Renderer::OnPaint(
     if (auto spTexture = _mediator->GetTexture(browser).lock())
     {
 		if (setup::KEYSTROKE_BMP_CREATION) {
-			// Save current screen, so we can grab it at any time we want.
-			ScreenshotHandler::instance().SetBuffer((unsigned char const*)buffer, width, height, 4);
+			// Copy changed parts of current screen, so we can grab it at any time we want.
+			for (const auto& rect : dirtyRects)
+			{
+				ScreenshotHandler::instance().UpdateFrame((unsigned char const*)buffer, width, height, 4, rect.x, rect.y, rect.width, rect.height);
+			}
 		}
 
 		// Fill texture with rendered website
@@ -9,6 +9,7 @@
 
 #include "src/Utils/glmWrapper.h"
 #include <string>
+#include <chrono>
 
 static const int EYEGUI_WEB_URL_INPUT_LAYER = -1; // in default GUI...
 static const int EYEGUI_WEB_HISTORY_LAYER = -1; // in default GUI...
@@ -41,6 +42,10 @@ static const std::string LOG_FILE_NAME = "log";
 static const std::string INTERACTION_FILE_NAME = "interaction";
 static const int LOG_FILE_MAX_SIZE = 1024 * 1024;
 static const int LOG_FILE_COUNT = 5;
+static const size_t LOG_QUEUE_SIZE = 8192; // messages, must be power of two
+static const std::chrono::milliseconds LOG_FLUSH_INTERVAL = std::chrono::milliseconds(1000);
+static const std::string LOG_EVENT_FILE_NAME = "events";
+static const size_t LOG_EVENT_QUEUE_SIZE = 65536; // binary events, must be power of two
 static const float MOUSE_CURSOR_RELATIVE_SIZE = 0.1f;
 static const glm::vec3 DOM_TRIGGER_DEBUG_COLOR = glm::vec3(0, 1, 0);
 static const glm::vec3 DOM_TEXT_LINKS_DEBUG_COLOR = glm::vec3(0, 0, 1);
@@ -51,6 +56,9 @@ static const float BLUR_PERIPHERY_MULTIPLIER = 0.7f;
 static const std::string BOOKMARKS_FILE = "bookmarks.xml";
 static const std::string HISTORY_FILE = "history.xml";
 static const std::string SETTINGS_FILE = "settings.xml";
+static const std::string FAVICON_CACHE_DIRECTORY = "favicons";
+static const std::string FAVICON_CACHE_FILE_EXTENSION = ".favicon";
+static const std::string SCREENSHOT_DIRECTORY = "screenshots";
 static const int URL_INPUT_BOOKMARKS_ROWS_ON_SCREEN = 6;
 static const int HISTORY_ROWS_ON_SCREEN = 6;
 static const int HISTORY_DISPLAY_COUNT = 20;
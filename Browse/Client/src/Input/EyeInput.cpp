@@ -253,7 +253,7 @@ std::shared_ptr<Input> EyeInput::Update(
 				sample.x = sample.x * monitorWidth;
 				sample.y = sample.y * monitorHeight;
 				sample.system = SampleDataCoordinateSystem::SCREEN_PIXELS;
-				LogInfo("Gaze: ", sample.x, ", ", sample.y);
+				LogEvent(LogEventType::GAZE_SAMPLE, sample.x, sample.y);
 				break;
 			}
 		}
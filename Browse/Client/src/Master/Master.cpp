@@ -1011,11 +1011,15 @@ void Master::Loop()
 
 		// Pause visualization
 		_pausedDimming.update(tpf, !_paused);
-		eyegui::setStyleTreePropertyValue(
-			_pSuperGUI,
-			"pause_background",
-			eyegui::property::Color::BackgroundColor,
-			RGBAToHexString(glm::vec4(0, 0, 0, MASTER_PAUSE_ALPHA * _pausedDimming.getValue())));
+		if (_pausedDimming.getValue() != _appliedPausedDimming) // only write style while dimming changes
+		{
+			_appliedPausedDimming = _pausedDimming.getValue();
+			eyegui::setStyleTreePropertyValue(
+				_pSuperGUI,
+				"pause_background",
+				eyegui::property::Color::BackgroundColor,
+				RGBAToHexString(glm::vec4(0, 0, 0, MASTER_PAUSE_ALPHA * _appliedPausedDimming)));
+		}
 
 		// Check whether input is desired
 		if ((!spInput->windowFocused) // window not focused
@@ -1429,7 +1433,7 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 		case GLFW_KEY_S: {
 			if (setup::KEYSTROKE_BMP_CREATION) {
 				// Take screenshot of the current area
-				ScreenshotHandler::instance().PrepareScreenshot(true, _userDirectory + "/bmp/");
+				ScreenshotHandler::instance().PrepareScreenshot(true, _userDirectory + "/" + SCREENSHOT_DIRECTORY + "/");
 				OpenFileNameWindow();
 			}
 			break; }
@@ -1437,7 +1441,7 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 		case GLFW_KEY_A: {
 			if (setup::KEYSTROKE_BMP_CREATION) {
 				// Take screenshot of the whole screen
-				ScreenshotHandler::instance().PrepareScreenshot(false, _userDirectory + "/bmp/");
+				ScreenshotHandler::instance().PrepareScreenshot(false, _userDirectory + "/" + SCREENSHOT_DIRECTORY + "/");
 				OpenFileNameWindow();
 			}
 			break; }
@@ -362,6 +362,9 @@ private:
 	// Lerp value to show pause as dimming of whole screen
 	LerpValue _pausedDimming;
 
+	// Dimming value last written to style of pause background
+	float _appliedPausedDimming = -1.f;
+
 	// Framebuffer for complete rendering
 	std::unique_ptr<Framebuffer> _upFramebuffer;
 
@@ -92,8 +92,11 @@ namespace setup
 	static const int	DOM_POLLING_PARTITION_NUMBER = 8;
 	static const std::chrono::milliseconds STORING_TIME = std::chrono::milliseconds(2500); // time to store the queue of GazeCoordinates to use past values
 	static const bool	PERIODICAL_VOICE_RESTART = false; // allow the voice recognition to restart before 60 seconds are expired (after 50 seconds)
-	static const bool	KEYSTROKE_BMP_CREATION = false; // Creation of bmp files using the "s" key
+	static const bool	KEYSTROKE_BMP_CREATION = false; // Creation of screenshot files (QOI format) using the "s" key
 	static const int	BMP_GAZE_RADIUS = 200; // Radius around the gaze in which you want to take a partial screenshot
+	static const int	SCREENSHOT_QUEUE_DEPTH = 4; // screenshots waiting for encoding, further ones are dropped
+	static const int	FAVICON_CACHE_MEMORY_COUNT = 128; // count of decoded favicons kept in memory
+	static const long long	FAVICON_CACHE_EXPIRY_SECONDS = 60 * 60 * 24 * 7; // favicons on disk are downloaded again after one week
 }
 
 #endif // SETUP_H_
@@ -0,0 +1,399 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FaviconCache.h"
+#include "src/Utils/Logger.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#ifdef __linux__
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#elif _WIN32
+#include <experimental/filesystem>
+#include <filesystem>
+namespace fs = std::experimental::filesystem::v1;
+#endif
+
+// Header of cache file. Followed by URL and RGBA bytes
+namespace
+{
+	const char FILE_MAGIC[4] = { 'G', 'T', 'W', 'F' };
+	const std::uint32_t FILE_VERSION = 1;
+	const size_t MISS_START_MAX_COUNT = 256; // lookups waiting for their download, oldest is forgotten beyond
+
+	struct FileHeader
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::int64_t expiry; // seconds since epoch
+		std::int32_t width;
+		std::int32_t height;
+		std::uint32_t urlLength;
+	};
+
+	// Seconds since epoch
+	std::int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	// Milliseconds between given time point and now
+	double MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+FaviconCache::FaviconCache() : _shouldStop(false)
+{
+	// Create worker thread which performs disk access
+	_upThread = std::unique_ptr<std::thread>(new std::thread([this]()
+	{
+		std::deque<Command> localCommandQueue;
+		while (true)
+		{
+			// Wait for commands
+			{
+				std::unique_lock<std::mutex> lock(_commandMutex);
+				_conditionVariable.wait(lock, [this] { return !_commandQueue.empty() || _shouldStop; });
+				if (_commandQueue.empty() && _shouldStop) { break; } // queue is worked off, thread may be joined
+				localCommandQueue = std::move(_commandQueue);
+				_commandQueue.clear();
+			}
+
+			// Work on commands
+			for (const auto& rCommand : localCommandQueue)
+			{
+				rCommand();
+			}
+			localCommandQueue.clear();
+		}
+	}));
+}
+
+FaviconCache::~FaviconCache()
+{
+	Shutdown();
+}
+
+void FaviconCache::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(_commandMutex);
+		_shouldStop = true;
+	}
+	_conditionVariable.notify_one();
+	if (_upThread->joinable())
+	{
+		_upThread->join();
+	}
+}
+
+void FaviconCache::SetDirectory(std::string directory)
+{
+	// Create folder if necessary
+	std::error_code error;
+	fs::create_directories(fs::path(directory), error);
+	if (error)
+	{
+		LogError("FaviconCache: Could not create directory: ", directory);
+		return;
+	}
+
+	// Directory is only read in worker thread, so set it via command
+	PushBackCommand([this, directory]() { _directory = directory; });
+}
+
+std::shared_ptr<const FaviconCache::Image> FaviconCache::Fetch(const std::string& url)
+{
+	auto start = std::chrono::steady_clock::now();
+	std::shared_ptr<const Image> spImage;
+	{
+		std::lock_guard<std::mutex> lock(_memoryMutex);
+		spImage = FetchFromMemory(url);
+	}
+	if (spImage)
+	{
+		Record(LookupResult::MEMORY_HIT, MillisecondsSince(start));
+	}
+	return spImage;
+}
+
+void FaviconCache::Load(const std::string& url, Callback callback)
+{
+	// Try memory first
+	auto start = std::chrono::steady_clock::now();
+	std::shared_ptr<const Image> spImage;
+	{
+		std::lock_guard<std::mutex> lock(_memoryMutex);
+		spImage = FetchFromMemory(url);
+	}
+
+	// Go on in worker thread
+	PushBackCommand([this, url, callback, spImage, start]()
+	{
+		// Callbacks post tasks to CEF, which is not available anymore after shutdown
+		if (_shouldStop) { return; }
+
+		if (spImage)
+		{
+			Record(LookupResult::MEMORY_HIT, MillisecondsSince(start));
+			callback(spImage);
+			return;
+		}
+
+		// Try disk
+		auto spDiskImage = ReadFromDisk(url);
+		if (spDiskImage)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_memoryMutex);
+				StoreInMemory(url, spDiskImage);
+			}
+			Record(LookupResult::DISK_HIT, MillisecondsSince(start));
+		}
+		else
+		{
+			// Latency of miss is recorded when downloaded favicon is stored
+			std::lock_guard<std::mutex> lock(_statisticsMutex);
+			_statistics.misses++;
+			_missStarts[url] = start;
+			if (_missStarts.size() > MISS_START_MAX_COUNT)
+			{
+				auto oldest = std::min_element(_missStarts.begin(), _missStarts.end(),
+					[](const std::pair<const std::string, std::chrono::steady_clock::time_point>& a, const std::pair<const std::string, std::chrono::steady_clock::time_point>& b) { return a.second < b.second; });
+				_missStarts.erase(oldest);
+			}
+		}
+		callback(spDiskImage);
+	});
+}
+
+void FaviconCache::Store(const std::string& url, std::shared_ptr<const Image> spImage)
+{
+	// Failed download is not stored and its miss not recorded
+	if (!spImage || spImage->data.empty())
+	{
+		std::lock_guard<std::mutex> lock(_statisticsMutex);
+		_missStarts.erase(url);
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(_memoryMutex);
+		StoreInMemory(url, spImage);
+	}
+	std::chrono::steady_clock::time_point start;
+	bool missed = false;
+	{
+		std::lock_guard<std::mutex> lock(_statisticsMutex);
+		auto iter = _missStarts.find(url);
+		if (iter != _missStarts.end())
+		{
+			start = iter->second;
+			missed = true;
+			_missStarts.erase(iter);
+		}
+	}
+	if (missed)
+	{
+		Record(LookupResult::MISS, MillisecondsSince(start));
+	}
+	PushBackCommand([this, url, spImage]() { WriteToDisk(url, spImage); });
+}
+
+FaviconCache::Statistics FaviconCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(_statisticsMutex);
+	return _statistics;
+}
+
+void FaviconCache::LogStatistics() const
+{
+	Statistics statistics = GetStatistics();
+	const int lookups = statistics.memoryHits + statistics.diskHits + statistics.misses;
+	if (lookups == 0)
+	{
+		LogInfo("FaviconCache: No lookups");
+		return;
+	}
+	LogInfo("FaviconCache: ", lookups, " lookups, hit rate: ",
+		100.0 * (statistics.memoryHits + statistics.diskHits) / lookups, "%");
+	LogInfo("FaviconCache: Memory hits: ", statistics.memoryHits,
+		", average latency: ", statistics.memoryHits > 0 ? statistics.accumulatedMemoryLatency / statistics.memoryHits : 0.0, "ms");
+	LogInfo("FaviconCache: Disk hits: ", statistics.diskHits,
+		", average latency: ", statistics.diskHits > 0 ? statistics.accumulatedDiskLatency / statistics.diskHits : 0.0, "ms");
+	LogInfo("FaviconCache: Misses: ", statistics.misses, ", downloaded: ", statistics.storedMisses,
+		", average latency until stored: ", statistics.storedMisses > 0 ? statistics.accumulatedMissLatency / statistics.storedMisses : 0.0, "ms");
+}
+
+void FaviconCache::PushBackCommand(Command command)
+{
+	{
+		std::lock_guard<std::mutex> lock(_commandMutex);
+		_commandQueue.push_back(std::move(command));
+	}
+	_conditionVariable.notify_one();
+}
+
+std::shared_ptr<const FaviconCache::Image> FaviconCache::FetchFromMemory(const std::string& url)
+{
+	auto iter = _memoryMap.find(url);
+	if (iter == _memoryMap.end()) { return nullptr; }
+
+	// Move entry to front as it is most recently used
+	_memoryList.splice(_memoryList.begin(), _memoryList, iter->second);
+	return iter->second->second;
+}
+
+void FaviconCache::StoreInMemory(const std::string& url, std::shared_ptr<const Image> spImage)
+{
+	// Replace existing entry
+	auto iter = _memoryMap.find(url);
+	if (iter != _memoryMap.end())
+	{
+		_memoryList.erase(iter->second);
+		_memoryMap.erase(iter);
+	}
+
+	// Insert as most recently used
+	_memoryList.emplace_front(url, spImage);
+	_memoryMap[url] = _memoryList.begin();
+
+	// Evict least recently used entries
+	while (_memoryList.size() > (size_t)setup::FAVICON_CACHE_MEMORY_COUNT)
+	{
+		_memoryMap.erase(_memoryList.back().first);
+		_memoryList.pop_back();
+	}
+}
+
+std::shared_ptr<const FaviconCache::Image> FaviconCache::ReadFromDisk(const std::string& url) const
+{
+	if (_directory.empty()) { return nullptr; }
+	const std::string path = FilePath(url);
+	FILE* pFile = fopen(path.c_str(), "rb");
+	if (!pFile) { return nullptr; }
+	fseek(pFile, 0, SEEK_END);
+	const std::uint64_t fileSize = (std::uint64_t)ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	// Read and validate header
+	FileHeader header;
+	bool valid = fread(&header, sizeof(FileHeader), 1, pFile) == 1
+		&& std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0
+		&& header.version == FILE_VERSION
+		&& header.width > 0 && header.height > 0
+		&& header.urlLength == url.length()
+		&& header.urlLength <= fileSize - sizeof(FileHeader)
+		&& (fileSize - sizeof(FileHeader) - header.urlLength) % 4 == 0
+		&& (std::uint64_t)header.width * (std::uint64_t)header.height == (fileSize - sizeof(FileHeader) - header.urlLength) / 4; // RGBA bytes fill rest of file
+	bool expired = valid && header.expiry < Now();
+
+	// Compare URL to exclude hash collisions
+	if (valid && !expired)
+	{
+		std::string storedUrl(header.urlLength, '\0');
+		valid = fread(&storedUrl[0], 1, header.urlLength, pFile) == header.urlLength && storedUrl == url;
+	}
+
+	// Read RGBA bytes
+	std::shared_ptr<Image> spImage;
+	if (valid && !expired)
+	{
+		spImage = std::make_shared<Image>();
+		spImage->width = header.width;
+		spImage->height = header.height;
+		spImage->data.resize((size_t)header.width * (size_t)header.height * 4);
+		valid = fread(spImage->data.data(), 1, spImage->data.size(), pFile) == spImage->data.size();
+	}
+	fclose(pFile);
+
+	// Remove outdated or broken file
+	if (!valid || expired)
+	{
+		std::remove(path.c_str());
+		return nullptr;
+	}
+	return spImage;
+}
+
+void FaviconCache::WriteToDisk(const std::string& url, std::shared_ptr<const Image> spImage) const
+{
+	if (_directory.empty()) { return; }
+	const std::string path = FilePath(url);
+	const std::string temporaryPath = path + ".tmp";
+	FILE* pFile = fopen(temporaryPath.c_str(), "wb");
+	if (!pFile)
+	{
+		LogDebug("FaviconCache: Could not write file: ", temporaryPath);
+		return;
+	}
+
+	// Write header, URL and RGBA bytes
+	FileHeader header;
+	std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+	header.version = FILE_VERSION;
+	header.expiry = Now() + setup::FAVICON_CACHE_EXPIRY_SECONDS;
+	header.width = spImage->width;
+	header.height = spImage->height;
+	header.urlLength = (std::uint32_t)url.length();
+	bool success = fwrite(&header, sizeof(FileHeader), 1, pFile) == 1
+		&& fwrite(url.data(), 1, url.length(), pFile) == url.length()
+		&& fwrite(spImage->data.data(), 1, spImage->data.size(), pFile) == spImage->data.size();
+	fclose(pFile);
+
+	// Replace previous file only when writing was successful, so no partial file is ever read
+	if (success)
+	{
+		std::remove(path.c_str());
+		success = std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+	}
+	if (!success)
+	{
+		std::remove(temporaryPath.c_str());
+		LogDebug("FaviconCache: Could not write file: ", path);
+	}
+}
+
+std::string FaviconCache::FilePath(const std::string& url) const
+{
+	// FNV-1a hash of URL is used as file name
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (const unsigned char c : url)
+	{
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	std::ostringstream stream;
+	stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+	return _directory + stream.str() + FAVICON_CACHE_FILE_EXTENSION;
+}
+
+void FaviconCache::Record(LookupResult result, double milliseconds)
+{
+	std::lock_guard<std::mutex> lock(_statisticsMutex);
+	switch (result)
+	{
+	case LookupResult::MEMORY_HIT:
+		_statistics.memoryHits++;
+		_statistics.accumulatedMemoryLatency += milliseconds;
+		break;
+	case LookupResult::DISK_HIT:
+		_statistics.diskHits++;
+		_statistics.accumulatedDiskLatency += milliseconds;
+		break;
+	case LookupResult::MISS:
+		_statistics.storedMisses++; // miss itself is counted at lookup
+		_statistics.accumulatedMissLatency += milliseconds;
+		break;
+	}
+}
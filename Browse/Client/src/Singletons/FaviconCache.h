@@ -0,0 +1,136 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton which caches decoded favicons. Recently used favicons are kept in
+// memory, all others are persisted in the user directory, addressed by the
+// hash of their URL. Disk access and decoding happen in a worker thread.
+// Access is threadsafe.
+
+#ifndef FAVICONCACHE_H_
+#define FAVICONCACHE_H_
+
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+class FaviconCache
+{
+public:
+
+	// Decoded favicon, bytes ordered in RGBA
+	struct Image
+	{
+		int width = 0;
+		int height = 0;
+		std::vector<unsigned char> data;
+	};
+
+	// Counters for hit-rate and latency (latency in milliseconds)
+	struct Statistics
+	{
+		int memoryHits = 0;
+		int diskHits = 0;
+		int misses = 0;
+		int storedMisses = 0; // misses whose downloaded favicon has been stored
+		double accumulatedMemoryLatency = 0.0;
+		double accumulatedDiskLatency = 0.0;
+		double accumulatedMissLatency = 0.0; // from lookup until downloaded favicon is stored
+	};
+
+	// Callback of asynchronous lookup. Image is nullptr at miss. Executed in worker thread!
+	typedef std::function<void(std::shared_ptr<const Image>)> Callback;
+
+	// Get instance
+	static FaviconCache& instance()
+	{
+		static FaviconCache _instance;
+		return _instance;
+	}
+
+	// Destructor, calls shutdown
+	~FaviconCache();
+
+	// Joins worker thread after pending disk writes. Pending lookups are dropped without calling their
+	// callbacks, so call this before CEF is shut down (should be only called by main.cpp)
+	void Shutdown();
+
+	// Set directory of cache on disk (should be only called by main.cpp). Without directory, only memory is used
+	void SetDirectory(std::string directory);
+
+	// Lookup favicon in memory only. Returns nullptr if not available
+	std::shared_ptr<const Image> Fetch(const std::string& url);
+
+	// Lookup favicon in memory and on disk. Callback is called in worker thread
+	void Load(const std::string& url, Callback callback);
+
+	// Store favicon in memory and write it asynchronously to disk. Null or empty image reports failed download
+	void Store(const std::string& url, std::shared_ptr<const Image> spImage);
+
+	// Get copy of current statistics
+	Statistics GetStatistics() const;
+
+	// Write statistics into log
+	void LogStatistics() const;
+
+private:
+
+	// Typedef of command which is executed in worker thread
+	typedef std::function<void()> Command;
+
+	// Private copy / assignment constructors
+	FaviconCache(); // threadsafe as only called by instance()
+	FaviconCache(const FaviconCache&) {}
+	FaviconCache& operator = (const FaviconCache &) { return *this; }
+
+	// Push command to worker thread
+	void PushBackCommand(Command command);
+
+	// Memory access. Caller must hold _memoryMutex
+	std::shared_ptr<const Image> FetchFromMemory(const std::string& url);
+	void StoreInMemory(const std::string& url, std::shared_ptr<const Image> spImage);
+
+	// Disk access. Only called in worker thread
+	std::shared_ptr<const Image> ReadFromDisk(const std::string& url) const;
+	void WriteToDisk(const std::string& url, std::shared_ptr<const Image> spImage) const;
+
+	// Path of file for URL
+	std::string FilePath(const std::string& url) const;
+
+	// Record a lookup in the statistics. Misses are recorded once their download is stored
+	enum class LookupResult { MEMORY_HIT, DISK_HIT, MISS };
+	void Record(LookupResult result, double milliseconds);
+
+	// Directory on disk, empty if not set
+	std::string _directory = "";
+
+	// Memory cache as list ordered by last usage (front is most recent) plus map for lookup
+	typedef std::pair<std::string, std::shared_ptr<const Image> > MemoryEntry;
+	std::list<MemoryEntry> _memoryList;
+	std::unordered_map<std::string, std::list<MemoryEntry>::iterator> _memoryMap;
+	mutable std::mutex _memoryMutex;
+
+	// Statistics
+	Statistics _statistics;
+	std::unordered_map<std::string, std::chrono::steady_clock::time_point> _missStarts; // start of lookups which missed, by URL
+	mutable std::mutex _statisticsMutex;
+
+	// Threading (thread defined in constructor)
+	std::mutex _commandMutex;
+	std::condition_variable _conditionVariable;
+	std::deque<Command> _commandQueue;
+	std::unique_ptr<std::thread> _upThread;
+	std::atomic<bool> _shouldStop;
+};
+
+#endif // FAVICONCACHE_H_
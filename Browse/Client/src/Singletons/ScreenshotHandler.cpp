@@ -3,13 +3,16 @@
 // Author: Christopher Dreide (cdreide@uni-koblenz.de)
 //============================================================================
 
-#pragma once
-
 #include "ScreenshotHandler.h"
 #include "src/Utils/Logger.h"
 #include "src/Setup.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
 
 #ifdef __linux__
+#include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
 #elif _WIN32
 #include <experimental/filesystem>
@@ -17,13 +20,166 @@ namespace fs = std::experimental::filesystem;
 namespace fs = std::experimental::filesystem::v1;
 #endif
 
-void ScreenshotHandler::SetBuffer(unsigned char const * buffer, int width, int height, int bytesPerPixel)
+namespace
 {
-	_buffer = buffer;
-	_width = width;
-	_height = height;
-	_bytesPerPixel = bytesPerPixel;
-};
+	// Encode BGRA pixels as RGBA image in the "Quite OK Image Format", which is lossless and fast
+	void EncodeQOI(const unsigned char* pPixels, int width, int height, std::vector<unsigned char>& rOutput)
+	{
+		struct Pixel { unsigned char r, g, b, a; };
+		auto equal = [](const Pixel& a, const Pixel& b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; };
+
+		// Header
+		rOutput.clear();
+		rOutput.reserve(14 + (size_t)width * (size_t)height + 8);
+		const unsigned char magic[4] = { 'q', 'o', 'i', 'f' };
+		rOutput.insert(rOutput.end(), magic, magic + 4);
+		for (unsigned int value : { (unsigned int)width, (unsigned int)height })
+		{
+			rOutput.push_back((unsigned char)(value >> 24));
+			rOutput.push_back((unsigned char)(value >> 16));
+			rOutput.push_back((unsigned char)(value >> 8));
+			rOutput.push_back((unsigned char)(value));
+		}
+		rOutput.push_back(4); // channels
+		rOutput.push_back(0); // sRGB with linear alpha
+
+		// Chunks
+		Pixel index[64] = {};
+		Pixel previous = { 0, 0, 0, 255 };
+		int run = 0;
+		const size_t count = (size_t)width * (size_t)height;
+		for (size_t i = 0; i < count; i++)
+		{
+			const unsigned char* pBGRA = pPixels + i * 4;
+			const Pixel pixel = { pBGRA[2], pBGRA[1], pBGRA[0], pBGRA[3] };
+			if (equal(pixel, previous))
+			{
+				run++;
+				if (run == 62 || i == count - 1)
+				{
+					rOutput.push_back((unsigned char)(0xc0 | (run - 1)));
+					run = 0;
+				}
+				continue;
+			}
+			if (run > 0)
+			{
+				rOutput.push_back((unsigned char)(0xc0 | (run - 1)));
+				run = 0;
+			}
+			const int hash = (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+			if (equal(index[hash], pixel))
+			{
+				rOutput.push_back((unsigned char)hash);
+			}
+			else
+			{
+				index[hash] = pixel;
+				if (pixel.a == previous.a)
+				{
+					const signed char dr = (signed char)(pixel.r - previous.r);
+					const signed char dg = (signed char)(pixel.g - previous.g);
+					const signed char db = (signed char)(pixel.b - previous.b);
+					const signed char dgr = (signed char)(dr - dg);
+					const signed char dgb = (signed char)(db - dg);
+					if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+					{
+						rOutput.push_back((unsigned char)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+					}
+					else if (dgr > -9 && dgr < 8 && dg > -33 && dg < 32 && dgb > -9 && dgb < 8)
+					{
+						rOutput.push_back((unsigned char)(0x80 | (dg + 32)));
+						rOutput.push_back((unsigned char)((dgr + 8) << 4 | (dgb + 8)));
+					}
+					else
+					{
+						const unsigned char chunk[4] = { 0xfe, pixel.r, pixel.g, pixel.b };
+						rOutput.insert(rOutput.end(), chunk, chunk + 4);
+					}
+				}
+				else
+				{
+					const unsigned char chunk[5] = { 0xff, pixel.r, pixel.g, pixel.b, pixel.a };
+					rOutput.insert(rOutput.end(), chunk, chunk + 5);
+				}
+			}
+			previous = pixel;
+		}
+
+		// End marker
+		const unsigned char end[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+		rOutput.insert(rOutput.end(), end, end + 8);
+	}
+
+	// Milliseconds between given time point and now
+	double MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+ScreenshotHandler::ScreenshotHandler()
+{
+	// Create worker thread which encodes and writes captures
+	_upThread = std::unique_ptr<std::thread>(new std::thread([this]()
+	{
+		while (true)
+		{
+			// Wait for capture
+			std::unique_ptr<Capture> upCapture;
+			{
+				std::unique_lock<std::mutex> lock(_captureMutex);
+				_conditionVariable.wait(lock, [this] { return !_captureQueue.empty() || _shouldStop; });
+				if (_captureQueue.empty()) { break; } // should stop and queue is worked off
+				upCapture = std::move(_captureQueue.front());
+				_captureQueue.pop_front();
+			}
+
+			// Write it
+			WriteCapture(*upCapture);
+
+			// Give buffer back to pool
+			std::lock_guard<std::mutex> lock(_captureMutex);
+			_capturePool.push_back(std::move(upCapture));
+		}
+	}));
+}
+
+ScreenshotHandler::~ScreenshotHandler()
+{
+	{
+		std::lock_guard<std::mutex> lock(_captureMutex);
+		_shouldStop = true;
+	}
+	_conditionVariable.notify_one();
+	_upThread->join();
+}
+
+void ScreenshotHandler::UpdateFrame(unsigned char const * buffer, int width, int height, int bytesPerPixel, int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight)
+{
+	// Copy everything when resolution changed
+	if (width != _width || height != _height || bytesPerPixel != _bytesPerPixel)
+	{
+		_width = width;
+		_height = height;
+		_bytesPerPixel = bytesPerPixel;
+		_frame.assign(buffer, buffer + (size_t)width * (size_t)height * (size_t)bytesPerPixel);
+		return;
+	}
+
+	// Copy only dirty rows of the region
+	const int left = std::max(0, dirtyX);
+	const int right = std::min(width, dirtyX + dirtyWidth);
+	const int top = std::max(0, dirtyY);
+	const int bottom = std::min(height, dirtyY + dirtyHeight);
+	if (left >= right) { return; }
+	const size_t rowBytes = (size_t)(right - left) * (size_t)bytesPerPixel;
+	for (int h = top; h < bottom; h++)
+	{
+		const size_t offset = ((size_t)h * (size_t)width + (size_t)left) * (size_t)bytesPerPixel;
+		std::memcpy(_frame.data() + offset, buffer + offset, rowBytes);
+	}
+}
 
 void ScreenshotHandler::SetGaze(int gazeX, int gazeY){
 	_currentGazeX = gazeX;
@@ -33,13 +189,73 @@ void ScreenshotHandler::SetGaze(int gazeX, int gazeY){
 void ScreenshotHandler::PrepareScreenshot(bool partial, std::string path)
 {
 	_path = path;
-	_reservedGazeX = _currentGazeX;
-	_reservedGazeY = _currentGazeY;
-	_partial = partial;
+	if (_frame.empty())
+	{
+		LogInfo("ScreenshotHandler: Nothing rendered, yet");
+		return;
+	}
+	auto start = std::chrono::steady_clock::now();
+
+	// Prepare the coordinates
+	int left = 0;
+	int right = _width;
+	int top = 0;
+	int bottom = _height;
+
+	// partial screenshot
+	if (partial && _currentGazeX != -1 && _currentGazeY != -1) {
+		// Prepare gaze data
+		left = std::max(0, _currentGazeX - setup::BMP_GAZE_RADIUS / 2);
+		right = std::min(_width, _currentGazeX + setup::BMP_GAZE_RADIUS / 2);
+		top = std::max(0, _currentGazeY - setup::BMP_GAZE_RADIUS / 2);
+		bottom = std::min(_height, _currentGazeY + setup::BMP_GAZE_RADIUS / 2);
+	}
+	if (left >= right || top >= bottom)
+	{
+		LogInfo("ScreenshotHandler: Gaze is outside of rendered screen");
+		return;
+	}
+
+	// Copy region into capture, converted to BGRA
+	auto upCapture = AcquireCapture();
+	upCapture->width = right - left;
+	upCapture->height = bottom - top;
+	upCapture->pixels.resize((size_t)upCapture->width * (size_t)upCapture->height * 4);
+	for (int h = top; h < bottom; h++)
+	{
+		const unsigned char* pSource = _frame.data() + ((size_t)h * (size_t)_width + (size_t)left) * (size_t)_bytesPerPixel;
+		unsigned char* pTarget = upCapture->pixels.data() + (size_t)(h - top) * (size_t)upCapture->width * 4;
+		if (_bytesPerPixel == 4)
+		{
+			std::memcpy(pTarget, pSource, (size_t)upCapture->width * 4);
+		}
+		else
+		{
+			for (int w = 0; w < upCapture->width; w++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					pTarget[w * 4 + c] = pSource[w * _bytesPerPixel + std::min(c, _bytesPerPixel - 1)];
+				}
+				pTarget[w * 4 + 3] = 255;
+			}
+		}
+	}
+	_upPreparedCapture = std::move(upCapture);
+
+	std::lock_guard<std::mutex> lock(_statisticsMutex);
+	_statistics.captured++;
+	_statistics.accumulatedCaptureTime += MillisecondsSince(start);
 }
 
 void ScreenshotHandler::TakeScreenshot(std::string fileName)
 {
+	if (!_upPreparedCapture)
+	{
+		LogInfo("ScreenshotHandler: No screenshot prepared");
+		return;
+	}
+
 	// if no fileName is provided use timestamp
 	if (fileName.length() < 1)
 	{
@@ -53,82 +269,91 @@ void ScreenshotHandler::TakeScreenshot(std::string fileName)
 		strftime(buffer, 80, "%Y-%m-%d-%H-%M-%S", timeinfo);
 		fileName = buffer;
 	}
+	_upPreparedCapture->filePath = _path + fileName + ".qoi";
 
-	// Path
-	std::string filePath = _path + fileName + ".bmp";
+	// Create directory, if necessary
 	if (!fs::exists(fs::path(_path))) {
 		fs::create_directory(fs::path(_path));
 	}
 
-	// Prepare the coordinates
-	int left = 0;
-	int right = _width;
-	int top = 0;
-	int bottom = _height;
+	// Hand capture over to worker thread, drop it when queue is full
+	bool dropped = false;
+	{
+		std::lock_guard<std::mutex> lock(_captureMutex);
+		if ((int)_captureQueue.size() < setup::SCREENSHOT_QUEUE_DEPTH)
+		{
+			_captureQueue.push_back(std::move(_upPreparedCapture));
+		}
+		else
+		{
+			_capturePool.push_back(std::move(_upPreparedCapture));
+			dropped = true;
+		}
+	}
+	if (dropped)
+	{
+		LogInfo("ScreenshotHandler: Dropped \"", fileName, "\" as too many screenshots are pending");
+		std::lock_guard<std::mutex> lock(_statisticsMutex);
+		_statistics.dropped++;
+		return;
+	}
+	_conditionVariable.notify_one();
+};
 
-	// partial screenshot
-	if (_partial && _reservedGazeX != -1 && _reservedGazeY != -1) {
-		// 0,0 is top right
-		// Prepare gaze data
-		left = (_reservedGazeX - setup::BMP_GAZE_RADIUS / 2);
-		if (left < 0)
-			left = 0;
-
-		right = _reservedGazeX + setup::BMP_GAZE_RADIUS / 2;
-		if (right > _width)
-			right = _width;
-
-		top = _reservedGazeY - setup::BMP_GAZE_RADIUS / 2;
-		if (top < 0)
-			top = 0;
-		
-		bottom = (_reservedGazeY + setup::BMP_GAZE_RADIUS / 2);
-		if (bottom > _height)
-			bottom = _height;
-
-		// reset reserved coordinates
-		_reservedGazeX = -1;
-		_reservedGazeY = -1;
-	}
-
-	int outWidth = right - left;
-	int outHeight = bottom - top;
-
-	// Prepare Header
-	unsigned char padding[3] = { 0, 0, 0 };
-	int paddingSize = (4 - (outWidth*_bytesPerPixel) % 4) % 4;
-	int filesize = 54 + 4 * outWidth*outHeight;
-	unsigned char bmpfileheader[14] = { 'B','M', 0,0,0,0, 0,0, 0,0, 54,0,0,0 };
-	unsigned char bmpinfoheader[40] = { 40,0,0,0, 0,0,0,0, 0,0,0,0, 1,0, 32,0 };
-
-	bmpfileheader[2] = (unsigned char)(filesize);
-	bmpfileheader[3] = (unsigned char)(filesize >> 8);
-	bmpfileheader[4] = (unsigned char)(filesize >> 16);
-	bmpfileheader[5] = (unsigned char)(filesize >> 24);
-
-	bmpinfoheader[4] = (unsigned char)(outWidth);
-	bmpinfoheader[5] = (unsigned char)(outWidth >> 8);
-	bmpinfoheader[6] = (unsigned char)(outWidth >> 16);
-	bmpinfoheader[7] = (unsigned char)(outWidth >> 24);
-	bmpinfoheader[8] = (unsigned char)(outHeight);
-	bmpinfoheader[9] = (unsigned char)(outHeight >> 8);
-	bmpinfoheader[10] = (unsigned char)(outHeight >> 16);
-	bmpinfoheader[11] = (unsigned char)(outHeight >> 24);
-
-	// Begin writing to File
-	FILE* imageFile = fopen(filePath.c_str(), "wb");
-
-	// Write Header
-	fwrite(bmpfileheader, 1, 14, imageFile);
-	fwrite(bmpinfoheader, 1, 40, imageFile);
-
-	for (int h = bottom - 1; h >= top; h--) {
-		fwrite(_buffer + (h*_width + left) * _bytesPerPixel, _bytesPerPixel, outWidth, imageFile);
-		fwrite(padding, 1, paddingSize, imageFile);
-	}
-
-	// End writing to File
+ScreenshotHandler::Statistics ScreenshotHandler::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(_statisticsMutex);
+	return _statistics;
+}
+
+std::unique_ptr<ScreenshotHandler::Capture> ScreenshotHandler::AcquireCapture()
+{
+	std::lock_guard<std::mutex> lock(_captureMutex);
+	if (_capturePool.empty())
+	{
+		return std::unique_ptr<Capture>(new Capture);
+	}
+	auto upCapture = std::move(_capturePool.back());
+	_capturePool.pop_back();
+	return upCapture;
+}
+
+void ScreenshotHandler::WriteCapture(const Capture& rCapture)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	// Encode
+	std::vector<unsigned char> encoded;
+	EncodeQOI(rCapture.pixels.data(), rCapture.width, rCapture.height, encoded);
+
+	// Write to file
+	FILE* imageFile = fopen(rCapture.filePath.c_str(), "wb");
+	if (!imageFile)
+	{
+		LogError("ScreenshotHandler: Could not open \"", rCapture.filePath, "\"");
+		return;
+	}
+	const bool success = fwrite(encoded.data(), 1, encoded.size(), imageFile) == encoded.size();
 	fclose(imageFile);
+	if (!success)
+	{
+		LogError("ScreenshotHandler: Could not write \"", rCapture.filePath, "\"");
+		return;
+	}
 
-	LogInfo("ScreenshotHandler: Saved: \"", fileName, ".bmp\"");
-};
+	// Update statistics
+	Statistics statistics;
+	{
+		std::lock_guard<std::mutex> lock(_statisticsMutex);
+		_statistics.written++;
+		_statistics.writtenBytes += (long long)encoded.size();
+		_statistics.accumulatedEncodingTime += MillisecondsSince(start);
+		statistics = _statistics;
+	}
+
+	LogInfo("ScreenshotHandler: Saved: \"", rCapture.filePath, "\" (", encoded.size(), " bytes)");
+	LogDebug("ScreenshotHandler: Average capture time: ", statistics.accumulatedCaptureTime / std::max(1, statistics.captured),
+		"ms, average encoding time: ", statistics.accumulatedEncodingTime / statistics.written,
+		"ms, throughput: ", (statistics.writtenBytes / 1024.0) / std::max(0.001, statistics.accumulatedEncodingTime / 1000.0),
+		"KB/s, dropped: ", statistics.dropped);
+}
@@ -2,14 +2,35 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Christopher Dreide (cdreide@uni-koblenz.de)
 //============================================================================
+// Keeps a copy of the rendered screen, which is updated at paint time. At
+// preparation of a screenshot, the requested region is copied into a pooled
+// buffer. Encoding to QOI and writing to disk happen in a worker thread.
 
 #pragma once
 #include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 class ScreenshotHandler {
 
 public:
 
+	// Counters for capture latency (copying of region) and throughput of encoding
+	struct Statistics
+	{
+		int captured = 0;
+		int written = 0;
+		int dropped = 0; // captures which did not fit into the queue
+		double accumulatedCaptureTime = 0.0; // milliseconds
+		double accumulatedEncodingTime = 0.0; // milliseconds
+		long long writtenBytes = 0;
+	};
+
 	// Get instance
 	static ScreenshotHandler& instance()
 	{
@@ -17,35 +38,69 @@ public:
 		return _instance;
 	}
 
-	// Destructor
-	~ScreenshotHandler() {};
+	// Destructor, writes remaining screenshots and joins worker thread
+	~ScreenshotHandler();
 
-	// Store the current rendered screen
-	void SetBuffer(unsigned char const * buffer, int width, int height, int bytesPerPixel);
+	// Copy dirty region of the current rendered screen, so you can take the screenshot everytime you want to
+	void UpdateFrame(unsigned char const * buffer, int width, int height, int bytesPerPixel, int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
 
 	// Store the current gaze
 	void SetGaze(int gazeX, int gazeY);
 
-	// Reserve the current gaze
+	// Copy region around the current gaze or the whole screen into a capture
 	void PrepareScreenshot(bool partial, std::string path);
 
-	// Takes screenshot, saves it in "path", with given filename (if filename is empty it uses an timestamp (%Y-%m-%d-%H-%M-%S)
+	// Takes prepared screenshot, saves it in "path", with given filename (if filename is empty it uses an timestamp (%Y-%m-%d-%H-%M-%S)
 	void TakeScreenshot(std::string fileName);
 
+	// Get copy of current statistics
+	Statistics GetStatistics() const;
+
 private:
 
-	std::string _path;
-	bool _partial;
+	// Copied region of the screen, waiting for encoding
+	struct Capture
+	{
+		std::vector<unsigned char> pixels; // BGRA, top row first
+		int width = 0;
+		int height = 0;
+		std::string filePath;
+	};
+
+	// Private copy / assignment constructors
+	ScreenshotHandler();
+	ScreenshotHandler(const ScreenshotHandler&) {}
+	ScreenshotHandler& operator = (const ScreenshotHandler &) { return *this; }
 
-	// Store Buffer after rendering, so you can take the Screenshot everytime you want to
-	const unsigned char* _buffer = (unsigned char const*)0;
+	// Get buffer from pool or create new one
+	std::unique_ptr<Capture> AcquireCapture();
+
+	// Encode and write capture. Executed in worker thread
+	void WriteCapture(const Capture& rCapture);
+
+	// Copy of the rendered screen
+	std::vector<unsigned char> _frame;
 	int _width = 0;
 	int _height = 0;
 	int _bytesPerPixel = 0;
 
+	// Capture prepared but not yet taken
+	std::unique_ptr<Capture> _upPreparedCapture;
+	std::string _path;
+
 	// Gaze Coordinates
 	int _currentGazeX = -1;
 	int _currentGazeY = -1;
-	int _reservedGazeX = -1;
-	int _reservedGazeY = -1;
+
+	// Statistics
+	Statistics _statistics;
+	mutable std::mutex _statisticsMutex;
+
+	// Threading (thread defined in constructor). Captures are moved back into pool after writing
+	std::mutex _captureMutex;
+	std::condition_variable _conditionVariable;
+	std::deque<std::unique_ptr<Capture> > _captureQueue;
+	std::vector<std::unique_ptr<Capture> > _capturePool;
+	std::unique_ptr<std::thread> _upThread;
+	bool _shouldStop = false;
 };
@@ -112,6 +112,9 @@ WebView::WebView(int x, int y, int width, int height)
 	_upWebpageRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource));
     _upHighlightRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, highlightFragmentShaderSource));
     _upCompositeRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, compositionFragmentShaderSource));
+    _webpageUniforms = UniformLocations(_upWebpageRenderItem->GetShader());
+    _highlightUniforms = UniformLocations(_upHighlightRenderItem->GetShader());
+    _compositeUniforms = UniformLocations(_upCompositeRenderItem->GetShader());
 
     // Framebuffer
     _upFramebuffer = std::unique_ptr<Framebuffer>(new Framebuffer(_width, _height));
@@ -170,9 +173,9 @@ void WebView::Draw(
     _spTexture->Bind();
 
     // Fill uniforms
-	_upWebpageRenderItem->GetShader()->UpdateValue("position", glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
-	_upWebpageRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
-	_upWebpageRenderItem->GetShader()->UpdateValue("dim", parameters.dim);
+	_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.position, glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
+	_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.textureCoordinate, glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
+	_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.dim, parameters.dim);
 
     // Draw webpage completely into framebuffer
 	_upWebpageRenderItem->Draw(GL_POINTS);
@@ -185,10 +188,10 @@ void WebView::Draw(
 
         // TODO: use value from highlight or so
         // For now: just reset dimming to zero for the rect rendering
-		_upHighlightRenderItem->GetShader()->UpdateValue("dim", 0.f);
+		_upHighlightRenderItem->GetShader()->UpdateValue(_highlightUniforms.dim, 0.f);
 
 		// Aspect ratio of web view
-		_upHighlightRenderItem->GetShader()->UpdateValue("aspectRatio", (float)_width / (float)_height);
+		_upHighlightRenderItem->GetShader()->UpdateValue(_highlightUniforms.aspectRatio, (float)_width / (float)_height);
 
         // Go over rects and render them
         for(Rect rect : _rects)
@@ -207,7 +210,7 @@ void WebView::Draw(
 
             // Setup position
 			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "position",
+                _highlightUniforms.position,
                 glm::vec4(
                     (((float)rect.left / (float)_width) * 2.f) - 1.f,
                     ((((float)(_height - rect.bottom)) / (float)_height) * 2.f) - 1.f,
@@ -216,7 +219,7 @@ void WebView::Draw(
 
             // Setup texture coordinate
 			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "textureCoordinate",
+                _highlightUniforms.textureCoordinate,
                 glm::vec4(
                     (float)rect.left / (float)_width,
                     1.f - (float)(_height - rect.bottom) / (float)_height,
@@ -245,17 +248,17 @@ void WebView::Draw(
 
     // Fill uniforms (TODO: here, coordinate sytem is not completely correctly translated. Would be only a problem at vertical transformation)
     _upCompositeRenderItem->GetShader()->UpdateValue(
-        "position",
+        _compositeUniforms.position,
         glm::vec4(
             ((_x / (float)windowWidth) * 2.f) - 1.f, // minX
             ((_y / (float)windowHeight) * 2.f) - 1.f, // minY
             (((_x + _width) / (float)windowWidth) * 2.f) - 1.f, // maxX
             (((_y + _height) / (float)windowHeight) * 2.f) - 1.f // maxY
             )); // normalized device coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
-    _upCompositeRenderItem->GetShader()->UpdateValue("centerOffset", glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoomPosition", glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoom", parameters.zoom);
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.textureCoordinate, glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.centerOffset, glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.zoomPosition, glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.zoom, parameters.zoom);
     _upCompositeRenderItem->Draw(GL_POINTS);
 }
 
@@ -68,6 +68,27 @@ public:
 
 private:
 
+    // Locations of uniforms used by the render items, resolved once at construction
+    struct UniformLocations
+    {
+        UniformLocations() {}
+        UniformLocations(const Shader* pShader) :
+            position(pShader->GetUniformLocation("position")),
+            textureCoordinate(pShader->GetUniformLocation("textureCoordinate")),
+            dim(pShader->GetUniformLocation("dim")),
+            aspectRatio(pShader->GetUniformLocation("aspectRatio")),
+            centerOffset(pShader->GetUniformLocation("centerOffset")),
+            zoomPosition(pShader->GetUniformLocation("zoomPosition")),
+            zoom(pShader->GetUniformLocation("zoom")) {}
+        GLint position = -1;
+        GLint textureCoordinate = -1;
+        GLint dim = -1;
+        GLint aspectRatio = -1;
+        GLint centerOffset = -1;
+        GLint zoomPosition = -1;
+        GLint zoom = -1;
+    };
+
     // Texture object which belongs here but filled by CEF and read maybe by other
     std::shared_ptr<Texture> _spTexture;
 
@@ -75,6 +96,9 @@ private:
     std::unique_ptr<RenderItem> _upWebpageRenderItem;
 	std::unique_ptr<RenderItem> _upHighlightRenderItem;
     std::unique_ptr<RenderItem> _upCompositeRenderItem;
+    UniformLocations _webpageUniforms;
+    UniformLocations _highlightUniforms;
+    UniformLocations _compositeUniforms;
 
     // Current values
     int _x = 0;
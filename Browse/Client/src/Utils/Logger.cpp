@@ -7,24 +7,42 @@
 #include "src/Global.h"
 #include "src/Setup.h"
 #include "submodules/spdlog/include/spdlog/spdlog.h"
+#include "submodules/spdlog/include/spdlog/async_logger.h"
 #include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdio>
 
 // Shared pointer of global logger
 std::shared_ptr<spdlog::logger> GlobalLog;
+std::once_flag GlobalLogFlag;
 
 // Definition of logger path variable
 std::string LogPath;
 
+// Definition of threshold
+std::atomic<int> LogThreshold((int)(setup::DEBUG_MODE ? LogLevel::Debug : LogLevel::Info));
+
 std::shared_ptr<spdlog::logger> Log()
 {
-    if (!GlobalLog) // check for null
-    {
-        // Create logger since there is no, yet
-        std::vector<spdlog::sink_ptr> sinks;
+	std::call_once(GlobalLogFlag, []()
+	{
+		// Create asynchronous logger, which puts messages into bounded lock-free queue that is worked off by a thread
+		std::vector<spdlog::sink_ptr> sinks;
 		sinks.push_back(std::make_shared<spdlog::sinks::rotating_file_sink_mt>(LogPath + LOG_FILE_NAME + ".txt", LOG_FILE_MAX_SIZE, LOG_FILE_COUNT));
-        sinks.push_back(std::make_shared<spdlog::sinks::stdout_sink_mt>());
-        GlobalLog = std::make_shared<spdlog::logger>("global_log", begin(sinks), end(sinks));
-        GlobalLog->set_pattern("[%D-%T] %l: %v");
+		sinks.push_back(std::make_shared<spdlog::sinks::stdout_sink_mt>());
+		GlobalLog = std::make_shared<spdlog::async_logger>(
+			"global_log",
+			begin(sinks),
+			end(sinks),
+			LOG_QUEUE_SIZE,
+			spdlog::async_overflow_policy::discard_log_msg, // never block calling thread, e.g. the render thread
+			nullptr,
+			LOG_FLUSH_INTERVAL);
+		GlobalLog->set_pattern("[%D-%T] %l: %v");
 
 		// Set logging level
 		if (setup::DEBUG_MODE)
@@ -35,27 +53,243 @@ std::shared_ptr<spdlog::logger> Log()
 		{
 			GlobalLog->set_level(spdlog::level::info);
 		}
-    }
-    return GlobalLog;
+	});
+	return GlobalLog;
+}
+
+void SetLogLevel(LogLevel level)
+{
+	switch (level)
+	{
+	case LogLevel::Debug:
+		Log()->set_level(spdlog::level::debug);
+		break;
+	case LogLevel::Info:
+		Log()->set_level(spdlog::level::info);
+		break;
+	case LogLevel::Error:
+		Log()->set_level(spdlog::level::err);
+		break;
+	case LogLevel::Off:
+		Log()->set_level(spdlog::level::off);
+		break;
+	}
+	LogThreshold = (int)level;
 }
 
 void LogInfo(const std::string& content)
 {
+	if (!IsLogLevelEnabled(LogLevel::Info)) { return; }
 	Log()->info(content);
 }
 
 void LogError(const std::string& content)
 {
+	if (!IsLogLevelEnabled(LogLevel::Error)) { return; }
 	Log()->error(content);
 }
 
 void LogDebug(const std::string& content)
 {
+	if (!LOG_DEBUG_COMPILED || !IsLogLevelEnabled(LogLevel::Debug)) { return; }
 	Log()->debug(content);
 }
 
 void LogBug(const std::string& content)
 {
+	if (!IsLogLevelEnabled(LogLevel::Error)) { return; }
 	Log()->error(content);
 }
 
+// #################
+// ### EVENT LOG ###
+// #################
+
+// Log of binary events. Producers push into bounded lock-free queue, a thread writes the records into file
+class EventLog
+{
+public:
+
+	// Fixed-size record as written into file
+	struct Record
+	{
+		std::int64_t timestamp; // microseconds since epoch
+		std::uint16_t type;
+		std::uint16_t reserved0 = 0;
+		std::uint32_t reserved1 = 0;
+		double a;
+		double b;
+	};
+
+	EventLog() : _cells(LOG_EVENT_QUEUE_SIZE)
+	{
+		for (size_t i = 0; i < _cells.size(); i++)
+		{
+			_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	~EventLog()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_stopMutex);
+			_shouldStop = true;
+		}
+		_stopCondition.notify_one();
+		if (_upThread) { _upThread->join(); }
+	}
+
+	// Push record into queue. Returns false when queue is full
+	bool Push(const Record& rRecord)
+	{
+		std::call_once(_threadFlag, [this]() { _upThread = std::unique_ptr<std::thread>(new std::thread([this]() { Run(); })); });
+		size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell& rCell = _cells[position & (_cells.size() - 1)];
+			const size_t sequence = rCell.sequence.load(std::memory_order_acquire);
+			const std::intptr_t difference = (std::intptr_t)sequence - (std::intptr_t)position;
+			if (difference == 0)
+			{
+				if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					rCell.record = rRecord;
+					rCell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				_droppedCount.fetch_add(1, std::memory_order_relaxed);
+				return false; // full
+			}
+			else
+			{
+				position = _enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Count of dropped records
+	std::uint64_t DroppedCount() const { return _droppedCount.load(std::memory_order_relaxed); }
+
+	// Write all queued records
+	void Flush()
+	{
+		std::lock_guard<std::mutex> lock(_fileMutex);
+		WriteQueued();
+	}
+
+private:
+
+	// Cell of queue
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		Record record;
+	};
+
+	// Loop of writing thread
+	void Run()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_stopMutex);
+				if (_stopCondition.wait_for(lock, LOG_FLUSH_INTERVAL, [this]() { return _shouldStop.load(); })) { break; }
+			}
+			Flush();
+		}
+		Flush();
+		if (_pFile) { fclose(_pFile); }
+	}
+
+	// Pop all queued records and write them. Only one consumer at a time (file mutex is held)
+	void WriteQueued()
+	{
+		if (!_pFile)
+		{
+			_pFile = fopen(EventFilePath(0).c_str(), "ab");
+			if (!_pFile) { return; }
+			fseek(_pFile, 0, SEEK_END);
+			_fileSize = ftell(_pFile);
+		}
+		Record record;
+		bool written = false;
+		while (true)
+		{
+			Cell& rCell = _cells[_dequeuePosition & (_cells.size() - 1)];
+			const size_t sequence = rCell.sequence.load(std::memory_order_acquire);
+			if ((std::intptr_t)sequence - (std::intptr_t)(_dequeuePosition + 1) < 0) { break; } // empty
+			record = rCell.record;
+			rCell.sequence.store(_dequeuePosition + _cells.size(), std::memory_order_release);
+			_dequeuePosition++;
+			if (_fileSize + (long)sizeof(Record) > LOG_FILE_MAX_SIZE && !Rotate()) { continue; } // record is lost without file
+			fwrite(&record, sizeof(Record), 1, _pFile);
+			_fileSize += sizeof(Record);
+			written = true;
+		}
+		if (written) { fflush(_pFile); }
+	}
+
+	// Path of event file with given index, like rotating file sink of spdlog (events.bin, events.1.bin, ...)
+	std::string EventFilePath(int index) const
+	{
+		return LogPath + LOG_EVENT_FILE_NAME + (index > 0 ? "." + std::to_string(index) : "") + ".bin";
+	}
+
+	// Close current file, shift older ones and open empty one. Returns false when no file could be opened
+	bool Rotate()
+	{
+		fclose(_pFile);
+		_pFile = nullptr;
+		_fileSize = 0;
+		for (int i = LOG_FILE_COUNT; i > 0; i--)
+		{
+			std::remove(EventFilePath(i).c_str());
+			std::rename(EventFilePath(i - 1).c_str(), EventFilePath(i).c_str());
+		}
+		_pFile = fopen(EventFilePath(0).c_str(), "wb");
+		return _pFile != nullptr;
+	}
+
+	// Queue
+	std::vector<Cell> _cells; // count must be power of two
+	std::atomic<size_t> _enqueuePosition{ 0 };
+	size_t _dequeuePosition = 0; // guarded by file mutex
+	std::atomic<std::uint64_t> _droppedCount{ 0 };
+
+	// Writing
+	std::mutex _fileMutex;
+	FILE* _pFile = nullptr;
+	long _fileSize = 0; // bytes in current file
+	std::once_flag _threadFlag;
+	std::unique_ptr<std::thread> _upThread;
+	std::atomic<bool> _shouldStop{ false };
+	std::mutex _stopMutex;
+	std::condition_variable _stopCondition; // wakes writing thread on shutdown
+};
+
+// Global event log
+EventLog GlobalEventLog;
+
+void LogEvent(LogEventType type, double a, double b)
+{
+	EventLog::Record record;
+	record.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	record.type = (std::uint16_t)type;
+	record.a = a;
+	record.b = b;
+	GlobalEventLog.Push(record);
+}
+
+std::uint64_t LogDroppedEventCount()
+{
+	return GlobalEventLog.DroppedCount();
+}
+
+void LogFlush()
+{
+	Log()->flush();
+	GlobalEventLog.Flush();
+}
@@ -2,27 +2,61 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Abstraction of logger. Can be called from threads, too.
+// Abstraction of logger. Can be called from threads, too. Text is written
+// asynchronously, arguments are only formatted when their level is enabled.
+// High-rate events can be logged in binary form via LogEvent.
 
 #ifndef LOGGER_H_
 #define LOGGER_H_
 
 #include <string>
 #include <sstream>
+#include <atomic>
+#include <cstdint>
 
 // Declaration of output path for log. Should be only set by main.cpp
 extern std::string LogPath;
 
+// Levels of logging
+enum class LogLevel { Debug = 0, Info = 1, Error = 2, Off = 3 }; // not uppercase, as ERROR is a macro on Windows
+
+// Compile-time gate, debug output is only compiled into debug builds
+#ifdef CLIENT_DEBUG
+static const bool LOG_DEBUG_COMPILED = true;
+#else
+static const bool LOG_DEBUG_COMPILED = false;
+#endif
+
+// Runtime gate. Declaration of minimal level that is logged
+extern std::atomic<int> LogThreshold;
+
+// Set minimal level that is logged
+void SetLogLevel(LogLevel level);
+
+// Check whether level is logged
+inline bool IsLogLevelEnabled(LogLevel level)
+{
+	return (int)level >= LogThreshold.load(std::memory_order_relaxed);
+}
+
+// Format arguments into string
+template<typename... Args>
+std::string LogFormat(Args const&... args)
+{
+	std::ostringstream stream;
+	using List = int[];
+	(void)List{0, ((void)(stream << args), 0) ... };
+	return stream.str();
+}
+
 // LogInfo
 void LogInfo(const std::string& content);
 
 template<typename... Args>
 void LogInfo(Args const&... args)
 {
-    std::ostringstream stream;
-    using List= int[];
-    (void)List{0, ((void)(stream << args), 0) ... };
-    LogInfo(stream.str());
+	if (!IsLogLevelEnabled(LogLevel::Info)) { return; }
+	LogInfo(LogFormat(args...));
 }
 
 // LogError
@@ -31,10 +65,8 @@ void LogError(const std::string& content);
 template<typename... Args>
 void LogError(Args const&... args)
 {
-    std::ostringstream stream;
-    using List= int[];
-    (void)List{0, ((void)(stream << args), 0) ... };
-    LogError(stream.str());
+	if (!IsLogLevelEnabled(LogLevel::Error)) { return; }
+	LogError(LogFormat(args...));
 }
 
 // LogDebug
@@ -43,10 +75,8 @@ void LogDebug(const std::string& content);
 template<typename... Args>
 void LogDebug(Args const&... args)
 {
-    std::ostringstream stream;
-    using List= int[];
-    (void)List{0, ((void)(stream << args), 0) ... };
-    LogDebug(stream.str());
+	if (!LOG_DEBUG_COMPILED || !IsLogLevelEnabled(LogLevel::Debug)) { return; }
+	LogDebug(LogFormat(args...));
 }
 
 // LogBug
@@ -55,10 +85,20 @@ void LogBug(const std::string& content);
 template<typename... Args>
 void LogBug(Args const&... args)
 {
-    std::ostringstream stream;
-    using List= int[];
-    (void)List{0, ((void)(stream << args), 0) ... };
-    LogBug(stream.str());
+	if (!IsLogLevelEnabled(LogLevel::Error)) { return; }
+	LogBug(LogFormat(args...));
 }
 
+// Types of binary events
+enum class LogEventType : std::uint16_t { GAZE_SAMPLE = 0, MOUSE_SAMPLE = 1 };
+
+// LogEvent, writes fixed-size record with timestamp into binary event log. Never blocks, drops events at overflow
+void LogEvent(LogEventType type, double a = 0.0, double b = 0.0);
+
+// Count of events dropped because of full queue
+std::uint64_t LogDroppedEventCount();
+
+// Write everything logged so far
+void LogFlush();
+
 #endif // LOGGER_H_
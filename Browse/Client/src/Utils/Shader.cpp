@@ -46,6 +46,20 @@ Shader::Shader(std::string vertSource, std::string geomSource, std::string fragS
     glDeleteShader(vertexShader);
     if(geometryShader >= 0) { glDeleteShader(geometryShader); }
     glDeleteShader(fragmentShader);
+
+    // Resolve locations of all active uniforms once
+    GLint count = 0;
+    glGetProgramiv(_program, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        GLchar name[128];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = GL_ZERO;
+        glGetActiveUniform(_program, (GLuint)i, sizeof(name) - 1, &length, &size, &type, name);
+        name[length] = 0;
+        _uniformLocations[name] = glGetUniformLocation(_program, name);
+    }
 }
 
 Shader::~Shader()
@@ -58,32 +72,68 @@ void Shader::Bind() const
     glUseProgram(_program);
 }
 
-void Shader::UpdateValue(std::string name, const int& rValue) const
+GLint Shader::GetUniformLocation(const std::string& rName) const
+{
+    auto iter = _uniformLocations.find(rName);
+    return iter != _uniformLocations.end() ? iter->second : -1;
+}
+
+void Shader::UpdateValue(GLint location, const int& rValue) const
+{
+    glUniform1i(location, rValue);
+}
+
+void Shader::UpdateValue(GLint location, const float& rValue) const
+{
+    glUniform1f(location, rValue);
+}
+
+void Shader::UpdateValue(GLint location, const glm::vec2& rValue) const
+{
+    glUniform2fv(location, 1, glm::value_ptr(rValue));
+}
+
+void Shader::UpdateValue(GLint location, const glm::vec3& rValue) const
+{
+    glUniform3fv(location, 1, glm::value_ptr(rValue));
+}
+
+void Shader::UpdateValue(GLint location, const glm::vec4& rValue) const
+{
+    glUniform4fv(location, 1, glm::value_ptr(rValue));
+}
+
+void Shader::UpdateValue(GLint location, const glm::mat4& rValue) const
+{
+    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(rValue));
+}
+
+void Shader::UpdateValue(const std::string& rName, const int& rValue) const
 {
-    glUniform1i(glGetUniformLocation(_program, name.c_str()), rValue);
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
 
-void Shader::UpdateValue(std::string name, const float& rValue) const
+void Shader::UpdateValue(const std::string& rName, const float& rValue) const
 {
-    glUniform1f(glGetUniformLocation(_program, name.c_str()), rValue);
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec2& rValue) const
+void Shader::UpdateValue(const std::string& rName, const glm::vec2& rValue) const
 {
-    glUniform2fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec3& rValue) const
+void Shader::UpdateValue(const std::string& rName, const glm::vec3& rValue) const
 {
-    glUniform3fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec4& rValue) const
+void Shader::UpdateValue(const std::string& rName, const glm::vec4& rValue) const
 {
-    glUniform4fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
 
-void Shader::UpdateValue(std::string name, const glm::mat4& rValue) const
+void Shader::UpdateValue(const std::string& rName, const glm::mat4& rValue) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(_program, name.c_str()), 1, GL_FALSE, glm::value_ptr(rValue));
+    UpdateValue(GetUniformLocation(rName), rValue);
 }
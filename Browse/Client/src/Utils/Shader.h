@@ -10,6 +10,7 @@
 #include "externals/OGL/gl_core_3_3.h"
 #include "src/Utils/glmWrapper.h"
 #include <string>
+#include <unordered_map>
 
 class Shader
 {
@@ -25,13 +26,24 @@ public:
     // Bind shader program
     void Bind() const;
 
-    // Update values in shader. Bind before updating!
-    void UpdateValue(std::string name, const int& rValue) const;
-    void UpdateValue(std::string name, const float& rValue) const;
-    void UpdateValue(std::string name, const glm::vec2& rValue) const;
-    void UpdateValue(std::string name, const glm::vec3& rValue) const;
-    void UpdateValue(std::string name, const glm::vec4& rValue) const;
-    void UpdateValue(std::string name, const glm::mat4& rValue) const;
+    // Get location of uniform, resolved at link time. Returns -1 if not available
+    GLint GetUniformLocation(const std::string& rName) const;
+
+    // Update values in shader via location. Bind before updating!
+    void UpdateValue(GLint location, const int& rValue) const;
+    void UpdateValue(GLint location, const float& rValue) const;
+    void UpdateValue(GLint location, const glm::vec2& rValue) const;
+    void UpdateValue(GLint location, const glm::vec3& rValue) const;
+    void UpdateValue(GLint location, const glm::vec4& rValue) const;
+    void UpdateValue(GLint location, const glm::mat4& rValue) const;
+
+    // Update values in shader via name, which is slower. Bind before updating!
+    void UpdateValue(const std::string& rName, const int& rValue) const;
+    void UpdateValue(const std::string& rName, const float& rValue) const;
+    void UpdateValue(const std::string& rName, const glm::vec2& rValue) const;
+    void UpdateValue(const std::string& rName, const glm::vec3& rValue) const;
+    void UpdateValue(const std::string& rName, const glm::vec4& rValue) const;
+    void UpdateValue(const std::string& rName, const glm::mat4& rValue) const;
 
     // Get program handle
     GLuint GetProgram() const { return _program; }
@@ -40,6 +52,9 @@ private:
 
     // Handle
     GLuint _program = 0;
+
+    // Locations of active uniforms
+    std::unordered_map<std::string, GLint> _uniformLocations;
 };
 
 
@@ -13,6 +13,8 @@
 
 #include "src/Master/Master.h"
 #include "src/Utils/Logger.h"
+#include "src/Singletons/FaviconCache.h"
+#include "src/Global.h"
 
 
 // Execute function to have Master object on stack which might be faster than on heap
@@ -70,6 +72,9 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
 	LogInfo("Version: ", CLIENT_VERSION);
 	LogInfo("Personal files are saved in: ", userDirectory);
 
+	// Set path of favicon cache
+	FaviconCache::instance().SetDirectory(userDirectory + FAVICON_CACHE_DIRECTORY + "/");
+
 	// Turn on offscreen rendering.
 	settings.windowless_rendering_enabled = true;
 	settings.remote_debugging_port = 8088;
@@ -82,15 +87,28 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
     // Execute our code
     bool shutdownOnExit = Execute(app, userDirectory, useVoice);
 
+	// Stop favicon cache before CEF, as its callbacks post tasks to CEF
+	FaviconCache::instance().Shutdown();
+
 
 	// Shutdown CEF
     LogInfo("Shutdown CEF...");
     CefShutdown();
     LogInfo("..done.");
 
+	// Report usage of favicon cache
+	FaviconCache::instance().LogStatistics();
+
+	// Report dropped events
+	if (LogDroppedEventCount() > 0)
+	{
+		LogInfo("Dropped binary log events: ", LogDroppedEventCount());
+	}
+
     // Return zero
     LogInfo("Successful termination of program.");
     LogInfo("####################################################");
+	LogFlush();
 
 	// Tell computer to shut down
 	if (shutdownOnExit)
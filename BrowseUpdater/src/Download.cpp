@@ -0,0 +1,407 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Download.h"
+#include "SHA256.h"
+#include "externals/curl/include/curl/curl.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+	// Constants
+	const int connectionCount = 4;
+	const uint64_t chunkSize = 4 * 1024 * 1024;
+	const int chunkAttempts = 3;
+	const long long progressIntervalMS = 500;
+	const long lowSpeedLimit = 1024; // bytes per second, slower transfers are aborted...
+	const long lowSpeedTime = 30; // ...after this many seconds
+	const std::string dataExtension = ".download";
+	const std::string stateExtension = ".state";
+
+	// Progress of download, shared by connections
+	struct State
+	{
+		std::string url;
+		uint64_t size = 0;
+		std::string chunks; // '1' for each finished chunk, '0' otherwise
+	};
+
+	// Callback for CURL to append to string
+	size_t CURLAppend(void *contents, size_t size, size_t nmemb, void *userp)
+	{
+		((std::string*)userp)->append((char*)contents, size * nmemb);
+		return size * nmemb;
+	}
+
+	// Callback for CURL to write into stream, counting bytes
+	struct StreamTarget
+	{
+		std::ofstream* pStream;
+		std::atomic<uint64_t>* pReceived;
+	};
+	size_t CURLWriteStream(void *contents, size_t size, size_t nmemb, void *userp)
+	{
+		StreamTarget* pTarget = (StreamTarget*)userp;
+		pTarget->pStream->write((char*)contents, size * nmemb);
+		*pTarget->pReceived += size * nmemb;
+		return pTarget->pStream->good() ? size * nmemb : 0;
+	}
+
+	// Callback for CURL to find out whether server accepts range requests
+	size_t CURLHeader(char *buffer, size_t size, size_t nitems, void *userp)
+	{
+		std::string line(buffer, size * nitems);
+		std::transform(line.begin(), line.end(), line.begin(), ::tolower);
+		if (line.find("accept-ranges:") == 0 && line.find("bytes") != std::string::npos)
+		{
+			*((bool*)userp) = true;
+		}
+		return size * nitems;
+	}
+
+	// Setup common options of CURL handle
+	void SetupCURL(CURL* curl, const std::string& url)
+	{
+		curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+		curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, lowSpeedLimit);
+		curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, lowSpeedTime);
+	}
+
+	// Retrieve size of file and whether server accepts range requests
+	bool Probe(const std::string& url, uint64_t& rSize, bool& rRanges)
+	{
+		CURL* curl = curl_easy_init();
+		if (!curl)
+		{
+			return false;
+		}
+		rRanges = false;
+		SetupCURL(curl, url);
+		curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+		curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, CURLHeader);
+		curl_easy_setopt(curl, CURLOPT_HEADERDATA, &rRanges);
+		CURLcode res = curl_easy_perform(curl);
+		long responseCode = 0;
+		curl_off_t length = -1; // unknown
+		curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+		curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+		curl_easy_cleanup(curl);
+		if (res != CURLE_OK || responseCode != 200)
+		{
+			return false;
+		}
+		rSize = length > 0 ? (uint64_t)length : 0; // zero if unknown
+		rRanges = rRanges && rSize > 0;
+		return true;
+	}
+
+	// Read state of earlier download. Returns false if not available or for other URL or size
+	bool ReadState(const std::string& statePath, State& rState)
+	{
+		std::ifstream ifs(statePath);
+		State state;
+		std::string size;
+		if (!std::getline(ifs, state.url) || !std::getline(ifs, size) || !std::getline(ifs, state.chunks))
+		{
+			return false;
+		}
+		if (state.url != rState.url
+			|| size != std::to_string(rState.size)
+			|| state.chunks.size() != rState.chunks.size()
+			|| state.chunks.find_first_not_of("01") != std::string::npos)
+		{
+			return false;
+		}
+		rState.chunks = state.chunks;
+		return true;
+	}
+
+	// Write state of download. Written to temporary file first, so an interruption keeps the previous state
+	void WriteState(const std::string& statePath, const State& rState)
+	{
+		std::string tmpStatePath = statePath + ".tmp";
+		{
+			std::ofstream ofs(tmpStatePath, std::ios::trunc);
+			ofs << rState.url << "\n" << rState.size << "\n" << rState.chunks << "\n";
+			if (!ofs)
+			{
+				return;
+			}
+		}
+		std::remove(statePath.c_str()); // rename does not replace existing files on every platform
+		std::rename(tmpStatePath.c_str(), statePath.c_str());
+	}
+
+	// Download whole file with single transfer
+	std::string DownloadStream(const std::string& url, const std::string& dataPath, uint64_t size)
+	{
+		CURL* curl = curl_easy_init();
+		if (!curl)
+		{
+			return "CURL could not be instantiated.";
+		}
+		std::ofstream ofs(dataPath, std::ios::binary | std::ios::trunc);
+		if (!ofs)
+		{
+			curl_easy_cleanup(curl);
+			return "Target path for download could not be opened.";
+		}
+
+		// Transfer on thread, while this one reports progress
+		std::atomic<uint64_t> received(0);
+		StreamTarget target = { &ofs, &received };
+		SetupCURL(curl, url);
+		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CURLWriteStream);
+		curl_easy_setopt(curl, CURLOPT_WRITEDATA, &target);
+		std::atomic<bool> done(false);
+		CURLcode res = CURLE_OK;
+		std::thread transfer([&]() { res = curl_easy_perform(curl); done = true; });
+		Progress progress(size);
+		while (!done)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			progress.Report(received);
+		}
+		transfer.join();
+		progress.Report(received, true);
+
+		long responseCode = 0;
+		curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+		curl_easy_cleanup(curl);
+		ofs.close();
+		if (res != CURLE_OK)
+		{
+			return "curl_easy_perform() failed: " + std::string(curl_easy_strerror(res));
+		}
+		if (responseCode != 200 || !ofs)
+		{
+			return "Download failed with response code " + std::to_string(responseCode) + ".";
+		}
+		return "";
+	}
+
+	// Download missing chunks with concurrent range requests, recording finished ones in state file
+	std::string DownloadChunks(const std::string& url, const std::string& dataPath, const std::string& statePath, uint64_t size)
+	{
+		// Continue earlier download if state matches, otherwise start over with file of full size
+		State state;
+		state.url = url;
+		state.size = size;
+		state.chunks = std::string((size_t)((size + chunkSize - 1) / chunkSize), '0');
+		bool resume = ReadState(statePath, state);
+		if (resume)
+		{
+			std::ifstream existing(dataPath, std::ios::binary | std::ios::ate);
+			resume = existing && (uint64_t)existing.tellg() == size;
+		}
+		if (!resume)
+		{
+			state.chunks = std::string(state.chunks.size(), '0');
+			std::ofstream ofs(dataPath, std::ios::binary | std::ios::trunc);
+			ofs.seekp((std::streamoff)(size - 1));
+			ofs.put('\0');
+			if (!ofs)
+			{
+				return "Target path for download could not be opened.";
+			}
+			WriteState(statePath, state);
+		}
+		else
+		{
+			std::cout << "Resuming earlier download..." << std::endl;
+		}
+
+		// Bytes of finished chunks count as received
+		std::atomic<uint64_t> received(0);
+		for (size_t i = 0; i < state.chunks.size(); i++)
+		{
+			if (state.chunks[i] == '1')
+			{
+				received += std::min(chunkSize, size - i * chunkSize);
+			}
+		}
+
+		// Connections take next missing chunk until none is left or a chunk failed repeatedly
+		std::mutex mutex;
+		size_t nextChunk = 0;
+		std::string error = "";
+		auto work = [&]()
+		{
+			CURL* curl = curl_easy_init();
+			std::fstream file(dataPath, std::ios::binary | std::ios::in | std::ios::out);
+			if (!curl || !file)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				error = "Connection could not be set up.";
+			}
+			std::string buffer;
+			while (curl && file)
+			{
+				// Find missing chunk
+				size_t chunk = 0;
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					while (nextChunk < state.chunks.size() && state.chunks[nextChunk] == '1')
+					{
+						nextChunk++;
+					}
+					if (!error.empty() || nextChunk >= state.chunks.size())
+					{
+						break;
+					}
+					chunk = nextChunk++;
+				}
+				uint64_t begin = chunk * chunkSize;
+				uint64_t length = std::min(chunkSize, size - begin);
+
+				// Request range of chunk, which must be answered completely with partial content
+				bool success = false;
+				for (int attempt = 0; attempt < chunkAttempts && !success; attempt++)
+				{
+					buffer.clear();
+					buffer.reserve((size_t)length);
+					SetupCURL(curl, url);
+					curl_easy_setopt(curl, CURLOPT_RANGE, (std::to_string(begin) + "-" + std::to_string(begin + length - 1)).c_str());
+					curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CURLAppend);
+					curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
+					CURLcode res = curl_easy_perform(curl);
+					long responseCode = 0;
+					curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+					success = res == CURLE_OK && responseCode == 206 && buffer.size() == length;
+				}
+				if (success)
+				{
+					file.seekp((std::streamoff)begin);
+					file.write(buffer.data(), buffer.size());
+					file.flush();
+					success = file.good();
+				}
+
+				// Record chunk only after its data has been written
+				std::lock_guard<std::mutex> lock(mutex);
+				if (success)
+				{
+					state.chunks[chunk] = '1';
+					WriteState(statePath, state);
+					received += length;
+				}
+				else if (error.empty())
+				{
+					error = "Chunk at " + std::to_string(begin) + " could not be downloaded.";
+				}
+			}
+			if (curl)
+			{
+				curl_easy_cleanup(curl);
+			}
+		};
+
+		// Run connections while reporting progress
+		std::vector<std::thread> connections;
+		int count = (int)std::min<size_t>(connectionCount, state.chunks.size());
+		for (int i = 0; i < count; i++)
+		{
+			connections.push_back(std::thread(work));
+		}
+		Progress progress(size);
+		while (true)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (state.chunks.find('0') == std::string::npos || !error.empty())
+				{
+					break;
+				}
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			progress.Report(received);
+		}
+		for (std::thread& rConnection : connections)
+		{
+			rConnection.join();
+		}
+		progress.Report(received, true);
+		return error;
+	}
+}
+
+Progress::Progress(uint64_t total, const std::string& label)
+{
+	_total = total;
+	_label = label;
+}
+
+void Progress::Report(uint64_t done, bool force)
+{
+	auto now = std::chrono::steady_clock::now();
+	if (!force && _reported && std::chrono::duration_cast<std::chrono::milliseconds>(now - _lastReport).count() < progressIntervalMS)
+	{
+		return;
+	}
+	_lastReport = now;
+	_reported = true;
+	std::cout << "\r" << _label << " " << done / 1024 << " KiB";
+	if (_total > 0)
+	{
+		std::cout << " of " << _total / 1024 << " KiB";
+	}
+	std::cout << (force ? "\n" : "") << std::flush;
+}
+
+std::string DownloadFile(const std::string& url, const std::string& path, const std::string& expectedHash)
+{
+	const std::string dataPath = path + dataExtension;
+	const std::string statePath = path + stateExtension;
+
+	// Ask server for size and range support
+	uint64_t size = 0;
+	bool ranges = false;
+	if (!Probe(url, size, ranges))
+	{
+		return "Server did not answer request for " + url + ".";
+	}
+
+	// Download into data file, state is kept if interrupted
+	std::string error = ranges ? DownloadChunks(url, dataPath, statePath, size) : DownloadStream(url, dataPath, size);
+	if (!error.empty())
+	{
+		return error;
+	}
+
+	// Compare complete file with expected hash, a mismatch can not be resumed
+	if (!expectedHash.empty() && SHA256::OfFile(dataPath) != expectedHash)
+	{
+		std::remove(dataPath.c_str());
+		std::remove(statePath.c_str());
+		return "Downloaded file does not match its hash.";
+	}
+
+	// Move data to target
+	std::remove(path.c_str());
+	if (std::rename(dataPath.c_str(), path.c_str()) != 0)
+	{
+		return "Downloaded file could not be moved to target path.";
+	}
+	std::remove(statePath.c_str());
+	return "";
+}
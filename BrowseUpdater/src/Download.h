@@ -0,0 +1,51 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Download engine retrieving files in chunks with several concurrent HTTP range
+// requests. Finished chunks are recorded in a state file next to the target,
+// so an interrupted download continues with the missing chunks when started
+// again for the same URL. Servers without range support get a single transfer.
+
+#ifndef DOWNLOAD_H_
+#define DOWNLOAD_H_
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+// Prints count of processed bytes, at most once per interval
+class Progress
+{
+public:
+
+	// Constructor, total may be zero if unknown. Label describes what happens to the bytes
+	Progress(uint64_t total, const std::string& label = "Retrieved");
+
+	// Report count of processed bytes. Printed if interval has passed or forced
+	void Report(uint64_t done, bool force = false);
+
+private:
+
+	// Members
+	uint64_t _total;
+	std::string _label;
+	std::chrono::steady_clock::time_point _lastReport;
+	bool _reported = false;
+};
+
+// Download URL into file at path. Content is compared with SHA-256 if expected hash is not empty.
+// CURL must have been initialized globally before. Returns error message or empty string
+std::string DownloadFile(const std::string& url, const std::string& path, const std::string& expectedHash = "");
+
+#endif // DOWNLOAD_H_
@@ -0,0 +1,193 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Install.h"
+#include "Download.h"
+#include "submodules/miniz/miniz.h"
+#include "submodules/miniz/miniz_zip.h"
+#include <filesystem>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+namespace fs = std::experimental::filesystem;
+
+namespace
+{
+	// Constants
+	const std::string stagingExtension = ".staging";
+	const std::string previousExtension = ".previous";
+	const unsigned int maxWorkerCount = 8;
+
+	// File in zip
+	struct ZipFile
+	{
+		mz_uint index;
+		uint64_t size;
+	};
+}
+
+std::string StagingPath(const std::string& installPath)
+{
+	return installPath + stagingExtension;
+}
+
+void RecoverInstall(const std::string& installPath)
+{
+	const std::string previousPath = installPath + previousExtension;
+	std::error_code error;
+	if (!fs::exists(previousPath, error))
+	{
+		return;
+	}
+	if (!fs::exists(installPath, error))
+	{
+		fs::rename(previousPath, installPath, error); // stopped between renames, restore old version
+	}
+	else
+	{
+		fs::remove_all(previousPath, error); // stopped while removing old version
+	}
+}
+
+std::string ExtractZip(const std::string& zipPath, const std::string& targetPath)
+{
+	// List content and create all directories, also those only implied by paths of files
+	mz_zip_archive zip_archive;
+	memset(&zip_archive, 0, sizeof(zip_archive));
+	if (!mz_zip_reader_init_file(&zip_archive, zipPath.c_str(), 0))
+	{
+		return "Temporary zip file could not be read.";
+	}
+	std::vector<ZipFile> files;
+	uint64_t totalSize = 0;
+	bool valid = true;
+	for (mz_uint i = 0; i < mz_zip_reader_get_num_files(&zip_archive) && valid; ++i)
+	{
+		mz_zip_archive_file_stat file_stat;
+		if (!mz_zip_reader_file_stat(&zip_archive, i, &file_stat))
+		{
+			valid = false;
+			break;
+		}
+		fs::path path = targetPath + "/" + file_stat.m_filename;
+		std::error_code error;
+		if (mz_zip_reader_is_file_a_directory(&zip_archive, i))
+		{
+			fs::create_directories(path, error);
+		}
+		else
+		{
+			fs::create_directories(path.parent_path(), error);
+			files.push_back({ i, (uint64_t)file_stat.m_uncomp_size });
+			totalSize += file_stat.m_uncomp_size;
+		}
+		valid = !error;
+	}
+	mz_zip_reader_end(&zip_archive);
+	if (!valid)
+	{
+		return "Temporary zip file could not be read.";
+	}
+
+	// Largest files first, so no worker is left with a large file at the end
+	std::sort(files.begin(), files.end(), [](const ZipFile& a, const ZipFile& b) { return a.size > b.size; });
+
+	// Workers take next file until all are extracted or one failed. Readers of miniz are not thread safe,
+	// so each worker opens the archive on its own
+	std::atomic<size_t> nextFile(0);
+	std::atomic<uint64_t> extractedSize(0);
+	std::atomic<bool> failed(false);
+	auto work = [&]()
+	{
+		mz_zip_archive worker_archive;
+		memset(&worker_archive, 0, sizeof(worker_archive));
+		if (!mz_zip_reader_init_file(&worker_archive, zipPath.c_str(), 0))
+		{
+			failed = true;
+			return;
+		}
+		for (size_t i = nextFile++; i < files.size() && !failed; i = nextFile++)
+		{
+			mz_zip_archive_file_stat file_stat;
+			if (!mz_zip_reader_file_stat(&worker_archive, files[i].index, &file_stat)
+				|| !mz_zip_reader_extract_to_file(&worker_archive, files[i].index, (targetPath + "/" + file_stat.m_filename).c_str(), 0))
+			{
+				failed = true;
+			}
+			extractedSize += files[i].size;
+		}
+		mz_zip_reader_end(&worker_archive);
+	};
+	unsigned int workerCount = std::max(1u, std::min(std::thread::hardware_concurrency(), maxWorkerCount));
+	workerCount = (unsigned int)std::min<size_t>(workerCount, std::max<size_t>(files.size(), 1));
+	std::vector<std::thread> workers;
+	for (unsigned int i = 0; i < workerCount; i++)
+	{
+		workers.push_back(std::thread(work));
+	}
+
+	// Report progress until workers are done
+	Progress progress(totalSize, "Extracted");
+	while (nextFile < files.size() && !failed)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		progress.Report(extractedSize);
+	}
+	for (std::thread& rWorker : workers)
+	{
+		rWorker.join();
+	}
+	progress.Report(extractedSize, true);
+
+	return failed ? "Temporary zip file could not be extracted." : "";
+}
+
+std::string SwapInstall(const std::string& installPath)
+{
+	const std::string stagingPath = StagingPath(installPath);
+	const std::string previousPath = installPath + previousExtension;
+	std::error_code error;
+
+	// Move old version aside. Without old version, staged one is moved in directly
+	fs::remove_all(previousPath, error);
+	bool hadInstall = fs::exists(installPath, error);
+	if (hadInstall)
+	{
+		fs::rename(installPath, previousPath, error);
+		if (error)
+		{
+			return "Old version could not be moved, maybe it is still running.";
+		}
+	}
+
+	// Move new version in, otherwise move old version back
+	fs::rename(stagingPath, installPath, error);
+	if (error)
+	{
+		if (hadInstall)
+		{
+			fs::rename(previousPath, installPath, error);
+		}
+		return "New version could not be moved to directory.";
+	}
+
+	// Remove old version, which is done at next start if interrupted
+	fs::remove_all(previousPath, error);
+	return "";
+}
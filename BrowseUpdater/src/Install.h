@@ -0,0 +1,40 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Installation of a new version. The new version is staged in a sibling of the
+// installation, so both are on the same volume, and switched in by two renames:
+// installation to previous, then staging to installation. Whenever the updater
+// stops, the installation is either the complete old or the complete new version,
+// or missing with the old version still at previous, which is restored at start.
+
+#ifndef INSTALL_H_
+#define INSTALL_H_
+
+#include <string>
+
+// Sibling directory in which new version is assembled
+std::string StagingPath(const std::string& installPath);
+
+// Finish or roll back switch of versions that was interrupted. Call before installation is read
+void RecoverInstall(const std::string& installPath);
+
+// Extract zip into existing directory with several workers, each of which reads the archive on its own.
+// Returns error message or empty string
+std::string ExtractZip(const std::string& zipPath, const std::string& targetPath);
+
+// Switch installation to staged version. Old version is restored if staged one cannot be moved in.
+// Returns error message or empty string
+std::string SwapInstall(const std::string& installPath);
+
+#endif // INSTALL_H_
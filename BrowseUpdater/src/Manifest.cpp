@@ -0,0 +1,111 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Manifest.h"
+#include "SHA256.h"
+#include <sstream>
+#include <filesystem>
+
+namespace
+{
+	// Whether path stays inside of installation
+	bool IsSafePath(const std::string& rPath)
+	{
+		if (rPath.empty() || rPath[0] == '/' || rPath[0] == '\\' || rPath.find(':') != std::string::npos)
+		{
+			return false;
+		}
+		std::stringstream ss(rPath);
+		std::string component;
+		while (std::getline(ss, component, '/'))
+		{
+			if (component.empty() || component == "." || component == ".." || component.find('\\') != std::string::npos)
+			{
+				return false;
+			}
+		}
+		return rPath.back() != '/';
+	}
+
+	// Whether string is SHA-256 in lower case hex
+	bool IsHash(const std::string& rHash)
+	{
+		return rHash.size() == 64 && rHash.find_first_not_of("0123456789abcdef") == std::string::npos;
+	}
+}
+
+bool ParseManifest(const std::string& rContent, std::vector<ManifestEntry>& rEntries)
+{
+	rEntries.clear();
+	std::stringstream ss(rContent);
+	std::string line;
+	while (std::getline(ss, line))
+	{
+		// Tolerate line endings of Windows and empty lines
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+		if (line.empty())
+		{
+			continue;
+		}
+
+		// Hash and size are separated by single spaces, rest of line is path which may contain spaces
+		size_t first = line.find(' ');
+		size_t second = (first == std::string::npos) ? std::string::npos : line.find(' ', first + 1);
+		if (second == std::string::npos)
+		{
+			return false;
+		}
+		ManifestEntry entry;
+		entry.hash = line.substr(0, first);
+		std::string size = line.substr(first + 1, second - first - 1);
+		entry.path = line.substr(second + 1);
+		if (!IsHash(entry.hash)
+			|| size.empty()
+			|| size.find_first_not_of("0123456789") != std::string::npos
+			|| !IsSafePath(entry.path))
+		{
+			return false;
+		}
+		entry.size = std::stoull(size);
+		rEntries.push_back(entry);
+	}
+	return true;
+}
+
+std::map<std::string, std::string> FindLocalContent(const std::vector<ManifestEntry>& rEntries, const std::string& rInstallPath)
+{
+	std::map<std::string, std::string> content;
+	for (const ManifestEntry& rEntry : rEntries)
+	{
+		if (content.find(rEntry.hash) != content.end())
+		{
+			continue; // other file has same content
+		}
+		std::string localPath = rInstallPath + "/" + rEntry.path;
+		std::error_code error;
+		uintmax_t size = std::experimental::filesystem::file_size(localPath, error);
+		if (error || size != rEntry.size)
+		{
+			continue;
+		}
+		if (SHA256::OfFile(localPath) == rEntry.hash)
+		{
+			content[rEntry.hash] = localPath;
+		}
+	}
+	return content;
+}
@@ -0,0 +1,43 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Manifest of a release lists every file with size and SHA-256 of its content,
+// one file per line as "<hash> <size> <path>". Paths are relative to the
+// installation and use slashes. Content of files is stored on the server by its
+// hash, so files unchanged between releases are never downloaded again.
+
+#ifndef MANIFEST_H_
+#define MANIFEST_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+// Entry of manifest
+struct ManifestEntry
+{
+	std::string path;
+	uint64_t size;
+	std::string hash;
+};
+
+// Parse manifest. Returns false if a line is malformed or a path would leave the installation
+bool ParseManifest(const std::string& rContent, std::vector<ManifestEntry>& rEntries);
+
+// Look for content of entries in local installation. Only files at the same path and with the same
+// size are hashed, as others are unlikely to match. Returns local path of content by hash
+std::map<std::string, std::string> FindLocalContent(const std::vector<ManifestEntry>& rEntries, const std::string& rInstallPath);
+
+#endif // MANIFEST_H_
@@ -0,0 +1,150 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SHA256.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+	// Round constants
+	const uint32_t K[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+
+	uint32_t RotateRight(uint32_t value, int bits)
+	{
+		return (value >> bits) | (value << (32 - bits));
+	}
+}
+
+SHA256::SHA256()
+{
+	const uint32_t initialState[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+	std::memcpy(_state, initialState, sizeof(_state));
+}
+
+void SHA256::Update(const void* pData, size_t size)
+{
+	const unsigned char* pBytes = (const unsigned char*)pData;
+	_totalSize += size;
+
+	// Fill pending block first
+	while (size > 0)
+	{
+		size_t count = std::min(size, sizeof(_block) - _blockSize);
+		std::memcpy(_block + _blockSize, pBytes, count);
+		_blockSize += count;
+		pBytes += count;
+		size -= count;
+		if (_blockSize == sizeof(_block))
+		{
+			ProcessBlock(_block);
+			_blockSize = 0;
+		}
+	}
+}
+
+std::string SHA256::Finish()
+{
+	// Pad with single bit, zeros and length in bits
+	uint64_t totalBits = _totalSize * 8;
+	unsigned char padding[72] = { 0x80 };
+	size_t paddingSize = (_blockSize < 56) ? (56 - _blockSize) : (120 - _blockSize);
+	for (int i = 0; i < 8; i++)
+	{
+		padding[paddingSize + i] = (unsigned char)(totalBits >> (56 - 8 * i));
+	}
+	Update(padding, paddingSize + 8);
+
+	// Write state as hex
+	static const char digits[] = "0123456789abcdef";
+	std::string hash;
+	for (uint32_t word : _state)
+	{
+		for (int shift = 28; shift >= 0; shift -= 4)
+		{
+			hash += digits[(word >> shift) & 0xf];
+		}
+	}
+	return hash;
+}
+
+std::string SHA256::OfString(const std::string& rString)
+{
+	SHA256 hasher;
+	hasher.Update(rString.data(), rString.size());
+	return hasher.Finish();
+}
+
+std::string SHA256::OfFile(const std::string& rPath)
+{
+	std::ifstream ifs(rPath, std::ios::binary);
+	if (!ifs.is_open())
+	{
+		return "";
+	}
+	SHA256 hasher;
+	char buffer[65536];
+	while (ifs)
+	{
+		ifs.read(buffer, sizeof(buffer));
+		hasher.Update(buffer, (size_t)ifs.gcount());
+	}
+	if (ifs.bad())
+	{
+		return "";
+	}
+	return hasher.Finish();
+}
+
+void SHA256::ProcessBlock(const unsigned char* pBlock)
+{
+	// Message schedule
+	uint32_t w[64];
+	for (int i = 0; i < 16; i++)
+	{
+		w[i] = ((uint32_t)pBlock[4 * i] << 24) | ((uint32_t)pBlock[4 * i + 1] << 16) | ((uint32_t)pBlock[4 * i + 2] << 8) | (uint32_t)pBlock[4 * i + 3];
+	}
+	for (int i = 16; i < 64; i++)
+	{
+		uint32_t s0 = RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+		uint32_t s1 = RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+		w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+	}
+
+	// Compression
+	uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3], e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+	for (int i = 0; i < 64; i++)
+	{
+		uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+		uint32_t choice = (e & f) ^ (~e & g);
+		uint32_t temp1 = h + s1 + choice + K[i] + w[i];
+		uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+		uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+		uint32_t temp2 = s0 + majority;
+		h = g; g = f; f = e; e = d + temp1;
+		d = c; c = b; b = a; a = temp1 + temp2;
+	}
+	_state[0] += a; _state[1] += b; _state[2] += c; _state[3] += d;
+	_state[4] += e; _state[5] += f; _state[6] += g; _state[7] += h;
+}
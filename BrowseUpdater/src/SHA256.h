@@ -0,0 +1,55 @@
+// Copyright 2017 Raphael Menges
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// SHA-256 of byte streams and files, written as lower case hex strings.
+
+#ifndef SHA256_H_
+#define SHA256_H_
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class SHA256
+{
+public:
+
+	// Constructor
+	SHA256();
+
+	// Add bytes to hashed stream
+	void Update(const void* pData, size_t size);
+
+	// Finish hashing and return hash as hex string. Hasher must not be updated afterwards
+	std::string Finish();
+
+	// Hash of string
+	static std::string OfString(const std::string& rString);
+
+	// Hash of file content. Returns empty string if file could not be read
+	static std::string OfFile(const std::string& rPath);
+
+private:
+
+	// Process one block of 64 bytes
+	void ProcessBlock(const unsigned char* pBlock);
+
+	// Members
+	uint32_t _state[8];
+	unsigned char _block[64];
+	size_t _blockSize = 0;
+	uint64_t _totalSize = 0;
+};
+
+#endif // SHA256_H_
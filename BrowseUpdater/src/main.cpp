@@ -19,14 +19,18 @@
 #include <chrono>
 #include <thread>
 #include <filesystem>
+#include <map>
+#include <vector>
 #include "externals/curl/include/curl/curl.h"
-#include "submodules/miniz/miniz.h"
-#include "submodules/miniz/miniz_zip.h"
+#include "src/Manifest.h"
+#include "src/SHA256.h"
+#include "src/Download.h"
+#include "src/Install.h"
 
 // Constants
 const std::string serverURL = "https://userpages.uni-koblenz.de/~raphaelmenges/gtw-update";
+const std::string contentURL = serverURL + "/files"; // content of files listed in manifests, named by hash
 const std::string tmpZipName = "gtw_new_version.zip";
-const std::string tmpUnzipDirName = "gtw_new_version";
 const std::string gtwPath = std::experimental::filesystem::current_path().string() + "/Browse"; // path to GazeTheWeb-Browse folder, relative from bat file that calls the updater
 const long long exitSleepMS = 2000;
 
@@ -39,9 +43,26 @@ size_t CURLWriteString(void *contents, size_t size, size_t nmemb, void *userp)
 
 // Callback for CURL to retrieve zip file
 size_t CURLWriteFile(void *ptr, size_t size, size_t nmemb, FILE *stream) {
-	size_t written = fwrite(ptr, size, nmemb, stream);
-	std::cout << ".";
-	return written;
+	return fwrite(ptr, size, nmemb, stream);
+}
+
+// Download URL into file using given CURL handle, which keeps connection open for next download
+bool DownloadToFile(CURL* curl, const std::string& url, const std::string& path)
+{
+	FILE *fp = fopen(path.c_str(), "wb");
+	if (fp == NULL)
+	{
+		return false;
+	}
+	curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CURLWriteFile);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
+	CURLcode res = curl_easy_perform(curl);
+	long responseCode = 0;
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+	fclose(fp);
+	return res == CURLE_OK && responseCode == 200;
 }
 
 // End function
@@ -52,6 +73,141 @@ int Return(std::string message)
 	return 0;
 }
 
+// Download complete release zip and unpack it into given directory. Zip is compared with hash if not
+// empty. Returns error message or empty string
+std::string StageFromZip(const std::string& downloadLink, const std::string& zipHash, const std::string& tmpZipPath, const std::string& stagingPath)
+{
+	// ### DOWNLOAD NEW VERSION INTO TMP ###
+
+	// Interrupted download is resumed at next start of updater
+	std::string error = DownloadFile(downloadLink, tmpZipPath, zipHash);
+	if (!error.empty())
+	{
+		return error;
+	}
+	std::cout << "...download done." << std::endl;
+
+	// ### UNPACK NEW VERSION INTO STAGING ##
+
+	std::cout << "Unzipping new version..." << std::endl;
+
+	// Create folder to place unzipped content
+	if (std::experimental::filesystem::exists(stagingPath)) // check whether already exists
+	{
+		std::experimental::filesystem::remove_all(stagingPath); // remove when already existing
+	}
+	std::experimental::filesystem::create_directory(stagingPath);
+
+	// Extract files in parallel
+	error = ExtractZip(tmpZipPath, stagingPath);
+	if (!error.empty())
+	{
+		std::experimental::filesystem::remove(tmpZipPath.c_str());
+		std::experimental::filesystem::remove_all(stagingPath);
+		return error;
+	}
+	std::cout << "...unzipping done." << std::endl;
+
+	// Remove zip
+	std::cout << "Removing temporary zip file..." << std::endl;
+	std::experimental::filesystem::remove(tmpZipPath.c_str());
+
+	return "";
+}
+
+// Download content of files listed in manifest into given directory. Files whose content is already
+// installed are copied instead. Returns error message or empty string
+std::string StageFromManifest(const std::string& manifestLink, const std::string& manifestHash, const std::string& stagingPath)
+{
+	CURL* curl = curl_easy_init();
+	if (!curl)
+	{
+		return "CURL could not be instantiated.";
+	}
+
+	// Download manifest and compare it with hash from check, which is retrieved via HTTPS from our server
+	std::string manifest;
+	curl_easy_setopt(curl, CURLOPT_URL, manifestLink.c_str());
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CURLWriteString);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &manifest);
+	CURLcode res = curl_easy_perform(curl);
+	if (res != CURLE_OK)
+	{
+		curl_easy_cleanup(curl);
+		return "curl_easy_perform() failed: " + std::string(curl_easy_strerror(res));
+	}
+	std::vector<ManifestEntry> entries;
+	if (SHA256::OfString(manifest) != manifestHash || !ParseManifest(manifest, entries))
+	{
+		curl_easy_cleanup(curl);
+		return "Manifest is not valid.";
+	}
+
+	// Find content which is already installed
+	std::cout << "Comparing local files with manifest..." << std::endl;
+	std::map<std::string, std::string> localContent = FindLocalContent(entries, gtwPath);
+	uint64_t reusedBytes = 0;
+	uint64_t downloadBytes = 0;
+	for (const ManifestEntry& rEntry : entries)
+	{
+		if (localContent.find(rEntry.hash) != localContent.end())
+		{
+			reusedBytes += rEntry.size;
+		}
+		else
+		{
+			downloadBytes += rEntry.size;
+		}
+	}
+	std::cout << "Reusing " << reusedBytes << " bytes, downloading " << downloadBytes << " bytes" << std::endl;
+
+	// Create folder to place new version
+	if (std::experimental::filesystem::exists(stagingPath)) // check whether already exists
+	{
+		std::experimental::filesystem::remove_all(stagingPath); // remove when already existing
+	}
+	std::experimental::filesystem::create_directory(stagingPath);
+
+	// Assemble new version, downloads reuse connection of CURL handle
+	Progress progress(downloadBytes);
+	uint64_t downloadedBytes = 0;
+	for (const ManifestEntry& rEntry : entries)
+	{
+		std::string path = stagingPath + "/" + rEntry.path;
+		std::error_code error;
+		std::experimental::filesystem::create_directories(std::experimental::filesystem::path(path).parent_path(), error);
+		auto it = localContent.find(rEntry.hash);
+		if (it != localContent.end())
+		{
+			std::experimental::filesystem::copy_file(it->second, path, error);
+		}
+		else if (DownloadToFile(curl, contentURL + "/" + rEntry.hash, path) && SHA256::OfFile(path) == rEntry.hash)
+		{
+			localContent[rEntry.hash] = path; // later files may have same content
+			downloadedBytes += rEntry.size;
+			progress.Report(downloadedBytes);
+		}
+		else
+		{
+			error = std::make_error_code(std::errc::io_error);
+		}
+
+		if (error)
+		{
+			curl_easy_cleanup(curl);
+			std::experimental::filesystem::remove_all(stagingPath);
+			std::cout << std::endl;
+			return "File could not be retrieved: " + rEntry.path;
+		}
+	}
+	curl_easy_cleanup(curl);
+	progress.Report(downloadedBytes, true);
+	std::cout << "...download done." << std::endl;
+
+	return "";
+}
+
 // Main
 int main()
 {
@@ -62,6 +218,9 @@ int main()
 	std::cout << "By Raphael Menges" << std::endl;
 	std::cout << std::endl;
 
+	// Initialize CURL once, as download engine uses handles on several threads
+	curl_global_init(CURL_GLOBAL_ALL);
+
 	// ### CHECK FOR TEMP FOLDER ###
 	const std::string tmpPath = std::experimental::filesystem::temp_directory_path().string();
 	if (!tmpPath.empty())
@@ -73,7 +232,12 @@ int main()
 		return Return("Temporary folder not available. Exiting...");
 	}
 	const std::string tmpZipPath = tmpPath + tmpZipName;
-	const std::string tmpUnzipPath = tmpPath + tmpUnzipDirName;
+
+	// ### RECOVER INTERRUPTED UPDATE ###
+
+	// New version is staged next to installation, so switching versions is a rename on the same volume
+	const std::string stagingPath = StagingPath(gtwPath);
+	RecoverInstall(gtwPath);
 
 	// ### CHECK LOCAL VERSION ###
 
@@ -99,6 +263,9 @@ int main()
 	CURL *curl; // CURL handle
 	std::string readBuffer; // buffer
 	std::string downloadLink = "";
+	std::string zipHash = "";
+	std::string manifestLink = "";
+	std::string manifestHash = "";
 
 	// Initialize CURL
 	curl = curl_easy_init();
@@ -122,15 +289,29 @@ int main()
 			return Return("curl_easy_perform() failed: " + std::string(curl_easy_strerror(res)) + " Exiting...");
 		}
 
-		// Extract URL to zip to download
+		// Extract URL and, if available, hash of zip to download and URL and hash of manifest
 		std::stringstream ss(readBuffer);
 		std::string token;
 		int i = 0;
 		while (std::getline(ss, token, '\n'))
 		{
-			if (i == 1 && !token.empty()) // second line and only when not empty
+			if (i == 1 && !token.empty()) // second line and only when not empty, hash is optional and separated by space
+			{
+				size_t space = token.find(' ');
+				downloadLink = serverURL + "/" + token.substr(0, space);
+				if (space != std::string::npos)
+				{
+					zipHash = token.substr(space + 1);
+				}
+			}
+			else if (i == 2 && !token.empty()) // third line is manifest name and hash, separated by space
 			{
-				downloadLink = serverURL + "/" + token;
+				size_t space = token.find(' ');
+				if (space != std::string::npos)
+				{
+					manifestLink = serverURL + "/" + token.substr(0, space);
+					manifestHash = token.substr(space + 1);
+				}
 				break;
 			}
 			++i;
@@ -145,127 +326,45 @@ int main()
 	}
 
 	// Only continue if download link it not empty
-	if (downloadLink.empty())
+	if (downloadLink.empty() && manifestLink.empty())
 	{
 		return Return("No new version available for download. Exiting...");
 	}
-	else
-	{
-		std::cout << "Downloading new version: " << downloadLink;
-	}
-
-	// ### DOWNLOAD NEW VERSION INTO TMP ###
-	curl = curl_easy_init();
-	if (curl)
-	{
-		FILE *fp;
-		fp = fopen(tmpZipPath.c_str(), "wb");
-		if (fp != NULL) // Only continue if file is opened
-		{
-			// 
-			curl_easy_setopt(curl, CURLOPT_URL, downloadLink.c_str());
-			curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CURLWriteFile);
-			curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
-			CURLcode res = curl_easy_perform(curl);
 
-			// Cleanup CURL and close file
-			curl_easy_cleanup(curl);
-			fclose(fp);
+	// ### RETRIEVE NEW VERSION INTO TMP ###
 
-			// Check for errors
-			if (res != CURLE_OK)
-			{
-				return Return("curl_easy_perform() failed: " + std::string(curl_easy_strerror(res)) + " Exiting...");
-			}
-		}
-		else
+	// Prefer manifest, which only downloads changed files
+	std::string error = "";
+	if (!manifestLink.empty())
+	{
+		std::cout << "Updating new version by manifest: " << manifestLink << std::endl;
+		error = StageFromManifest(manifestLink, manifestHash, stagingPath);
+		if (!error.empty() && !downloadLink.empty())
 		{
-			return Return("Target path for zip download could be opened. Exiting...");
+			std::cout << error << " Downloading complete version instead..." << std::endl;
 		}
-		std::cout << "...download done." << std::endl;
 	}
-	else
+	if ((manifestLink.empty() || !error.empty()) && !downloadLink.empty())
 	{
-		return Return("CURL could not be instantiated. Exiting...");
+		std::cout << "Downloading new version: " << downloadLink << std::endl;
+		error = StageFromZip(downloadLink, zipHash, tmpZipPath, stagingPath);
 	}
-
-	// ### UNPACK NEW VERSION INTO TMP ##
-
-	std::cout << "Unzipping new version";
-
-	// Try to open archive
-	mz_zip_archive zip_archive;
-	memset(&zip_archive, 0, sizeof(zip_archive));
-	auto status = mz_zip_reader_init_file(&zip_archive, tmpZipPath.c_str(), 0);
-
-	// Check for success
-	if (!status)
+	if (!error.empty())
 	{
-		std::experimental::filesystem::remove(tmpZipPath.c_str());
-		std::cout << std::endl;
-		return Return("Temporary zip file could not be read. Exiting...");
+		return Return(error + " Exiting...");
 	}
 
-	// Create folder to place unzipped content
-	if (std::experimental::filesystem::exists(tmpUnzipPath)) // check whether already exists
-	{
-		std::experimental::filesystem::remove_all(tmpUnzipPath); // remove when already existing
-		
-	}
-	std::experimental::filesystem::create_directory(tmpUnzipPath);
+	// ### REPLACE OLD VERSION ###
 
-	// Go over content of zip file
-	for (int i = 0; i < (int)mz_zip_reader_get_num_files(&zip_archive); ++i)
+	// Switch directories, old version is kept if new one cannot be moved in
+	std::cout << "Switching to new version..." << std::endl;
+	error = SwapInstall(gtwPath);
+	if (!error.empty())
 	{
-		// Read file stat
-		mz_zip_archive_file_stat file_stat;
-		if (!mz_zip_reader_file_stat(&zip_archive, i, &file_stat))
-		{
-			mz_zip_reader_end(&zip_archive);
-			std::experimental::filesystem::remove(tmpZipPath.c_str());
-			std::experimental::filesystem::remove(tmpUnzipPath.c_str());
-			std::cout << std::endl;
-			return Return("Temporary zip file could not be read. Exiting...");
-		}
-		bool isDirectory = mz_zip_reader_is_file_a_directory(&zip_archive, i);
-
-		// Store file or create folder
-		std::string path = tmpUnzipPath + "/" + file_stat.m_filename;
-		if (isDirectory) // directory
-		{
-			if (!std::experimental::filesystem::exists(path)) // check whether already exists
-			{
-				std::experimental::filesystem::create_directory(path); // create the directory if not existing
-			}
-		}
-		else // file
-		{
-			mz_zip_reader_extract_to_file(&zip_archive, i, path.c_str(), 0); // unzip it
-		}
-
-		// Show progress
-		std::cout << ".";
+		std::experimental::filesystem::remove_all(stagingPath);
+		return Return(error + " Old version is kept. Exiting...");
 	}
 
-	// Close the archive, freeing any resources it was using
-	mz_zip_reader_end(&zip_archive);
-
-	std::cout << "...unzipping done." << std::endl;
-
-	// Remove zip
-	std::cout << "Removing temporary zip file..." << std::endl;
-	std::experimental::filesystem::remove(tmpZipPath.c_str());
-
-	// ### REPLACE OLD VERSION ###
-
-	// Remove complete folder recursively
-	std::cout << "Removing old version..." << std::endl;
-	std::experimental::filesystem::remove_all(gtwPath.c_str());
-
-	// Move new version to given path (move, not copy)
-	std::cout << "Moving new version to directory..." << std::endl;
-	std::experimental::filesystem::rename(tmpUnzipPath.c_str(), gtwPath.c_str());
-
 	// ### RETURN ###
 
 	// Return from main
@@ -5,184 +5,424 @@
 #include <string>
 #include <sstream>
 #include <set>
+#include <queue>
+#include <limits>
+#include <algorithm>
 
 #include <fstream>
 #include <iostream>
 
 using namespace std;
 
+namespace
+{
+    const int NO_RANK = numeric_limits<int>::max();
+    const int USER_WORD_RANK = 0; // words added by user come first
+    const size_t USER_DICT_COMPACT_SLACK = 64; // superfluous lines in user dictionary before it is rewritten
+    const size_t BIGRAM_COMPACT_SLACK = 256; // lines of learned pairs before bigram file is rewritten with sums
+    const size_t BIGRAM_FOLLOWER_COUNT = 64; // most frequent followers kept in memory per word
+
+    // Sort followers by count, most frequent first
+    bool moreFrequent(const pair<string, int> &a, const pair<string, int> &b) {
+        return a.second > b.second;
+    }
+
+    // Lower case of ASCII letters, other bytes are kept
+    string lowerCase(string word) {
+        for (size_t i = 0; i < word.length(); i++) {
+            if (word[i] >= 'A' && word[i] <= 'Z')
+                word[i] = word[i] - 'A' + 'a';
+        }
+        return word;
+    }
+}
+
 /**
 * Constructor of the Tree Class
 * Keyboard uses it for the Wordcomplition
-* @param[in] first Node must be empty
+* Creates empty root node
 */
-Trie::Trie(const string &val = "") {
-    value = val;
-    flag = false;
+Trie::Trie() {
+    Node root;
+    root.c = 0;
+    root.firstChild = -1;
+    root.nextSibling = -1;
+    root.rank = NO_RANK;
+    root.best = NO_RANK;
+    nodes.push_back(root);
 }
 
 /**
 * Function of the Tree Class
-* searches after a word in the Trie-Tree
-* @param[in] word variable used for the search
+* Returns index of child node of node with char, or -1
+* @param[in] node index of parent
+* @param[in] c char of child
 */
-string Trie::find(const string &word) {
-    Trie * node = this;
-    for (size_t i = 0; i < word.length(); i++) {
-        const char c = word[i];
-        if (node->children.find(c) == node->children.end())
-            return "";
-        else
-            node = &node->children[c];
+int Trie::child(int node, char c) {
+    for (int i = nodes[node].firstChild; i >= 0 && nodes[i].c <= c; i = nodes[i].nextSibling) {
+        if (nodes[i].c == c)
+            return i;
     }
-    return node->value;
+    return -1;
 }
 
-//------------------------------------------------------------------
 /**
 * Function of the Tree Class
-* Adds Word to the Trie-Tree
-* @param[in] word variable used for the insert
+* Returns index of node reached by word, or -1
+* @param[in] word variable used for the search
 */
-void Trie::insert(const string &word) {
-    Trie * node = this;
-    for (size_t i = 0; i < word.length(); i++) {
-        const char c = word[i];
-        if (node->children.find(c) == node->children.end())
-            node->add(c);
-        node = &node->children[c];
+int Trie::findNode(const string &word) {
+    int node = 0;
+    for (size_t i = 0; i < word.length() && node >= 0; i++) {
+        node = child(node, word[i]);
     }
-    node->flag = true;
+    return node;
 }
 
 /**
 * Function of the Tree Class
-* Adds Char to the Trie-Tree
-* used by the insert function
-* @param[in] Char variable used for the insert
+* searches after a word in the Trie-Tree
+* @param[in] word variable used for the search
 */
-void Trie::add(char c) {
-    if (value == "")
-        children[c] = Trie(string(1, c));
-    else
-        children[c] = Trie(value + c);
+bool Trie::contains(const string &word) {
+    int node = findNode(word);
+    return node >= 0 && nodes[node].rank != NO_RANK;
 }
+
 //------------------------------------------------------------------
+/**
+* Function of the Tree Class
+* Adds Word to the Trie-Tree. A word already contained keeps the lower rank
+* @param[in] word variable used for the insert
+* @param[in] rank of the word, lower ranks are completed first
+*/
+void Trie::insert(const string &word, int rank) {
+    int node = 0;
+    nodes[0].best = min(nodes[0].best, rank);
+    for (size_t i = 0; i < word.length(); i++) {
+        const char c = word[i];
+        int next = child(node, c);
+        if (next < 0) {
+            // Insert new node into sorted siblings
+            Node added;
+            added.c = c;
+            added.firstChild = -1;
+            added.rank = NO_RANK;
+            added.best = NO_RANK;
+            next = (int)nodes.size();
+            int previous = -1;
+            int sibling = nodes[node].firstChild;
+            while (sibling >= 0 && nodes[sibling].c < c) {
+                previous = sibling;
+                sibling = nodes[sibling].nextSibling;
+            }
+            added.nextSibling = sibling;
+            nodes.push_back(added);
+            if (previous < 0)
+                nodes[node].firstChild = next;
+            else
+                nodes[previous].nextSibling = next;
+        }
+        node = next;
+        nodes[node].best = min(nodes[node].best, rank);
+    }
+    nodes[node].rank = min(nodes[node].rank, rank);
+}
 
 /**
 * Function of the Tree Class
-* searches all Prefixes
+* Removes Word from the Trie-Tree. Its nodes stay in place but are skipped by autocomplete
+* @param[in] word variable used for the removal
+* @param[out] bool whether the word was contained
 */
-vector<string> Trie::all_prefixes() {
-    vector<string> results;
-    if (flag)
-        results.push_back(value);
-
-    if (children.size()) {
-        map<char, Trie>::iterator iter;
-        vector<string>::iterator node;
-        for (iter = children.begin(); iter != children.end(); iter++) {
-            vector<string> nodes = iter->second.all_prefixes();
-            results.insert(results.end(), nodes.begin(), nodes.end());
+bool Trie::remove(const string &word) {
+    vector<int> path(1, 0);
+    for (size_t i = 0; i < word.length(); i++) {
+        int next = child(path.back(), word[i]);
+        if (next < 0)
+            return false;
+        path.push_back(next);
+    }
+    if (nodes[path.back()].rank == NO_RANK)
+        return false;
+    nodes[path.back()].rank = NO_RANK;
+
+    // Recompute best ranks bottom up
+    for (size_t i = path.size(); i-- > 0;) {
+        Node &node = nodes[path[i]];
+        node.best = node.rank;
+        for (int c = node.firstChild; c >= 0; c = nodes[c].nextSibling) {
+            node.best = min(node.best, nodes[c].best);
         }
     }
-    return results;
+    return true;
 }
+//------------------------------------------------------------------
 
 /**
 * Function of the Tree Class
 * Seaches Trie-Tree for words on hand of the prefix
+* Words are visited in order of their rank, so only the returned ones are touched
 * @param[in] prefix variable used for the Search
+* @param[in] count maximal count of returned words
 */
-vector<string> Trie::autocomplete(const string &prefix) {
-    Trie * node = this;
+vector<string> Trie::autocomplete(const string &prefix, size_t count) {
     vector<string> results;
-    for (size_t i = 0; i < prefix.length(); i++) {
-        const char c = prefix[i];
-        if (node->children.find(c) == node->children.end())
-            return results;
-        else
-            node = &node->children[c];
+    int start = findNode(prefix);
+    if (start < 0 || nodes[start].best == NO_RANK)
+        return results;
+
+    // Entries are either words or subtrees, ordered by rank. Words come before subtrees of same rank
+    struct Entry {
+        int rank;
+        bool subtree;
+        int node;
+        string word;
+        bool operator<(const Entry &other) const {
+            if (rank != other.rank)
+                return rank > other.rank;
+            return subtree && !other.subtree;
+        }
+    };
+    priority_queue<Entry> queue;
+    queue.push(Entry{ nodes[start].best, true, start, prefix });
+    while (!queue.empty() && results.size() < count) {
+        Entry entry = queue.top();
+        queue.pop();
+        if (!entry.subtree) {
+            results.push_back(entry.word);
+            continue;
+        }
+        const Node &node = nodes[entry.node];
+        if (node.rank != NO_RANK)
+            queue.push(Entry{ node.rank, false, entry.node, entry.word });
+        for (int c = node.firstChild; c >= 0; c = nodes[c].nextSibling) {
+            if (nodes[c].best != NO_RANK)
+                queue.push(Entry{ nodes[c].best, true, c, entry.word + nodes[c].c });
+        }
     }
-    return node->all_prefixes();
+    return results;
 }
 
-
-/*
-TODO
---Save Trie-Tree to file (if possible)
---load Trie-Tree from file (if possible)
-*/
-
 /**
 * Function of the Tree Class
-* Load Dictionary from File
+* Load Dictionary from File, then replays words added and deleted by user
 * @param[in] dict variable is the Dictionary-Path
 */
 void Trie::loadDict(std::string dict) {
-    Trie * trie = this;
-
     std::ifstream inf;
     std::string word;
 
     std::cout << "Keyboard: Opening Dictionary: " << dict << std::endl;
-    //inf.open("dict.txt");
     inf.open(dict);
 
     if (!inf.is_open() || inf.fail())
         cout << "Error opening Dictionary file - quit\n";
+    int rank = USER_WORD_RANK + 1;
     while (getline(inf, word)) {
-        trie->insert(word);
+        if (!word.empty())
+            insert(word, rank++);
         if (inf.bad())
             perror("error while reading file");
     }
-    inf.clear(); // clear eof and fail bits
-    inf.seekg(0, ios::beg);
     inf.close();
+
+    loadBigrams(dict + ".bigrams");
+
+    // User dictionary has one word per line, prefixed with '+' if added and '-' if deleted
+    userDict = dict + ".user";
+    std::ifstream user(userDict);
+    map<string, char> changes; // last change of each word
+    size_t lines = 0;
+    while (getline(user, word)) {
+        if (word.empty())
+            continue;
+        lines++;
+        if (word.length() < 2)
+            continue; // sign without word would mark root as word, line is dropped at next rewrite
+        string userWord = word.substr(1);
+        if (word[0] == '+')
+            insert(userWord, USER_WORD_RANK);
+        else
+            remove(userWord);
+        changes[userWord] = word[0];
+    }
+    user.close();
+
+    // Rewrite user dictionary with last changes only, once it has grown too much
+    if (lines > changes.size() + USER_DICT_COMPACT_SLACK) {
+        std::string temporary = userDict + ".tmp";
+        {
+            std::ofstream out(temporary);
+            for (map<string, char>::iterator iter = changes.begin(); iter != changes.end(); iter++) {
+                out << iter->second << iter->first << "\n";
+            }
+        }
+        std::remove(userDict.c_str());
+        std::rename(temporary.c_str(), userDict.c_str());
+    }
 }
 
 /**
 * Function of the Tree Class
-* Load Dictionary from File
-* @param[in] dict variable is the Dictionary-Path
-* @param[in] line variable is the String added to the Dictionary
+* Appends change to user dictionary, so it survives restarts
+* @param[in] change '+' if word was added and '-' if deleted
+* @param[in] word variable is the changed word
 */
-void Trie::addLinetoDict(std::string dict, std::string line) {
-    std::ofstream out(dict, std::ios::app);
-    out << line + "\n";
+void Trie::appendUserWord(char change, const string &word) {
+    if (userDict.empty())
+        return;
+    std::ofstream out(userDict, std::ios::app);
+    out << change << word << "\n";
 }
 
 /**
 * Function of the Tree Class
-* Load Dictionary from File
-* @param[in] dict variable is the Dictionary-Path
-* @param[in] line variable is the String which should be deleted in the Dictionary
+* Adds word of user, which is completed before words of the dictionary
+* @param[in] word variable is the String added to the Dictionary
 */
-void Trie::deleteLineinDict(std::string dict, std::string line) {
+void Trie::addUserWord(std::string word) {
+    if (word.empty() || word.find('\n') != string::npos)
+        return;
+    insert(word, USER_WORD_RANK);
+    appendUserWord('+', word);
+}
 
-    ifstream dictionary(dict);
-    ofstream temp("temp.txt"); // temp file for input of every student except the one user wants to delete
-    std::string word;
+/**
+* Function of the Tree Class
+* Deletes word from Dictionary, if contained
+* @param[in] word variable is the String which should be deleted in the Dictionary
+*/
+void Trie::deleteUserWord(std::string word) {
+    if (remove(word)) {
+        appendUserWord('-', word);
+        std::cout << "Word == " + word + " == was deleted" << std::endl;
+    }
+}
 
-    while (getline(dictionary, word)) {
+/**
+* Function of the Tree Class
+* Adds count to pair of words, keeping followers sorted by count
+* @param[in] previous word typed before
+* @param[in] word word typed after previous
+* @param[in] count how often word followed previous
+*/
+void Trie::countBigram(const string &previous, const string &word, int count) {
+    vector<pair<string, int> > &list = followers[lowerCase(previous)];
+    size_t i = 0;
+    while (i < list.size() && list[i].first != word)
+        i++;
+    if (i == list.size())
+        list.push_back(make_pair(word, 0));
+    list[i].second += count;
 
-        if (word != line) {
-            temp << word + "\n";
-        }
-        else {
-            std::cout << "Word == " + word + " == was deleted" << std::endl;
-        }
+    // Move up while more frequent than predecessor
+    for (; i > 0 && list[i].second > list[i - 1].second; i--) {
+        swap(list[i], list[i - 1]);
+    }
+
+    // Keep most frequent followers only, dropped ones are still summed up in file
+    if (list.size() > BIGRAM_FOLLOWER_COUNT)
+        list.resize(BIGRAM_FOLLOWER_COUNT);
+}
 
+/**
+* Function of the Tree Class
+* Load counts of word pairs. Each line is "<previous> <word> <count>", file may be missing
+* Lines of same pair are summed up, so learned pairs can simply be appended
+* @param[in] file variable is the path of the bigram file
+*/
+void Trie::loadBigrams(const string &file) {
+    bigramFile = file;
+    std::ifstream in(file);
+    string line;
+    map<string, map<string, int> > counts;
+    size_t lines = 0;
+    size_t pairs = 0;
+    while (getline(in, line)) {
+        istringstream stream(line);
+        string previous, word;
+        int count = 0;
+        if (stream >> previous >> word >> count && count > 0) {
+            int &sum = counts[lowerCase(previous)][word];
+            if (sum == 0)
+                pairs++;
+            sum += count;
+            lines++;
+        }
     }
+    in.close();
 
-    dictionary.clear(); // clear eof and fail bits
-    dictionary.seekg(0, ios::beg);
-    dictionary.close();
-    temp.close();
+    // Keep most frequent followers of each word
+    followers.clear();
+    for (map<string, map<string, int> >::iterator iter = counts.begin(); iter != counts.end(); iter++) {
+        vector<pair<string, int> > &list = followers[iter->first];
+        list.assign(iter->second.begin(), iter->second.end());
+        stable_sort(list.begin(), list.end(), moreFrequent);
+        if (list.size() > BIGRAM_FOLLOWER_COUNT)
+            list.resize(BIGRAM_FOLLOWER_COUNT);
+    }
 
+    // Rewrite file with sums once learned pairs have added too many lines
+    if (lines > pairs + BIGRAM_COMPACT_SLACK) {
+        std::string temporary = file + ".tmp";
+        {
+            std::ofstream out(temporary);
+            for (map<string, map<string, int> >::iterator iter = counts.begin(); iter != counts.end(); iter++) {
+                for (map<string, int>::iterator follower = iter->second.begin(); follower != iter->second.end(); follower++) {
+                    out << iter->first << " " << follower->first << " " << follower->second << "\n";
+                }
+            }
+        }
+        std::remove(file.c_str());
+        std::rename(temporary.c_str(), file.c_str());
+    }
+}
 
-    const char * c = dict.c_str();
+/**
+* Function of the Tree Class
+* Predicts words starting with prefix after previous word. Words which followed previous
+* come first by their count, then completions of prefix by rank. Empty prefix predicts next word
+* @param[in] previous word before the one being typed, may be empty
+* @param[in] prefix already typed part of word
+* @param[in] count maximal count of returned words
+*/
+vector<string> Trie::predict(const string &previous, const string &prefix, size_t count) {
+    vector<string> results;
+    set<string> contained;
+    map<string, vector<pair<string, int> > >::iterator iter = previous.empty() ? followers.end() : followers.find(lowerCase(previous));
+    if (iter != followers.end()) {
+        for (size_t i = 0; i < iter->second.size() && results.size() < count; i++) {
+            const string &word = iter->second[i].first;
+            if (word.compare(0, prefix.length(), prefix) == 0 && contains(word)) { // deleted words are not offered
+                results.push_back(word);
+                contained.insert(word);
+            }
+        }
+    }
+    if (results.size() < count) {
+        vector<string> completions = autocomplete(prefix, count);
+        for (size_t i = 0; i < completions.size() && results.size() < count; i++) {
+            if (contained.find(completions[i]) == contained.end())
+                results.push_back(completions[i]);
+        }
+    }
+    return results;
+}
 
-    remove(c);
-    rename("temp.txt", c);
+/**
+* Function of the Tree Class
+* Learns that word was typed after previous word, so it is predicted earlier next time.
+* Only words known to the dictionary are learned, which keeps typos and punctuation out
+* @param[in] previous word typed before
+* @param[in] word word just finished
+*/
+void Trie::learn(const string &previous, const string &word) {
+    if (!contains(word) || !(contains(previous) || contains(lowerCase(previous))))
+        return;
+    countBigram(previous, word, 1);
+    if (!bigramFile.empty()) {
+        std::ofstream out(bigramFile, std::ios::app);
+        out << lowerCase(previous) << " " << word << " 1\n";
+    }
 }
@@ -4,6 +4,9 @@
 * Author : Vivek Narayanan
 
 Modified for "GazeTheWeb - Tweet" application (01/01/2016)
+Nodes are kept in one array with first child and next sibling indices. Every word has a rank,
+lower ranks are completed first. Dictionaries list words by frequency, so their line is the rank.
+Words following another word are counted, so the previous word ranks predictions before completions.
 */
 
 #include <map>
@@ -16,17 +19,35 @@ using namespace std;
 
 class Trie {
 public:
-    map<char, Trie> children;
-    string value;
-    bool flag;
-
-    Trie(const string &);
-    void add(char);
-    string find(const string &);
-    void insert(const string &);
-    vector<string> all_prefixes();
-    vector<string> autocomplete(const string &);
+    Trie();
+    bool contains(const string &);
+    void insert(const string &, int);
+    bool remove(const string &);
+    vector<string> autocomplete(const string &, size_t);
     void loadDict(std::string);
-    void addLinetoDict(std::string, std::string);
-    void deleteLineinDict(std::string, std::string);
+    void addUserWord(std::string);
+    void deleteUserWord(std::string);
+    vector<string> predict(const string &, const string &, size_t);
+    void learn(const string &, const string &);
+
+private:
+    struct Node {
+        char c;
+        int firstChild; // -1 if none
+        int nextSibling; // -1 if none, siblings are sorted by char
+        int rank; // NO_RANK if no word ends here
+        int best; // lowest rank in subtree
+    };
+    int findNode(const string &);
+    int child(int, char);
+    void appendUserWord(char, const string &);
+    void loadBigrams(const string &);
+    void countBigram(const string &, const string &, int);
+
+    vector<Node> nodes; // first node is root
+    std::string userDict; // file of words added and deleted by user, replayed after dictionary
+
+    // Words following a word with their count, most frequent first. Key is lower case
+    map<string, vector<pair<string, int> > > followers;
+    std::string bigramFile; // counted offline in corpus, pairs typed by user are appended
 };
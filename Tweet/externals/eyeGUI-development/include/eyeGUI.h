@@ -67,6 +67,16 @@ namespace eyegui
 	//! Enumeration of available description visibility behaviors.
 	enum class DescriptionVisibility { HIDDEN, ON_PENETRATION, VISIBLE };
 
+    //! Enumeration of style attributes holding a color.
+    enum class StyleColor
+    {
+        COLOR, BACKGROUND_COLOR, HIGHLIGHT_COLOR, SEPARATOR_COLOR, SELECTION_COLOR, ICON_COLOR,
+        FONT_COLOR, DIM_COLOR, MARK_COLOR, PICK_COLOR, THRESHOLD_COLOR
+    };
+
+    //! Enumeration of style attributes holding a single value.
+    enum class StyleValue { DIM_ALPHA };
+
     //! Abstract listener class for buttons.
     class ButtonListener
     {
@@ -220,6 +230,8 @@ namespace eyegui
         float fontSmallSize = 0.0175f; //!< Height of small font in percentage of GUI height
         FontSize descriptionFontSize = FontSize::SMALL; //!< Font size of icon element descriptions
         bool resizeInvisibleLayouts = true; //!< Resize invisible layouts. Has advantage that one can ask for the size of elements all time
+        std::string graphicsCacheDirectory = ""; //!< Existing directory to keep rasterized vector graphics between runs. Empty disables the cache
+        std::string layoutCacheDirectory = ""; //!< Existing directory to keep compiled layouts and bricks between runs. Empty disables the cache
     };
 
     //! Creates layout inside GUI and returns pointer to it. Is executed at update call.
@@ -311,11 +323,20 @@ namespace eyegui
     //! Add dictionary which can be used for text suggestions.
     /*!
       \param pGUI pointer to GUI.
-      \param filepath is path to dictionary file with words to add.
+      \param filepath is path to dictionary file with words to add or to
+             compiled dictionary with extension .deyegui.
       \return Handle to access dictionary via interface.
     */
     unsigned int addDictionary(GUI* pGUI, std::string filepath);
 
+    //! Compile list of words into dictionary file which is loaded faster.
+    /*!
+      \param wordListFilepath is path to file with words, one per line.
+      \param dictionaryFilepath is path to output file with extension .deyegui.
+      \return true if successful.
+    */
+    bool compileDictionary(std::string wordListFilepath, std::string dictionaryFilepath);
+
     //! Sets value of config attribute. Is executed at update call.
     /*!
       \param pLayout pointer to layout.
@@ -519,6 +540,38 @@ namespace eyegui
         std::string attribute,
         std::string value);
 
+    //! Sets color of style attribute without parsing a string.
+    /*!
+      \param pLayout pointer to layout.
+      \param styleName is name of style in used stylesheet.
+      \param attribute is color attribute which shall be changed.
+      \param red is red component of color in range of [0..1].
+      \param green is green component of color in range of [0..1].
+      \param blue is blue component of color in range of [0..1].
+      \param alpha is alpha component of color in range of [0..1].
+    */
+    void setValueOfStyleAttribute(
+        Layout* pLayout,
+        std::string styleName,
+        StyleColor attribute,
+        float red,
+        float green,
+        float blue,
+        float alpha);
+
+    //! Sets value of style attribute without parsing a string.
+    /*!
+      \param pLayout pointer to layout.
+      \param styleName is name of style in used stylesheet.
+      \param attribute is value attribute which shall be changed.
+      \param value is new value.
+    */
+    void setValueOfStyleAttribute(
+        Layout* pLayout,
+        std::string styleName,
+        StyleValue attribute,
+        float value);
+
     //! Set icon of icon element.
     /*!
       \param pLayout pointer to layout.
@@ -551,6 +604,37 @@ namespace eyegui
         unsigned char const * pIconData,
 		bool flipY = false);
 
+    //! Set image in picture from file.
+    /*!
+      Picture is changed in place instead of being replaced, so its state is kept.
+      \param pLayout pointer to layout.
+      \param id is the unique id of a picture.
+      \param filepath is the path to the image used in the picture element.
+      \param alignment is the alignment of the picture.
+    */
+    void setImageOfPicture(
+        Layout* pLayout,
+        std::string id,
+        std::string filepath,
+        ImageAlignment alignment);
+
+    //! Set appearance of block.
+    /*!
+      Block is changed in place instead of being replaced, so its state is kept.
+      \param pLayout pointer to layout.
+      \param id is the unique id of a block.
+      \param consumeInput indicates, whether block consumes given input.
+      \param backgroundFilepath is path to image rendered in background.
+             Use empty string to indicate no background image.
+      \param backgroundAlignment indicates alignment of background image.
+    */
+    void setAppearanceOfBlock(
+        Layout* pLayout,
+        std::string id,
+        bool consumeInput,
+        std::string backgroundFilepath = "",
+        ImageAlignment backgroundAlignment = ImageAlignment::ZOOMED);
+
     //! Set image in picture.
     /*!
       \param pLayout pointer to layout.
@@ -829,6 +913,7 @@ namespace eyegui
              Use empty string to indicate no background image.
       \param backgroundAlignment indicates alignment of background image.
       \param fade indicates, whether replaced element should fade.
+             Without fading, a block is changed in place like setAppearanceOfBlock does.
     */
     void replaceElementWithBlock(
         Layout* pLayout,
@@ -845,6 +930,7 @@ namespace eyegui
       \param filepath is the path to the image used in the picture element.
       \param alignment is the alignment of the picture.
       \param fade indicates, whether replaced element should fade.
+             Without fading, a picture is changed in place like setImageOfPicture does.
     */
     void replaceElementWithPicture(
         Layout* pLayout,
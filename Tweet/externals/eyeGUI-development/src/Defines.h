@@ -32,10 +32,16 @@ namespace eyegui
     static const std::string CONFIG_EXTENSION = "ceyegui";
     static const std::string STYLESHEET_EXTENSION = "seyegui";
     static const std::string LOCALIZATION_EXTENSION = "leyegui";
+    static const std::string DICTIONARY_EXTENSION = "deyegui"; // compiled dictionary
+    static const std::string GRAPHICS_CACHE_EXTENSION = "reyegui"; // rasterized vector graphics
+    static const std::string MARKUP_CACHE_EXTENSION = "meyegui"; // compiled layouts and bricks
     static const int NOTIFICATION_MAX_LOOP_COUNT = 10;
     static const float ACCUMULATED_TIME_PERIOD = 1800.0f;
     static const float FONT_CHARACTER_PADDING = 0.07f; // percentage of height
     static const int FONT_MINIMAL_CHARACTER_PADDING = 2;
+    static const int FONT_ATLAS_PAGE_RESOLUTION = 1024; // clamped to maximal texture size of GPU
+    static const int FONT_ATLAS_MAX_PAGE_COUNT = 4; // pages per pixel size, least recently used one is cleared when all are full
+    static const int FONT_ATLAS_CACHED_SIZE_COUNT = 8; // pixel sizes whose glyphs are kept, e.g. to go back to previous window size
     static const float RESIZE_WAIT_DURATION = 0.3f;
     static const glm::vec4 RESIZE_BLEND_COLOR = glm::vec4(0.75f, 0.75f, 0.75f, 0.75f);
     static const std::u16string LOCALIZATION_NOT_FOUND = u"";
@@ -53,6 +59,9 @@ namespace eyegui
     static const uint DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH = 3; // "Al" -> "Aal". Important for fast typing because no repeating letters in input
     static const uint DICTIONARY_INPUT_PAUSE_DEPTH = 0; // "Hus" -> "Haus"
     static const uint DICTIONARY_INPUT_IGNORE_DEPTH = 1; // "Huus" -> "Haus"
+    static const uint DICTIONARY_SEARCH_MAX_EXPANSIONS = 20000; // expanded states of fuzzy search per input
+    static const uint DICTIONARY_SEARCH_FRONTIER_SIZE = 8192; // states waiting for expansion per cost
+    static const uint DICTIONARY_SEARCH_MAX_STATES = 262144; // created states after which search is started again instead of continued
     static const uint WORD_SUGGEST_MAX_SUGGESTIONS = 10;
     static const float WORD_SUGGEST_SCROLL_SPEED = 1.5f;
     static const float WORD_SUGGEST_THRESHOLD_SPEED = 0.75f;
@@ -60,6 +69,12 @@ namespace eyegui
     static const float WORD_SUGGEST_CHOSEN_ANIMATION_OFFSET = 0.03f; // in relation to height of layout
     static const float WORD_SUGGEST_SUGGESTION_DISTANCE = 4; // in size of letter which represents space
 	static const float TEXT_BACKGROUND_SIZE = 1.1f;
+	static const size_t TEXT_WORD_CACHE_MAX_SIZE = 2048; // measured words kept per text
+    static const uint TEXTURE_LOADER_MAX_WORKERS = 4;
+    static const uint TEXTURE_UPLOAD_BUDGET = 4 * 1024 * 1024; // bytes uploaded per frame, at least one texture
+    static const uint UNREFERENCED_TEXTURES_MAX_SIZE = 64 * 1024 * 1024; // bytes of unused textures kept for reuse
+    static const uint RENDER_QUEUE_LOOK_BACK = 16; // count of batches a record may be moved back over
+    static const float CONTAINER_VIEWPORT_MARGIN = 0.5f; // children this far outside viewport are still updated, relative to viewport size
 	static const float GRID_FILL_EPSILON = 0.01f;  // since floating point precision does not sum everything to 100%
 }
 
@@ -52,6 +52,11 @@ namespace eyegui
         // Nothing to do
     }
 
+    bool Blank::hasContentToDraw() const
+    {
+        return false;
+    }
+
     void Blank::specialTransformAndSize()
     {
         // Nothing to do
@@ -43,6 +43,9 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Nothing is drawn
+        virtual bool hasContentToDraw() const;
+
         // Transformation filled by subclasses
         virtual void specialTransformAndSize();
 
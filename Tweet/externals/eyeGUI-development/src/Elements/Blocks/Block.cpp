@@ -44,11 +44,6 @@ namespace eyegui
         mConsumeInput = consumeInput;
         mInnerBorder = innerBorder;
 
-        // Fetch render item
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
         // Fetch background image if one is wanted
         if(backgroundFilepath != EMPTY_STRING_ATTRIBUTE)
         {
@@ -61,6 +56,23 @@ namespace eyegui
         // Nothing to do so far
     }
 
+    void Block::setAppearance(bool consumeInput, std::string backgroundFilepath, ImageAlignment backgroundAlignment)
+    {
+        mConsumeInput = consumeInput;
+        if (backgroundFilepath != EMPTY_STRING_ATTRIBUTE)
+        {
+            mupImage = mpAssetManager->createImage(mpLayout, backgroundFilepath, backgroundAlignment);
+        }
+        else
+        {
+            mupImage.reset();
+        }
+
+        // Size of block does not depend on background image
+        specialTransformAndSize();
+        makeUpdateNecessary();
+    }
+
     // Updating
     float Block::specialUpdate(float tpf, Input* pInput)
     {
@@ -69,16 +81,6 @@ namespace eyegui
 
     void Block::specialDraw() const
     {
-        // Draw simple background color
-        if (getStyle()->backgroundColor.a > 0)
-        {
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", mAlpha);
-            mpBackground->draw();
-        }
-
         // Draw background image if available
         if(mupImage != NULL)
         {
@@ -86,6 +88,19 @@ namespace eyegui
         }
     }
 
+    bool Block::hasContentToDraw() const
+    {
+        return mupImage != NULL;
+    }
+
+    void Block::specialEnqueueBackground() const
+    {
+        // Simple background color
+        glm::vec4 color = getStyle()->backgroundColor;
+        color.a *= mAlpha;
+        mpAssetManager->getRenderQueue()->enqueueQuad(mX, mY, mWidth, mHeight, color);
+    }
+
     void Block::specialTransformAndSize()
     {
         // Background image placing
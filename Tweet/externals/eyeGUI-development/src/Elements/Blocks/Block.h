@@ -38,6 +38,9 @@ namespace eyegui
         // Destructor
         virtual ~Block();
 
+        // Set input consumption and background image, keeping element. Empty filepath removes background image
+        void setAppearance(bool consumeInput, std::string backgroundFilepath, ImageAlignment backgroundAlignment);
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -46,6 +49,12 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Whether there is anything to draw besides background color
+        virtual bool hasContentToDraw() const;
+
+        // Enqueue background color
+        virtual void specialEnqueueBackground() const;
+
         // Transformation filled by subclasses
         virtual void specialTransformAndSize();
 
@@ -64,7 +73,6 @@ namespace eyegui
     private:
 
         // Members
-        RenderItem const * mpBackground;
         std::unique_ptr<Image> mupImage;
         float mInnerBorder; // [0..1]
         bool mConsumeInput;
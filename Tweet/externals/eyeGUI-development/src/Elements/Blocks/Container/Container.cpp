@@ -7,6 +7,11 @@
 
 #include "Container.h"
 
+#include "src/Layout.h"
+#include "src/Rendering/ScissorStack.h"
+
+#include <algorithm>
+
 namespace eyegui
 {
     Container::Container(
@@ -44,6 +49,12 @@ namespace eyegui
     {
         // Fill members
         mShowBackground = showBackground;
+        mViewport = glm::ivec4(0, 0, 0, 0);
+        mViewportKnown = false;
+        mUpdatedChildrenBegin = 0;
+        mUpdatedChildrenEnd = 0;
+        mChildrenAlpha = 0;
+        mChildrenDim = 0;
     }
 
     Container::~Container()
@@ -144,6 +155,7 @@ namespace eyegui
             // Replace it
             std::unique_ptr<Element> upTarget = std::move(mChildren[i]);
             mChildren[i] = std::move(upReplacement);
+            mChildUpdateNecessary = true;
             return std::move(upTarget);
         }
 
@@ -151,15 +163,75 @@ namespace eyegui
         return NULL;
     }
 
+    bool Container::isAnimating() const
+    {
+        // Container can only settle when all updated children are settled
+        return !mAwakeChildren.empty() || Block::isAnimating();
+    }
+
     float Container::specialUpdate(float tpf, Input* pInput)
     {
         float maxAdaptiveScaleOfChildren = 0;
 
+        // Only children near viewport are updated, the others wait until they come close
+        uint begin = 0;
+        uint end = (uint)mChildren.size();
+        if (mViewportKnown)
+        {
+            findChildrenInViewport(mViewport, CONTAINER_VIEWPORT_MARGIN, begin, end);
+        }
+
+        // Settled children would skip their update anyway, unless gaze is upon them
+        // or something has changed for them since last update
+        bool onlyAwakeChildren =
+            !mChildUpdateNecessary
+            && !mpLayout->isFullUpdateNecessary()
+            && begin == mUpdatedChildrenBegin
+            && end == mUpdatedChildrenEnd
+            && mAlpha == mChildrenAlpha
+            && getDim() == mChildrenDim;
+        mChildUpdateNecessary = false;
+        mChildrenAlpha = mAlpha;
+        mChildrenDim = getDim();
+
+        // Children coming close may have missed changes
+        for (uint i = begin; i < end; i++)
+        {
+            if (i < mUpdatedChildrenBegin || i >= mUpdatedChildrenEnd)
+            {
+                mChildren[i]->makeUpdateNecessary();
+            }
+        }
+        mUpdatedChildrenBegin = begin;
+        mUpdatedChildrenEnd = end;
+
+        // Collect children to update, keeping their order for consumption of input
+        std::vector<uint> indices;
+        if (onlyAwakeChildren)
+        {
+            indices.swap(mAwakeChildren);
+            findChildrenUnderGaze(pInput, begin, end, indices);
+            std::sort(indices.begin(), indices.end());
+            indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+        }
+        else
+        {
+            for (uint i = begin; i < end; i++)
+            {
+                indices.push_back(i);
+            }
+        }
+        mAwakeChildren.clear();
+
         // Update the elements
-        for (std::unique_ptr<Element>& rupElement : mChildren)
+        for (uint i : indices)
         {
-            float childAdaptiveScale = rupElement->update(tpf, mAlpha, pInput, getDim());
+            float childAdaptiveScale = mChildren[i]->update(tpf, mAlpha, pInput, getDim());
             maxAdaptiveScaleOfChildren = std::max(maxAdaptiveScaleOfChildren, childAdaptiveScale);
+            if (!mChildren[i]->isSettled())
+            {
+                mAwakeChildren.push_back(i);
+            }
         }
 
         // Super call after children (may consume input first)
@@ -178,6 +250,20 @@ namespace eyegui
         }
     }
 
+    bool Container::hasContentToDraw() const
+    {
+        return mShowBackground && Block::hasContentToDraw();
+    }
+
+    void Container::specialEnqueueBackground() const
+    {
+        // Only enqueue block in background if allowed
+        if (mShowBackground)
+        {
+            Block::specialEnqueueBackground();
+        }
+    }
+
     void Container::specialReset()
     {
         Block::specialReset();
@@ -189,12 +275,136 @@ namespace eyegui
         }
     }
 
-    void Container::drawChildren() const
+    void Container::specialTranslate(int deltaX, int deltaY)
     {
-        // Draw children
+        // Place background and inner area of block
+        Block::specialTransformAndSize();
+
+        // Move children
         for (const std::unique_ptr<Element>& rupElement : mChildren)
         {
-            rupElement->draw();
+            rupElement->translate(deltaX, deltaY);
+        }
+    }
+
+    void Container::drawChildren() const
+    {
+        // Remember viewport for update, as long as children follow an axis
+        Orientation axis;
+        mViewportKnown = areChildrenInSequence(axis);
+        mViewport = ScissorStack::getCurrent();
+
+        // Draw children within viewport
+        uint begin = 0;
+        uint end = (uint)mChildren.size();
+        if (mViewportKnown)
+        {
+            findChildrenInViewport(mViewport, 0, begin, end);
+        }
+        for (uint i = begin; i < end; i++)
+        {
+            mChildren[i]->draw();
+        }
+    }
+
+    bool Container::areChildrenInSequence(Orientation& rAxis) const
+    {
+        // Standard is: children may be placed anywhere. Axis is set anyway, so callers never read garbage
+        rAxis = Orientation::VERTICAL;
+        return false;
+    }
+
+    void Container::findChildrenInViewport(glm::ivec4 viewport, float margin, uint& rBegin, uint& rEnd) const
+    {
+        Orientation axis;
+        areChildrenInSequence(axis);
+
+        // Extend viewport along axis
+        int viewportStart, viewportEnd;
+        if (axis == Orientation::HORIZONTAL)
+        {
+            int extension = (int)(margin * (float)(viewport.z - viewport.x));
+            viewportStart = viewport.x - extension;
+            viewportEnd = viewport.z + extension;
+        }
+        else
+        {
+            int extension = (int)(margin * (float)(viewport.w - viewport.y));
+            viewportStart = viewport.y - extension;
+            viewportEnd = viewport.w + extension;
+        }
+
+        // Children are ordered, so search for first one ending after start of
+        // viewport and first one starting after end of it
+        auto start = [axis](const std::unique_ptr<Element>& rupElement)
+        {
+            return axis == Orientation::HORIZONTAL ? rupElement->getX() : rupElement->getY();
+        };
+        auto size = [axis](const std::unique_ptr<Element>& rupElement)
+        {
+            return axis == Orientation::HORIZONTAL ? rupElement->getWidth() : rupElement->getHeight();
+        };
+        auto beginIt = std::partition_point(
+            mChildren.begin(),
+            mChildren.end(),
+            [&](const std::unique_ptr<Element>& rupElement) { return start(rupElement) + size(rupElement) <= viewportStart; });
+        auto endIt = std::partition_point(
+            beginIt,
+            mChildren.end(),
+            [&](const std::unique_ptr<Element>& rupElement) { return start(rupElement) < viewportEnd; });
+        rBegin = (uint)(beginIt - mChildren.begin());
+        rEnd = (uint)(endIt - mChildren.begin());
+    }
+    void Container::findChildrenUnderGaze(Input const * pInput, uint begin, uint end, std::vector<uint>& rIndices) const
+    {
+        if (pInput == NULL || pInput->gazeUsed)
+        {
+            return;
+        }
+
+        // Same test as penetration of element, borders included
+        auto underGaze = [pInput](const std::unique_ptr<Element>& rupElement)
+        {
+            return pInput->gazeX >= rupElement->getX()
+                && pInput->gazeX <= rupElement->getX() + rupElement->getWidth()
+                && pInput->gazeY >= rupElement->getY()
+                && pInput->gazeY <= rupElement->getY() + rupElement->getHeight();
+        };
+
+        // Ordered children are searched along axis, others are tested one by one
+        Orientation axis;
+        if (areChildrenInSequence(axis))
+        {
+            int gaze = axis == Orientation::HORIZONTAL ? pInput->gazeX : pInput->gazeY;
+            auto start = [axis](const std::unique_ptr<Element>& rupElement)
+            {
+                return axis == Orientation::HORIZONTAL ? rupElement->getX() : rupElement->getY();
+            };
+            auto size = [axis](const std::unique_ptr<Element>& rupElement)
+            {
+                return axis == Orientation::HORIZONTAL ? rupElement->getWidth() : rupElement->getHeight();
+            };
+            auto it = std::partition_point(
+                mChildren.begin() + begin,
+                mChildren.begin() + end,
+                [&](const std::unique_ptr<Element>& rupElement) { return start(rupElement) + size(rupElement) < gaze; });
+            for (; it != mChildren.begin() + end && start(*it) <= gaze; it++)
+            {
+                if (underGaze(*it))
+                {
+                    rIndices.push_back((uint)(it - mChildren.begin()));
+                }
+            }
+        }
+        else
+        {
+            for (uint i = begin; i < end; i++)
+            {
+                if (underGaze(mChildren[i]))
+                {
+                    rIndices.push_back(i);
+                }
+            }
         }
     }
 }
@@ -56,6 +56,9 @@ namespace eyegui
             Element* pTarget,
             std::unique_ptr<Element> upReplacement);
 
+        // Check whether animations are running, including the ones of children
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -64,19 +67,45 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Whether there is anything to draw besides background color
+        virtual bool hasContentToDraw() const;
+
+        // Enqueue background color
+        virtual void specialEnqueueBackground() const;
+
         // Reset filled by subclasses
         virtual void specialReset();
 
+        // Translation moves children instead of transforming them again
+        virtual void specialTranslate(int deltaX, int deltaY);
+
         // Draw on top of element (used for drawing children over effects like marking)
         virtual void drawChildren() const;
 
+        // Whether children are placed one after another along given axis without
+        // overlap. Then only the ones near the viewport are updated and drawn
+        virtual bool areChildrenInSequence(Orientation& rAxis) const;
+
         // Members
         std::vector<std::unique_ptr<Element> > mChildren;
 
     private:
 
+        // Find range of children intersecting viewport, which is extended by margin on both ends
+        void findChildrenInViewport(glm::ivec4 viewport, float margin, uint& rBegin, uint& rEnd) const;
+
+        // Append indices of children in range whose bounds contain the gaze
+        void findChildrenUnderGaze(Input const * pInput, uint begin, uint end, std::vector<uint>& rIndices) const;
+
         // Members
         bool mShowBackground;
+        mutable glm::ivec4 mViewport; // clipped area at last drawing, minX, minY, maxX, maxY
+        mutable bool mViewportKnown;
+        uint mUpdatedChildrenBegin; // range of children which are kept updated
+        uint mUpdatedChildrenEnd;
+        std::vector<uint> mAwakeChildren; // indices of children left unsettled by last update
+        float mChildrenAlpha; // alpha and dim given to children at last update
+        float mChildrenDim;
     };
 }
 
@@ -54,6 +54,8 @@ namespace eyegui
 		mDirection = direction;
         mSpace = space;
         mOffset.setValue(0);
+        mScrollRange = 0;
+        mScrollPixelOffset = 0;
     }
 
     Flow::~Flow()
@@ -99,11 +101,10 @@ namespace eyegui
             offsetSpeed *= 1.0f / mSpace; // Normalization
             mOffset.update(offsetSpeed * tpf * mpLayout->getConfig()->flowSpeedMultiplier);
 
-            // Only transform inner element if necessary
+            // Only move inner element if necessary
             if(oldValue != mOffset.getValue())
             {
-                // Call transform and resize on child aka inner element
-                transformInnerElement();
+                scrollInnerElement();
             }
         }
 
@@ -150,25 +151,16 @@ namespace eyegui
 			int deltaX = (mWidth - usedWidth) / 2;
 			int deltaY = (height - usedHeight) / 2;
 
+			// Scrolling only necessary when space is bigger than flow
+			mScrollRange = mHeight < height ? std::max(0, (usedHeight - mInnerHeight)) : 0;
+			mScrollPixelOffset = (int)(mOffset.getValue() * (float)mScrollRange);
+
 			// Transform the one and only child
-			if (mHeight < height)
-			{
-				// Scrolling necessary
-				mChildren.at(0)->transformAndSize(
-					mX + deltaX,
-					mY + deltaY - (int)(mOffset.getValue() * (float)std::max(0, (usedHeight - mInnerHeight))),
-					usedWidth,
-					usedHeight);
-			}
-			else
-			{
-				// No scrolling necessary
-				mChildren.at(0)->transformAndSize(
-					mX + deltaX,
-					mY + deltaY,
-					usedWidth,
-					usedHeight);
-			}
+			mChildren.at(0)->transformAndSize(
+				mX + deltaX,
+				mY + deltaY - mScrollPixelOffset,
+				usedWidth,
+				usedHeight);
 		}
 		else
 		{
@@ -187,25 +179,35 @@ namespace eyegui
 			int deltaX = (width - usedWidth) / 2;
 			int deltaY = (mHeight - usedHeight) / 2;
 
+			// Scrolling only necessary when space is bigger than flow
+			mScrollRange = mWidth < width ? std::max(0, (usedWidth - mInnerWidth)) : 0;
+			mScrollPixelOffset = (int)(mOffset.getValue() * (float)mScrollRange);
+
 			// Transform the one and only child
-			if (mWidth < width)
-			{
-				// Scrolling necessary
-				mChildren.at(0)->transformAndSize(
-					mX + deltaX - (int)(mOffset.getValue() * (float)std::max(0, (usedWidth - mInnerWidth))),
-					mY + deltaY,
-					usedWidth,
-					usedHeight);
-			}
-			else
-			{
-				// No scrolling necessary
-				mChildren.at(0)->transformAndSize(
-					mX + deltaX,
-					mY + deltaY,
-					usedWidth,
-					usedHeight);
-			}
+			mChildren.at(0)->transformAndSize(
+				mX + deltaX - mScrollPixelOffset,
+				mY + deltaY,
+				usedWidth,
+				usedHeight);
 		}
     }
+
+    void Flow::scrollInnerElement()
+    {
+        // Move inner element by difference to current offset, layout of it stays the same
+        int scrollPixelOffset = (int)(mOffset.getValue() * (float)mScrollRange);
+        int delta = scrollPixelOffset - mScrollPixelOffset;
+        if (delta != 0)
+        {
+            if (mDirection == FlowDirection::VERTICAL)
+            {
+                mChildren.at(0)->translate(0, -delta);
+            }
+            else
+            {
+                mChildren.at(0)->translate(-delta, 0);
+            }
+            mScrollPixelOffset = scrollPixelOffset;
+        }
+    }
 }
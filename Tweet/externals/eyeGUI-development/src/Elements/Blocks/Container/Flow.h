@@ -7,6 +7,7 @@
 // Flow is like a vertical scrolling box. One can define, how much vertical
 // space is reserved for an inner element compared to own height. Update and
 // drawing of inner element happens only in the bounds of the flow element.
+// Scrolling moves the inner element without transforming it again.
 
 #ifndef FLOW_H_
 #define FLOW_H_
@@ -68,10 +69,15 @@ namespace eyegui
         // Transform inner element
         void transformInnerElement();
 
+        // Move inner element to current offset
+        void scrollInnerElement();
+
         // Members
 		FlowDirection mDirection;
         float mSpace;
         LerpValue mOffset;
+        int mScrollRange; // pixels inner element can be scrolled
+        int mScrollPixelOffset; // pixels inner element is currently scrolled
     };
 }
 
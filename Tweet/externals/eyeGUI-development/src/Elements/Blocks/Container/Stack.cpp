@@ -57,9 +57,6 @@ namespace eyegui
         mAlignment = alignment;
         mPadding = padding;
         mSeparator = separator;
-        mpSeparatorItem = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
     }
 
     Stack::~Stack()
@@ -70,25 +67,22 @@ namespace eyegui
     void Stack::attachElement(std::unique_ptr<Element> upElement)
     {
         mChildren.push_back(std::move(upElement));
+
+        // New element has to be updated
+        makeUpdateNecessary();
     }
 
-    void Stack::specialDraw() const
+    void Stack::specialEnqueueForeground() const
     {
         // Super call
-        Container::specialDraw();
+        Container::specialEnqueueForeground();
 
-        // Draw separators
-        if (mSeparatorDrawMatrices.size() > 0 && getStyle()->separatorColor.a > 0)
+        // Enqueue separators
+        glm::vec4 color = getStyle()->separatorColor;
+        color.a *= mAlpha;
+        for (const glm::ivec4& rRect : mSeparatorRects)
         {
-            mpSeparatorItem->bind();
-            mpSeparatorItem->getShader()->fillValue("color", getStyle()->separatorColor);
-            mpSeparatorItem->getShader()->fillValue("alpha", mAlpha);
-
-            for (uint i = 0; i < mSeparatorDrawMatrices.size(); i++)
-            {
-                mpSeparatorItem->getShader()->fillValue("matrix", mSeparatorDrawMatrices[i]);
-                mpSeparatorItem->draw();
-            }
+            mpAssetManager->getRenderQueue()->enqueueQuad(mX + rRect.x, mY + rRect.y, rRect.z, rRect.w, color);
         }
     }
 
@@ -447,8 +441,8 @@ namespace eyegui
             }
         }
 
-        // Calculate draw matrices of separators using new data
-        mSeparatorDrawMatrices.clear();
+        // Calculate rectangles of separators using new data
+        mSeparatorRects.clear();
 
         // Only think about separators if necessary
         if (mSeparator > 0 && separatorCount >= 1)
@@ -473,27 +467,29 @@ namespace eyegui
                 // Translation depending on orientation
                 if (getOrientation() == Element::Orientation::HORIZONTAL)
                 {
-                    mSeparatorDrawMatrices.push_back(
-                        calculateDrawMatrix(
-                            mpLayout->getLayoutWidth(),
-                            mpLayout->getLayoutHeight(),
-                            separatorPositions[i],
-                            mY,
+                    mSeparatorRects.push_back(
+                        glm::ivec4(
+                            separatorPositions[i] - mX,
+                            0,
                             separatorWidth,
                             separatorHeight));
                 }
                 else
                 {
-                    mSeparatorDrawMatrices.push_back(
-                        calculateDrawMatrix(
-                            mpLayout->getLayoutWidth(),
-                            mpLayout->getLayoutHeight(),
-                            mX,
-                            separatorPositions[i],
+                    mSeparatorRects.push_back(
+                        glm::ivec4(
+                            0,
+                            separatorPositions[i] - mY,
                             separatorWidth,
                             separatorHeight));
                 }
             }
         }
     }
+
+    bool Stack::areChildrenInSequence(Orientation& rAxis) const
+    {
+        rAxis = getOrientation();
+        return true;
+    }
 }
@@ -65,12 +65,15 @@ namespace eyegui
 
     protected:
 
-        // Drawing filled by subclasses
-        virtual void specialDraw() const;
+        // Enqueue separators
+        virtual void specialEnqueueForeground() const;
 
         // Transformation
         virtual void specialTransformAndSize();
 
+        // Children are placed one after another along orientation of stack
+        virtual bool areChildrenInSequence(Orientation& rAxis) const;
+
     private:
 
         // Members
@@ -78,8 +81,7 @@ namespace eyegui
         Alignment mAlignment;
         float mPadding; // [0..1]
         float mSeparator; // [0..1]
-        RenderItem const * mpSeparatorItem;
-        std::vector<glm::mat4> mSeparatorDrawMatrices;
+        std::vector<glm::ivec4> mSeparatorRects; // x, y, width and height relative to position of stack
     };
 }
 
@@ -137,6 +137,11 @@ namespace eyegui
         mupTextFlow->draw(getStyle()->fontColor, mAlpha);
     }
 
+    bool TextBlock::hasContentToDraw() const
+    {
+        return true;
+    }
+
     void TextBlock::specialTransformAndSize()
     {
         // Super call
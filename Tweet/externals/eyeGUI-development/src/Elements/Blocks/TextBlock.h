@@ -56,6 +56,9 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Text is always drawn
+        virtual bool hasContentToDraw() const;
+
         // Transformation
         virtual void specialTransformAndSize();
 
@@ -57,6 +57,8 @@ namespace eyegui
         mMarking = false;
         mMark.setValue(0);
         mRenderingMask = renderingMask;
+        mSettled = false;
+        mChildUpdateNecessary = true;
 
         // Decide about dimming
         mDimming = dimming;
@@ -79,11 +81,6 @@ namespace eyegui
             // Ok, try to rescue by getting default style. Should be NEVER necessary
             mpStyle = mpLayout->getStyleFromStylesheet(DEFAULT_STYLE_NAME);
         }
-
-        // Render items
-        mpActivityItem = mpAssetManager->fetchRenderItem(shaders::Type::ACTIVITY, meshes::Type::QUAD);
-        mpDimItem = mpAssetManager->fetchRenderItem(shaders::Type::DIM, meshes::Type::QUAD);
-        mpMarkItem = mpAssetManager->fetchRenderItem(shaders::Type::MARK, meshes::Type::QUAD);
     }
 
     Element::~Element()
@@ -191,6 +188,8 @@ namespace eyegui
 
     void Element::setActivity(bool active, bool fade)
     {
+        makeUpdateNecessary();
+
         if (active)
         {
             if (mpParent->isActive())
@@ -219,6 +218,7 @@ namespace eyegui
     void Element::setDimming(bool dimming)
     {
         mDimming = dimming;
+        makeUpdateNecessary();
     }
 
     bool Element::isDimming() const
@@ -229,6 +229,7 @@ namespace eyegui
     void Element::setMarking(bool marking, int depth)
     {
         mMarking = marking;
+        makeUpdateNecessary();
     }
 
     bool Element::isMarking() const
@@ -349,6 +350,25 @@ namespace eyegui
                             mHeight);
     }
 
+    void Element::translate(int deltaX, int deltaY)
+    {
+        // Size and therefore layout of children stays the same
+        mX += deltaX;
+        mY += deltaY;
+
+        // Call method implemented by subclasses
+        specialTranslate(deltaX, deltaY);
+
+        // Recalculate the matrix for rendering
+        mFullDrawMatrix = calculateDrawMatrix(
+                            mpLayout->getLayoutWidth(),
+                            mpLayout->getLayoutHeight(),
+                            mX,
+                            mY,
+                            mWidth,
+                            mHeight);
+    }
+
     float Element::getDynamicScale() const
     {
         return mRelativeScale + (mAdaptiveScale.getValue() * mpLayout->getConfig()->maximalAdaptiveScaleIncrease);
@@ -371,6 +391,24 @@ namespace eyegui
 
     float Element::update(float tpf, float alpha, Input* pInput, float dim)
     {
+        // Check wether cursor is over element
+        bool penetrated = penetratedByInput(pInput);
+
+        // *** SKIPPING ***
+
+        // Settled element can be skipped as long as input and values given by parent stay the same
+        if (mSettled
+            && !penetrated
+            && !mpLayout->isFullUpdateNecessary()
+            && alpha == mAlpha
+            && (mDimming || dim == mDim.getValue()))
+        {
+            return mAdaptiveScale.getValue();
+        }
+
+        // Remember adaptive scale to detect changes
+        float previousAdaptiveScale = mAdaptiveScale.getValue();
+
         // *** OWN UPDATING ***
 
         // Activity animation
@@ -379,9 +417,6 @@ namespace eyegui
         // Save current alpha (already animated by layout or other element)
         mAlpha = alpha;
 
-        // Check wether cursor is over element
-        bool penetrated = penetratedByInput(pInput);
-
         // Dimming
         if (mForceUndim)
         {
@@ -475,63 +510,104 @@ namespace eyegui
         // If it would be not saved in member, nobody would know about it at rendering.
         mAdaptiveScale.setValue(std::max(mAdaptiveScale.getValue(), specialAdaptiveScale));
 
+        // Changed adaptive scale changes size of elements
+        if (mAdaptiveScale.getValue() != previousAdaptiveScale)
+        {
+            mpFrame->makeResizeNecessary(false);
+        }
+
+        // *** SETTLING ***
+
+        // Element may be skipped at next update
+        mSettled = !penetrated && !isAnimating();
+
         // Return adaptive scale
         return mAdaptiveScale.getValue();
     }
 
+    void Element::makeUpdateNecessary()
+    {
+        // Parents have to be updated to reach the element
+        mSettled = false;
+        Element* pElement = mpParent;
+        while (pElement != NULL)
+        {
+            pElement->mSettled = false;
+            pElement->mChildUpdateNecessary = true;
+            pElement = pElement->mpParent;
+        }
+    }
+
+    bool Element::isSettled() const
+    {
+        return mSettled;
+    }
+
+    bool Element::isAnimating() const
+    {
+        // Dimming is animated when undimming is forced or when dimming is used (element is not penetrated)
+        bool dimAnimating = false;
+        if (mForceUndim)
+        {
+            dimAnimating = mDim.getValue() > 0;
+        }
+        else if (mDimming)
+        {
+            dimAnimating = mDim.getValue() < 1;
+        }
+
+        return dimAnimating
+            || mActivity.getValue() != (mActive ? 1.f : 0.f)
+            || mMark.getValue() != (mMarking ? 1.f : 0.f)
+            || mAdaptiveScale.getValue() > 0
+            || mupReplacedElement.get() != NULL;
+    }
+
     void Element::draw() const
     {
         // Only draw if visible
         if (mAlpha > 0 && !mHidden)
         {
-            // Bind mask for that element in first slot
+            // Background, e.g. color of blocks
+            specialEnqueueBackground();
+
+            // Content of element, drawn with mask of element bound to first slot
             // DO NOT BIND ANYTHING ELSE WHILE DRAWING TO SLOT 0 !!!
-            switch (mRenderingMask)
+            if (hasContentToDraw())
             {
-            case RenderingMask::BOX:
-                mpAssetManager->fetchTexture(graphics::Type::BOX)->bind(0);
-                break;
-            case RenderingMask::CIRCLE:
-                mpAssetManager->fetchTexture(graphics::Type::CIRCLE)->bind(0);
-                break;
+                Texture const * pMask = NULL;
+                switch (mRenderingMask)
+                {
+                case RenderingMask::BOX:
+                    pMask = mpAssetManager->fetchTexture(graphics::Type::BOX);
+                    break;
+                case RenderingMask::CIRCLE:
+                    pMask = mpAssetManager->fetchTexture(graphics::Type::CIRCLE);
+                    break;
+                }
+                mpAssetManager->getRenderQueue()->enqueueCallback(
+                    mX, mY, mWidth, mHeight, pMask, [this]() { specialDraw(); });
             }
 
-            // Draw content of element
-            specialDraw();
+            // Decoration, e.g. highlighting of interactive elements
+            specialEnqueueForeground();
 
-            // Draw marking
+            // Marking
             if(mMark.getValue() > 0)
             {
-                mpMarkItem->bind();
-                mpMarkItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpMarkItem->getShader()->fillValue("markColor", getStyle()->markColor);
-                mpMarkItem->getShader()->fillValue("mark", mMark.getValue());
-                mpMarkItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpMarkItem->draw();
+                enqueueMaskedQuad(getStyle()->markColor * mMark.getValue(), getMultipliedDimmedAlpha());
             }
 
-            // Draw activity (or unactivity)
+            // Activity (or unactivity)
             if(mActivity.getValue() < 1)
             {
-                mpActivityItem->bind();
-                mpActivityItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpActivityItem->getShader()->fillValue("activity", mActivity.getValue());
-                mpActivityItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpActivityItem->draw();
+                enqueueMaskedQuad(glm::vec4(0.3f, 0.3f, 0.3f, 0.5f) * (1.f - mActivity.getValue()), getMultipliedDimmedAlpha());
             }
 
-            // Draw dimming
+            // Dimming
             if(mDim.getValue() > 0)
             {
-                mpDimItem->bind();
-                mpDimItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpDimItem->getShader()->fillValue("dimColor", getStyle()->dimColor);
-                mpDimItem->getShader()->fillValue("dim", mDim.getValue());
-                mpDimItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpDimItem->draw();
+                enqueueMaskedQuad(getStyle()->dimColor * mDim.getValue(), getMultipliedDimmedAlpha());
             }
 
             drawChildren();
@@ -563,6 +639,7 @@ namespace eyegui
         mForceUndim = false;
 
         mAdaptiveScale.setValue(0);
+        makeUpdateNecessary();
 
         // TODO: one could reset marking, too
 
@@ -617,6 +694,9 @@ namespace eyegui
 
     void Element::commitReplacedElement(std::unique_ptr<Element> upElement, bool fade)
     {
+        // New element has to be updated, even if parent is settled
+        makeUpdateNecessary();
+
         if (fade)
         {
             // Fading is wished, so remember the replaced element
@@ -645,6 +725,12 @@ namespace eyegui
 		return false;
 	}
 
+    void Element::specialTranslate(int /*deltaX*/, int /*deltaY*/)
+    {
+        // Transform at new position, size stays the same
+        specialTransformAndSize();
+    }
+
     bool Element::penetratedByInput(Input const * pInput) const
     {
         // Check whether gaze is upon element
@@ -661,6 +747,34 @@ namespace eyegui
         return false;
     }
 
+    bool Element::hasContentToDraw() const
+    {
+        return true;
+    }
+
+    void Element::specialEnqueueBackground() const
+    {
+        // Standard is: do nothing
+    }
+
+    void Element::specialEnqueueForeground() const
+    {
+        // Standard is: do nothing
+    }
+
+    void Element::enqueueMaskedQuad(glm::vec4 color, float alpha, bool radialGradient) const
+    {
+        color.a *= alpha;
+        mpAssetManager->getRenderQueue()->enqueueQuad(
+            mX,
+            mY,
+            mWidth,
+            mHeight,
+            color,
+            mRenderingMask == RenderingMask::CIRCLE, // box mask covers whole quad
+            radialGradient);
+    }
+
     void Element::drawChildren() const
     {
         // Standard is: do nothing
@@ -14,6 +14,10 @@
 // Transformation and size is calculated using a mechanism first asking the
 // children with "evaluateSize" how much of the available space they would use
 // and then telling all the children their size and transformation.
+// Elements whose animations have come to rest and which are not penetrated
+// by input are settled. Settled elements and their children are skipped at
+// updating until something changes them, which makes update necessary again
+// for the element and all its parents.
 
 #ifndef ELEMENT_H_
 #define ELEMENT_H_
@@ -173,6 +177,9 @@ namespace eyegui
         // Change transformation and size (pixel values)
         void transformAndSize(int x, int y, int width, int height);
 
+        // Move element and children without changing size (pixel values)
+        void translate(int deltaX, int deltaY);
+
         // Get relative and adaptive scale combined to dynamic scale
         float getDynamicScale() const;
 
@@ -188,6 +195,15 @@ namespace eyegui
         // Updating, returns adaptive scale
         float update(float tpf, float alpha, Input* pInput, float dim);
 
+        // Make update necessary for element and its parents
+        void makeUpdateNecessary();
+
+        // Check whether element and its children were settled at last update
+        bool isSettled() const;
+
+        // Check whether animations are running. Implemented by subclasses with own animations
+        virtual bool isAnimating() const;
+
         // Drawing
         void draw() const;
 
@@ -223,12 +239,27 @@ namespace eyegui
         // Updating filled by subclasses, returns adaptive scale
         virtual float specialUpdate(float tpf, Input* pInput) = 0;
 
-        // Drawing filled by subclasses
+        // Drawing filled by subclasses. Called by render queue after everything is enqueued
         virtual void specialDraw() const = 0;
 
+        // Whether special draw has anything to draw, otherwise it is not enqueued
+        virtual bool hasContentToDraw() const;
+
+        // Enqueue quads behind content, may be filled by subclasses
+        virtual void specialEnqueueBackground() const;
+
+        // Enqueue quads on top of content, may be filled by subclasses
+        virtual void specialEnqueueForeground() const;
+
+        // Enqueue quad of single color covering element, masked like element
+        void enqueueMaskedQuad(glm::vec4 color, float alpha, bool radialGradient = false) const;
+
         // Transformation filled by subclasses
         virtual void specialTransformAndSize() = 0;
 
+        // Translation, may be filled by subclasses. Standard is transformation at new position
+        virtual void specialTranslate(int deltaX, int deltaY);
+
         // Reset filled by subclasses
         virtual void specialReset() = 0;
 
@@ -260,6 +291,7 @@ namespace eyegui
         LerpValue mAdaptiveScale; // [0..1]
         bool mForceUndim; // At the moment only used by drop button
                           // to be undimmed while showing inner elements
+        bool mChildUpdateNecessary; // some descendant asked for update since last update
 
     private:
 
@@ -273,9 +305,6 @@ namespace eyegui
         std::unique_ptr<Element> mupReplacedElement;
         bool mHidden;
         RenderingMask mRenderingMask;
-        RenderItem const * mpActivityItem;
-        RenderItem const * mpDimItem;
-        RenderItem const * mpMarkItem;
 
         bool mActive;
         LerpValue mActivity; // [0..1]
@@ -286,6 +315,8 @@ namespace eyegui
         bool mMarking;
         LerpValue mMark; // [0..1]
 
+        bool mSettled;
+
     };
 }
 
@@ -185,4 +185,17 @@ namespace eyegui
         }
         return NULL;
     }
+
+    Block* toBlock(Element* pElement)
+    {
+        if (pElement != NULL)
+        {
+            Element::Type type = pElement->getType();
+            if (type == Element::Type::BLOCK)
+            {
+                return static_cast<Block*>(pElement);
+            }
+        }
+        return NULL;
+    }
 }
@@ -45,6 +45,9 @@ namespace eyegui
 
     // Tries to cast pointer, returns NULL if fails
     Picture* toPicture(Element* pElement);
+
+    // Tries to cast pointer, returns NULL if fails or element is subclass of block
+    Block* toBlock(Element* pElement);
 }
 
 #endif // ELEMENT_CASTING_H_
@@ -60,14 +60,14 @@ namespace eyegui
     {
         mpIcon->bind(1);
         mpBoxButtonItem->bind();
-        mpBoxButtonItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpBoxButtonItem->getShader()->fillValue("color", getStyle()->color);
-        mpBoxButtonItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpBoxButtonItem->getShader()->fillValue("pressing", getPressing());
-        mpBoxButtonItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpBoxButtonItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpBoxButtonItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpBoxButtonItem->getShader()->fillValue("icon", 1);
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::MATRIX, mFullDrawMatrix);
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::COLOR, getStyle()->color);
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::ICON_COLOR, getStyle()->iconColor);
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::PRESSING, getPressing());
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::ICON_UV_SCALE, iconAspectRatioCorrection());
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::ALPHA, getMultipliedDimmedAlpha());
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::MASK, 0); // Mask is always in slot 0
+        mpBoxButtonItem->getShader()->fillValue(ShaderUniform::ICON, 1);
         mpBoxButtonItem->draw();
 
         // Super call (draw highlight etc. on top)
@@ -146,6 +146,13 @@ namespace eyegui
         return mIsDown;
     }
 
+    bool Button::isAnimating() const
+    {
+        return IconElement::isAnimating()
+            || mPressing.getValue() != (mIsDown ? 1.f : 0.f)
+            || mThreshold.getValue() > 0;
+    }
+
     float Button::specialUpdate(float tpf, Input* pInput)
     {
         // Super call
@@ -199,10 +206,10 @@ namespace eyegui
         if(mThreshold.getValue() > 0)
         {
             mpThresholdItem->bind();
-            mpThresholdItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-            mpThresholdItem->getShader()->fillValue("threshold", mThreshold.getValue());
-            mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
+            mpThresholdItem->getShader()->fillValue(ShaderUniform::MATRIX, mFullDrawMatrix);
+            mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD_COLOR, getStyle()->thresholdColor);
+            mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD, mThreshold.getValue());
+            mpThresholdItem->getShader()->fillValue(ShaderUniform::ALPHA, mAlpha);
             if(!mUseCircleThreshold)
             {
                 float orientation = 0;
@@ -213,9 +220,9 @@ namespace eyegui
                         orientation = 1;
                     }
                 }
-                mpThresholdItem->getShader()->fillValue("orientation", orientation);
+                mpThresholdItem->getShader()->fillValue(ShaderUniform::ORIENTATION, orientation);
             }
-            mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+            mpThresholdItem->getShader()->fillValue(ShaderUniform::MASK, 0); // mask is always in slot 0
             mpThresholdItem->draw();
         }
 
@@ -53,6 +53,9 @@ namespace eyegui
         // Is button down?
         bool isDown() const;
 
+        // Check whether animations are running
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
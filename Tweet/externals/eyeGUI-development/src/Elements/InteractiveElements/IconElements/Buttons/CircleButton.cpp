@@ -58,13 +58,13 @@ namespace eyegui
     {
         mpIcon->bind(1);
         mpCircleButtonItem->bind();
-        mpCircleButtonItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpCircleButtonItem->getShader()->fillValue("color", getStyle()->color);
-        mpCircleButtonItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpCircleButtonItem->getShader()->fillValue("pressing", getPressing());
-        mpCircleButtonItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpCircleButtonItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpCircleButtonItem->getShader()->fillValue("icon", 1);
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::MATRIX, mFullDrawMatrix);
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::COLOR, getStyle()->color);
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::ICON_COLOR, getStyle()->iconColor);
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::PRESSING, getPressing());
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::ALPHA, getMultipliedDimmedAlpha());
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::MASK, 0); // Mask is always in slot 0
+        mpCircleButtonItem->getShader()->fillValue(ShaderUniform::ICON, 1);
         mpCircleButtonItem->draw();
 
 
@@ -68,6 +68,7 @@ namespace eyegui
 
         mInnerElementVisible = true;
         mForceUndim = true;
+        makeUpdateNecessary();
 
         // Immediately
         if (immediately)
@@ -83,6 +84,7 @@ namespace eyegui
 
         mInnerElementVisible = false;
         mForceUndim = false;
+        makeUpdateNecessary();
 
         // Immediately
         if (immediately)
@@ -155,6 +157,11 @@ namespace eyegui
         BoxButton::setActivity(active, fade);
     }
 
+    bool DropButton::isAnimating() const
+    {
+        return BoxButton::isAnimating() || mInnerAlpha.getValue() != (mInnerElementVisible ? 1.f : 0.f);
+    }
+
     float DropButton::specialUpdate(float tpf, Input * pInput)
     {
         // Super call
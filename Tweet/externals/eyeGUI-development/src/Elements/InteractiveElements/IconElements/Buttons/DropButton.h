@@ -58,6 +58,9 @@ namespace eyegui
         // Activate or deactivate
         virtual void setActivity(bool active, bool fade);
 
+        // Check whether animations are running
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -44,6 +44,7 @@ namespace eyegui
         mType = Type::ICON_ELEMENT;
 
         // Fill members
+        mpIcon = NULL;
         setIcon(iconFilepath);
         mDescriptionKey = descKey;
         mDescriptionAlpha.setValue(0);
@@ -89,11 +90,13 @@ namespace eyegui
 
     IconElement::~IconElement()
     {
-        // Nothing to do here
+        mpAssetManager->releaseTexture(mpIcon);
     }
 
     void IconElement::setIcon(std::string filepath)
     {
+        // Fetch new icon before releasing old one, which might be the same
+        Texture const * pOldIcon = mpIcon;
         if (filepath != EMPTY_STRING_ATTRIBUTE)
         {
             mpIcon = mpAssetManager->fetchTexture(filepath);
@@ -102,6 +105,7 @@ namespace eyegui
         {
             mpIcon = mpAssetManager->fetchTexture(graphics::Type::NOT_FOUND);
         }
+        mpAssetManager->releaseTexture(pOldIcon);
     }
 
     void IconElement::setIcon(
@@ -112,9 +116,18 @@ namespace eyegui
 		unsigned char const * pIconData,
 		bool flipY)
 	{
+        // Release first, so texture with same name is replaced without further user
+        mpAssetManager->releaseTexture(mpIcon);
         mpIcon = mpAssetManager->fetchTexture(name, width, height, format, pIconData, flipY);
     }
 
+    bool IconElement::isAnimating() const
+    {
+        // Description is only visible without penetration when always visible
+        float descriptionTarget = mpLayout->getDescriptionVisibility() == DescriptionVisibility::VISIBLE ? 1.f : 0.f;
+        return InteractiveElement::isAnimating() || mDescriptionAlpha.getValue() != descriptionTarget;
+    }
+
     float IconElement::specialUpdate(float tpf, Input* pInput)
     {
         // Super call
@@ -151,9 +164,6 @@ namespace eyegui
             // Drawing of text flow
             mupDescriptionFlow->draw(getStyle()->fontColor, mDescriptionAlpha.getValue() * mAlpha, true);
         }
-
-        // Draw stuff like highlighting
-        InteractiveElement::specialDraw();
     }
 
     void IconElement::specialTransformAndSize()
@@ -49,6 +49,9 @@ namespace eyegui
 			unsigned char const * pIconData,
 			bool flipY);
 
+        // Check whether animations are running
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
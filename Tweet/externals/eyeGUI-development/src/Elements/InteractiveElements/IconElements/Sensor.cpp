@@ -72,6 +72,11 @@ namespace eyegui
         highlight(false);
     }
 
+    bool Sensor::isAnimating() const
+    {
+        return IconElement::isAnimating() || mPenetration.getValue() > 0;
+    }
+
     float Sensor::specialUpdate(float tpf, Input* pInput)
     {
 		// Super call
@@ -106,14 +111,14 @@ namespace eyegui
     {
         mpIcon->bind(1);
         mpSensorItem->bind();
-        mpSensorItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpSensorItem->getShader()->fillValue("color", getStyle()->color);
-        mpSensorItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpSensorItem->getShader()->fillValue("penetration", mPenetration.getValue());
-        mpSensorItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpSensorItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpSensorItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpSensorItem->getShader()->fillValue("icon", 1);
+        mpSensorItem->getShader()->fillValue(ShaderUniform::MATRIX, mFullDrawMatrix);
+        mpSensorItem->getShader()->fillValue(ShaderUniform::COLOR, getStyle()->color);
+        mpSensorItem->getShader()->fillValue(ShaderUniform::ICON_COLOR, getStyle()->iconColor);
+        mpSensorItem->getShader()->fillValue(ShaderUniform::PENETRATION, mPenetration.getValue());
+        mpSensorItem->getShader()->fillValue(ShaderUniform::ICON_UV_SCALE, iconAspectRatioCorrection());
+        mpSensorItem->getShader()->fillValue(ShaderUniform::ALPHA, getMultipliedDimmedAlpha());
+        mpSensorItem->getShader()->fillValue(ShaderUniform::MASK, 0); // Mask is always in slot 0
+        mpSensorItem->getShader()->fillValue(ShaderUniform::ICON, 1);
         mpSensorItem->draw();
 
         // Super call
@@ -41,6 +41,9 @@ namespace eyegui
         // Penetrating
         virtual void penetrate(float amount);
 
+        // Check whether animations are running
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
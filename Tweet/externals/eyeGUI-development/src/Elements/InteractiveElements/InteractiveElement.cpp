@@ -10,6 +10,8 @@
 #include "Layout.h"
 #include "src/Utilities/Helper.h"
 
+#include <cmath>
+
 namespace eyegui
 {
     InteractiveElement::InteractiveElement(
@@ -45,10 +47,6 @@ namespace eyegui
         mIsHighlighted = false;
         mSelection.setValue(0);
         mIsSelected = false;
-
-        // Render items
-        mpHighlightItem = mpAssetManager->fetchRenderItem(shaders::Type::HIGHLIGHT, meshes::Type::QUAD);
-        mpSelectionItem = mpAssetManager->fetchRenderItem(shaders::Type::SELECTION, meshes::Type::QUAD);
     }
 
     InteractiveElement::~InteractiveElement()
@@ -63,6 +61,7 @@ namespace eyegui
 
     void InteractiveElement::interact()
     {
+        makeUpdateNecessary();
         if (mAlpha >= 1 && isActive())
         {
             specialInteract();
@@ -72,11 +71,13 @@ namespace eyegui
     void InteractiveElement::highlight(bool doHighlight)
     {
         mIsHighlighted = doHighlight;
+        makeUpdateNecessary();
     }
 
     void InteractiveElement::select(bool doSelect)
     {
         mIsSelected = doSelect;
+        makeUpdateNecessary();
     }
 
     InteractiveElement* InteractiveElement::internalNextInteractiveElement(Element const * pCaller)
@@ -84,36 +85,34 @@ namespace eyegui
         return this;
     }
 
-    void InteractiveElement::specialDraw() const
+    void InteractiveElement::specialEnqueueForeground() const
     {
-        // Should be called by subclasses after personal drawing
-
-        // Draw highlight
+        // Highlight, pulsing over time
         if(mHighlight.getValue() > 0)
         {
-            mpHighlightItem->bind();
-            mpHighlightItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpHighlightItem->getShader()->fillValue("highlightColor", getStyle()->highlightColor);
-            mpHighlightItem->getShader()->fillValue("highlight", mHighlight.getValue());
-            mpHighlightItem->getShader()->fillValue("time", mpLayout->getAccPeriodicTime());
-            mpHighlightItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpHighlightItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-            mpHighlightItem->draw();
+            float pulse = 0.5f * (1.f + std::sin(3.f * mpLayout->getAccPeriodicTime()));
+            enqueueMaskedQuad(
+                getStyle()->highlightColor * mHighlight.getValue(),
+                getMultipliedDimmedAlpha() * pulse);
         }
 
-        // Draw selection
+        // Selection, growing to the border
         if(mSelection.getValue() > 0)
         {
-            mpSelectionItem->bind();
-            mpSelectionItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpSelectionItem->getShader()->fillValue("selectionColor", getStyle()->selectionColor);
-            mpSelectionItem->getShader()->fillValue("selection", mSelection.getValue());
-            mpSelectionItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpSelectionItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-            mpSelectionItem->draw();
+            enqueueMaskedQuad(
+                getStyle()->selectionColor,
+                getMultipliedDimmedAlpha() * mSelection.getValue(),
+                true);
         }
     }
 
+    bool InteractiveElement::isAnimating() const
+    {
+        return Element::isAnimating()
+            || mHighlight.getValue() != (mIsHighlighted ? 1.f : 0.f)
+            || mSelection.getValue() != (mIsSelected ? 1.f : 0.f);
+    }
+
     float InteractiveElement::specialUpdate(float tpf, Input* pInput)
     {
         // Highlight
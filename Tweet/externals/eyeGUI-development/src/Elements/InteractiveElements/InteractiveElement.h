@@ -52,13 +52,16 @@ namespace eyegui
         // Tries to fetch next interactive element for selecting, returns NULL if fails
         virtual InteractiveElement* internalNextInteractiveElement(Element const * pChildCaller);
 
+        // Check whether animations are running
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
         virtual float specialUpdate(float tpf, Input* pInput);
 
-        // Drawing filled by subclasses
-        virtual void specialDraw() const;
+        // Enqueue highlighting and selection
+        virtual void specialEnqueueForeground() const;
 
         // Reset filld by subclasses
         virtual void specialReset();
@@ -74,8 +77,6 @@ namespace eyegui
         bool mIsHighlighted;
         LerpValue mSelection;
         bool mIsSelected;
-        RenderItem const * mpHighlightItem;
-        RenderItem const * mpSelectionItem;
     };
 }
 
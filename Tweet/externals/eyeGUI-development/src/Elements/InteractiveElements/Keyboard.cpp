@@ -56,11 +56,6 @@ namespace eyegui
         mUseFastTyping = false;
         mFastBuffer = u"";
 
-        // Fetch render item for background
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
         // Create keymaps (mKeymaps)
         initKeymaps(mpLayout->getCharacterSet());
     }
@@ -135,6 +130,11 @@ namespace eyegui
         return NULL;
     }
 
+    bool Keyboard::isAnimating() const
+    {
+        return true;
+    }
+
     float Keyboard::specialUpdate(float tpf, Input* pInput)
     {
         // *** SET UP PARAMETERS ***
@@ -370,19 +370,15 @@ namespace eyegui
         return 0;
     }
 
-    void Keyboard::specialDraw() const
+    void Keyboard::specialEnqueueBackground() const
     {
-        // *** BACKGROUND ***
-        if (getStyle()->backgroundColor.a > 0)
-        {
-            // Bind, fill and draw background
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpBackground->draw();
-        }
+        glm::vec4 color = getStyle()->backgroundColor;
+        color.a *= getMultipliedDimmedAlpha();
+        mpAssetManager->getRenderQueue()->enqueueQuad(mX, mY, mWidth, mHeight, color);
+    }
 
+    void Keyboard::specialDraw() const
+    {
         // *** RENDER KEYS ***
 
         // Push scissor to prohibit keys to draw outside of element
@@ -427,9 +423,6 @@ namespace eyegui
         }
 
         popScissor();
-
-        // Render superclass
-        InteractiveElement::specialDraw();
     }
 
     void Keyboard::specialTransformAndSize()
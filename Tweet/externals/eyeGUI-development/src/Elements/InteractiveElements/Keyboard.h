@@ -57,6 +57,9 @@ namespace eyegui
         // Tries to fetch next interactive element for selecting, returns NULL if fails
         virtual InteractiveElement* internalNextInteractiveElement(Element const * pChildCaller);
 
+        // Keys are animated by gaze, so keyboard is always updated
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -65,6 +68,9 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Enqueue background color
+        virtual void specialEnqueueBackground() const;
+
         // Transformation filled by subclasses
         virtual void specialTransformAndSize();
 
@@ -131,7 +137,6 @@ namespace eyegui
 		void pressKey(SubKeymap* pKeys, int i, int j);
 
         // Members
-        RenderItem const * mpBackground;
         LerpValue mThreshold;
         int mFocusedKeyRow;
         int mFocusedKeyColumn;
@@ -47,11 +47,6 @@ namespace eyegui
         mDelta = 0;
         mCompleteWidth = 0;
 
-        // Fetch render item for background
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
         // Fetch single render item to draw all thresholds
         mpThresholdItem = mpAssetManager->fetchRenderItem(shaders::Type::BOX_THRESHOLD, meshes::Type::QUAD);
     }
@@ -118,6 +113,11 @@ namespace eyegui
         mSuggestions.clear();
     }
 
+    bool WordSuggest::isAnimating() const
+    {
+        return true;
+    }
+
     float WordSuggest::specialUpdate(float tpf, Input* pInput)
     {
         // Super call
@@ -215,19 +215,15 @@ namespace eyegui
         return adaptiveScale;
     }
 
-    void WordSuggest::specialDraw() const
+    void WordSuggest::specialEnqueueBackground() const
     {
-        // *** BACKGROUND ***
-        if (getStyle()->backgroundColor.a > 0)
-        {
-            // Bind, fill and draw background
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpBackground->draw();
-        }
+        glm::vec4 color = getStyle()->backgroundColor;
+        color.a *= getMultipliedDimmedAlpha();
+        mpAssetManager->getRenderQueue()->enqueueQuad(mX, mY, mWidth, mHeight, color);
+    }
 
+    void WordSuggest::specialDraw() const
+    {
         // *** SUGGESTIONS ***
         if (!mSuggestions.empty())
         {
@@ -261,12 +257,12 @@ namespace eyegui
 
                     // Draw threshold
                     mpThresholdItem->bind();
-                    mpThresholdItem->getShader()->fillValue("matrix", matrix);
-                    mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-                    mpThresholdItem->getShader()->fillValue("threshold", threshold);
-                    mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
-                    mpThresholdItem->getShader()->fillValue("orientation", 1.f); // vertical threshold
-                    mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::MATRIX, matrix);
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD_COLOR, getStyle()->thresholdColor);
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD, threshold);
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::ALPHA, mAlpha);
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::ORIENTATION, 1.f); // vertical threshold
+                    mpThresholdItem->getShader()->fillValue(ShaderUniform::MASK, 0); // mask is always in slot 0
                     mpThresholdItem->draw();
                 }
             }
@@ -279,9 +275,6 @@ namespace eyegui
 
             popScissor();
         }
-
-        // Draw stuff like highlighting
-        InteractiveElement::specialDraw();
     }
 
     void WordSuggest::specialTransformAndSize()
@@ -45,6 +45,9 @@ namespace eyegui
         // Clear
         void clear();
 
+        // Suggestions are animated by gaze, so word suggest is always updated
+        virtual bool isAnimating() const;
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -53,6 +56,9 @@ namespace eyegui
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
+        // Enqueue background color
+        virtual void specialEnqueueBackground() const;
+
         // Transformation filled by subclasses
         virtual void specialTransformAndSize();
 
@@ -92,7 +98,6 @@ namespace eyegui
         void chooseSuggestion(int index);
 
         // Members
-        RenderItem const * mpBackground;
         FontSize mFontSize;
         std::vector<std::unique_ptr<TextSimple> > mSuggestions;
         LerpValue mOffset; // offset given in percent of all suggestions
@@ -7,6 +7,8 @@
 
 #include "Picture.h"
 
+#include "src/Frame.h"
+
 namespace eyegui
 {
     Picture::Picture(
@@ -40,6 +42,7 @@ namespace eyegui
 
         // Fill members
         mupImage = std::move(mpAssetManager->createImage(mpLayout, filepath, alignment));
+        mAlignment = alignment;
 
         // Aspect ratio of border should be preserved if necessary (only when pictue is neither zoomed nor stretched)
         if (alignment == ImageAlignment::ORIGINAL)
@@ -74,6 +77,29 @@ namespace eyegui
         mupImage->setContent(name, width, height, format, pData, flipY);
     }
 
+    void Picture::setImage(std::string filepath, ImageAlignment alignment)
+    {
+        // Only original alignment makes size of picture depend on image
+        bool original = (alignment == ImageAlignment::ORIGINAL) || (mAlignment == ImageAlignment::ORIGINAL);
+        float previousBorderAspectRatio = mBorderAspectRatio;
+
+        mupImage = std::move(mpAssetManager->createImage(mpLayout, filepath, alignment));
+        mAlignment = alignment;
+        mBorderAspectRatio = (alignment == ImageAlignment::ORIGINAL)
+            ? (float)(mupImage->getTextureWidth()) / (float)(mupImage->getTextureHeight())
+            : 1;
+
+        if (original && mBorderAspectRatio != previousBorderAspectRatio)
+        {
+            mpFrame->makeResizeNecessary(true);
+        }
+        else
+        {
+            specialTransformAndSize();
+        }
+        makeUpdateNecessary();
+    }
+
     float Picture::specialUpdate(float tpf, Input* pInput)
     {
         return 0;
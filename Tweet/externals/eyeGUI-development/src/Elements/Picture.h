@@ -52,6 +52,9 @@ namespace eyegui
 			unsigned char const * pData,
 			bool flipY);
 
+        // Set image from file, keeping element. Resizes frame only if size of picture may change
+        void setImage(std::string filepath, ImageAlignment alignment);
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -73,6 +76,7 @@ namespace eyegui
 
         // Members
         std::unique_ptr<Image> mupImage;
+        ImageAlignment mAlignment;
     };
 }
 
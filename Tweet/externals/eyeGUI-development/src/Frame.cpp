@@ -114,12 +114,8 @@ namespace eyegui
                 pElement->update(tpf, mFrontElementAlphas[pElement], pInput, 0); // TODO: Intelligent decision to deactivate dimming here?
             }
 
-            // Update standard elements
-            float adaptiveScale = mupRoot->update(tpf, mCombinedAlpha, pInput, 0);
-            if (adaptiveScale > 0)
-            {
-                mResizeNecessary = true;
-            }
+            // Update standard elements (resizing is made necessary by elements with changing adaptive scale)
+            mupRoot->update(tpf, mCombinedAlpha, pInput, 0);
         }
 
         // *** DELETION OF REPLACED ELEMENTS ***
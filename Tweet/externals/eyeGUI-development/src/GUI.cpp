@@ -29,7 +29,9 @@ namespace eyegui
         float fontMediumSize,
         float fontSmallSize,
         FontSize descriptionFontSize,
-        bool resizeInvisibleLayouts)
+        bool resizeInvisibleLayouts,
+        std::string graphicsCacheDirectory,
+        std::string layoutCacheDirectory)
     {
         // Initialize OpenGL
         GLSetup::init();
@@ -40,6 +42,8 @@ namespace eyegui
         mNewWidth = mWidth;
         mNewHeight = mHeight;
         mCharacterSet = characterSet;
+        mGraphicsCacheDirectory = graphicsCacheDirectory; // used by asset manager
+        mLayoutCacheDirectory = layoutCacheDirectory; // used by asset manager
         mAccPeriodicTime = -(ACCUMULATED_TIME_PERIOD / 2);
         mupAssetManager = std::unique_ptr<AssetManager>(new AssetManager(this));
         mpDefaultFont = NULL;
@@ -77,7 +81,8 @@ namespace eyegui
 
     GUI::~GUI()
     {
-        // Nothing to do so far
+        // Delete layouts before asset manager, because their elements release assets
+        mLayers.clear();
     }
 
     Layout* GUI::addLayout(std::string filepath, int layer, bool visible)
@@ -215,21 +220,27 @@ namespace eyegui
         // Init scissor stack for this frame
         initScissorStack(getWindowWidth(), getWindowHeight());
 
+        // Show images and vector graphics loaded meanwhile
+        mupAssetManager->uploadLoadedTextures();
+
         // Draw all layers
         for (uint i = 0; i < mLayers.size(); i++)
         {
             mLayers[i]->second->draw();
         }
 
+        // Submit what elements have enqueued
+        mupAssetManager->getRenderQueue()->flush(getWindowWidth(), getWindowHeight());
+
         // Render resize blend
         if (mResizing)
         {
             glm::mat4 matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f);
             mpResizeBlend->bind();
-            mpResizeBlend->getShader()->fillValue("matrix", matrix);
-            mpResizeBlend->getShader()->fillValue("color", RESIZE_BLEND_COLOR);
-            // mpResizeBlend->getShader()->fillValue("alpha", 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
-            mpResizeBlend->getShader()->fillValue("alpha", 1.0f); // Without animation
+            mpResizeBlend->getShader()->fillValue(ShaderUniform::MATRIX, matrix);
+            mpResizeBlend->getShader()->fillValue(ShaderUniform::COLOR, RESIZE_BLEND_COLOR);
+            // mpResizeBlend->getShader()->fillValue(ShaderUniform::ALPHA, 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
+            mpResizeBlend->getShader()->fillValue(ShaderUniform::ALPHA, 1.0f); // Without animation
             mpResizeBlend->draw();
         }
 
@@ -342,6 +353,16 @@ namespace eyegui
         return mVectorGraphicsDPI;
     }
 
+    std::string GUI::getGraphicsCacheDirectory() const
+    {
+        return mGraphicsCacheDirectory;
+    }
+
+    std::string GUI::getLayoutCacheDirectory() const
+    {
+        return mLayoutCacheDirectory;
+    }
+
     float GUI::getSizeOfFont(FontSize fontSize) const
     {
         switch (fontSize)
@@ -47,7 +47,9 @@ namespace eyegui
             float fontMediumSize,
             float fontSmallSize,
             FontSize descriptionFontSize,
-			bool resizeInvisibleLayouts);
+			bool resizeInvisibleLayouts,
+            std::string graphicsCacheDirectory,
+            std::string layoutCacheDirectory);
 
         // Destructor
         virtual ~GUI();
@@ -119,6 +121,12 @@ namespace eyegui
         // Get dpi for rasterization of vector graphics
         float getVectorGraphicsDPI() const;
 
+        // Get directory of raster cache for vector graphics
+        std::string getGraphicsCacheDirectory() const;
+
+        // Get directory of cache for compiled layouts and bricks
+        std::string getLayoutCacheDirectory() const;
+
         // Get size for font
         float getSizeOfFont(FontSize fontSize) const;
 
@@ -244,6 +252,8 @@ namespace eyegui
         std::unique_ptr<GazeDrawer> mupGazeDrawer;
         bool mDrawGazeVisualization;
         float mVectorGraphicsDPI;
+        std::string mGraphicsCacheDirectory;
+        std::string mLayoutCacheDirectory;
         float mFontTallSize;
         float mFontMediumSize;
         float mFontSmallSize;
@@ -31,9 +31,12 @@ namespace eyegui
         mupMainFrame = std::unique_ptr<Frame>(new Frame(this, 0, 0, 1, 1));
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
         mForceResize = false;
+        mFullUpdateNecessary = true;
+        mDescriptionVisibility = mpGUI->getDescriptionVisibility();
 
-        // Parse style file
-        mupStyles = stylesheet_parser::parse(stylesheetFilepath);
+        // Copy styles of stylesheet, which is parsed only once for all layouts using it
+        mupStyles = std::unique_ptr<std::map<std::string, Style> >(
+            new std::map<std::string, Style>(*(mpAssetManager->fetchStylesheet(stylesheetFilepath))));
     }
 
     Layout::~Layout()
@@ -64,6 +67,11 @@ namespace eyegui
         // Update alpha
         mAlpha.update(tpf / getConfig()->animationDuration, !mVisible);
 
+        // Settled elements are skipped unless something affecting all elements has changed
+        DescriptionVisibility descriptionVisibility = getDescriptionVisibility();
+        mFullUpdateNecessary = mFullUpdateNecessary || mForceResize || (descriptionVisibility != mDescriptionVisibility);
+        mDescriptionVisibility = descriptionVisibility;
+
         // *** UPDATE FRAMES ***
 
         // Update root only if own alpha greater zero
@@ -109,6 +117,9 @@ namespace eyegui
 
             // Update main frame
             mupMainFrame->update(tpf, mAlpha.getValue(), pInput, mForceResize);
+
+            // Full update is done
+            mFullUpdateNecessary = false;
         }
 
         // Reset force resize
@@ -191,6 +202,11 @@ namespace eyegui
         return mpGUI->getAccPeriodicTime();
     }
 
+    bool Layout::isFullUpdateNecessary() const
+    {
+        return mFullUpdateNecessary;
+    }
+
     Style const * Layout::getStyleFromStylesheet(std::string styleName) const
     {
         // Search for style
@@ -439,6 +455,36 @@ namespace eyegui
         }
     }
 
+    void Layout::setImageOfPicture(std::string id, std::string filepath, ImageAlignment alignment)
+    {
+        Picture* pPicture = toPicture(fetchElement(id));
+        if (pPicture != NULL)
+        {
+            pPicture->setImage(filepath, alignment);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find picture with id: " + id);
+        }
+    }
+
+    void Layout::setAppearanceOfBlock(
+        std::string id,
+        bool consumeInput,
+        std::string backgroundFilepath,
+        ImageAlignment backgroundAlignment)
+    {
+        Block* pBlock = toBlock(fetchElement(id));
+        if (pBlock != NULL)
+        {
+            pBlock->setAppearance(consumeInput, backgroundFilepath, backgroundAlignment);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find block with id: " + id);
+        }
+    }
+
     void Layout::setImageOfPicture(
         std::string id,
         std::string name,
@@ -969,6 +1015,36 @@ namespace eyegui
         }
     }
 
+    void Layout::setValueOfStyleAttribute(std::string styleName, StyleColor attribute, glm::vec4 color)
+    {
+        // Check, whether style exists
+        auto it = mupStyles->find(styleName);
+
+        if (it != mupStyles->end())
+        {
+            stylesheet_parser::fillValue(it->second, attribute, color);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find style with name: " + styleName);
+        }
+    }
+
+    void Layout::setValueOfStyleAttribute(std::string styleName, StyleValue attribute, float value)
+    {
+        // Check, whether style exists
+        auto it = mupStyles->find(styleName);
+
+        if (it != mupStyles->end())
+        {
+            stylesheet_parser::fillValue(it->second, attribute, value);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find style with name: " + styleName);
+        }
+    }
+
     void Layout::replaceElementWithBlock(
         std::string id,
         bool consumeInput,
@@ -977,7 +1053,14 @@ namespace eyegui
         bool fade)
     {
         Element* pElement = fetchElement(id);
-        if (pElement != NULL)
+
+        // Block without fading is changed in place, as replacing would only rebuild the same
+        Block* pTargetBlock = toBlock(pElement);
+        if (pTargetBlock != NULL && !fade)
+        {
+            pTargetBlock->setAppearance(consumeInput, backgroundFilepath, backgroundAlignment);
+        }
+        else if (pElement != NULL)
         {
             // Create new block
             std::unique_ptr<Block> upBlock = std::unique_ptr<Block>(new Block(
@@ -1014,7 +1097,14 @@ namespace eyegui
     void Layout::replaceElementWithPicture(std::string id, std::string filepath, ImageAlignment alignment, bool fade)
     {
         Element* pElement = fetchElement(id);
-        if (pElement != NULL)
+
+        // Picture without fading is changed in place, as replacing would only rebuild the same
+        Picture* pTargetPicture = toPicture(pElement);
+        if (pTargetPicture != NULL && !fade)
+        {
+            pTargetPicture->setImage(filepath, alignment);
+        }
+        else if (pElement != NULL)
         {
             // Create new picture
             std::unique_ptr<Picture> upPicture = std::unique_ptr<Picture>(new Picture(
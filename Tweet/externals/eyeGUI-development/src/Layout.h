@@ -78,6 +78,9 @@ namespace eyegui
         // Get time from GUI
         float getAccPeriodicTime() const;
 
+        // Check whether all elements have to be updated in current frame, even settled ones
+        bool isFullUpdateNecessary() const;
+
         // Get pointer to styles of this layout. Returns NULL if not found
         Style const * getStyleFromStylesheet(std::string styleName) const;
 
@@ -139,6 +142,16 @@ namespace eyegui
             unsigned char const * pIconData,
             bool flipY);
 
+        // Set image of picture from file
+        void setImageOfPicture(std::string id, std::string filepath, ImageAlignment alignment);
+
+        // Set appearance of block
+        void setAppearanceOfBlock(
+            std::string id,
+            bool consumeInput,
+            std::string backgroundFilepath,
+            ImageAlignment backgroundAlignment);
+
         // Set image of picture
         void setImageOfPicture(
             std::string id,
@@ -241,6 +254,12 @@ namespace eyegui
         // Change value of style attribute
         void setValueOfStyleAttribute(std::string styleName, std::string attribute, std::string value);
 
+        // Change color of style attribute
+        void setValueOfStyleAttribute(std::string styleName, StyleColor attribute, glm::vec4 color);
+
+        // Change value of style attribute
+        void setValueOfStyleAttribute(std::string styleName, StyleValue attribute, float value);
+
         // Replace any element with block
         void replaceElementWithBlock(
             std::string id,
@@ -371,6 +390,8 @@ namespace eyegui
         InteractiveElement* mpSelectedInteractiveElement;
         std::unique_ptr<NotificationQueue> mupNotificationQueue;
         bool mForceResize;
+        bool mFullUpdateNecessary;
+        DescriptionVisibility mDescriptionVisibility; // visibility at last update
     };
 }
 
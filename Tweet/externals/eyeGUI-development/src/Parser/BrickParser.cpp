@@ -23,16 +23,11 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
-            {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
-            }
+            // Read file, compiled only once and kept by asset manager
+            CompiledMarkup const * pMarkup = pAssetManager->fetchMarkup(filepath);
 
             // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
+            CompiledMarkup::Node const * xmlElement = pMarkup != NULL ? pMarkup->getRoot() : NULL;
 
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
@@ -0,0 +1,292 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "CompiledMarkup.h"
+
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+
+namespace eyegui
+{
+    // Header of compiled markup file, followed by string lengths, string
+    // characters, nodes and attributes
+    namespace
+    {
+        const char FILE_MAGIC[4] = { 'E', 'G', 'M', 'C' };
+        const std::uint32_t FILE_VERSION = 1;
+
+        struct FileHeader
+        {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t stringCount;
+            std::uint32_t characterCount;
+            std::uint32_t nodeCount;
+            std::uint32_t attributeCount;
+        };
+
+        // Node as stored in file
+        struct FileNode
+        {
+            std::uint32_t name;
+            std::uint32_t firstAttribute;
+            std::uint32_t attributeCount;
+            std::int32_t firstChild;
+            std::int32_t nextSibling;
+        };
+    }
+
+    const std::string& CompiledMarkup::Node::getName() const
+    {
+        return mpMarkup->mStrings[mName];
+    }
+
+    CompiledMarkup::Node const * CompiledMarkup::Node::getFirstChild() const
+    {
+        return mFirstChild < 0 ? NULL : &(mpMarkup->mNodes[mFirstChild]);
+    }
+
+    CompiledMarkup::Node const * CompiledMarkup::Node::getNextSibling() const
+    {
+        return mNextSibling < 0 ? NULL : &(mpMarkup->mNodes[mNextSibling]);
+    }
+
+    std::string const * CompiledMarkup::Node::findAttribute(const std::string& rName) const
+    {
+        for (std::uint32_t i = mFirstAttribute; i < mFirstAttribute + mAttributeCount; i++)
+        {
+            const auto& rAttribute = mpMarkup->mAttributes[i];
+            if (mpMarkup->mStrings[rAttribute.first] == rName)
+            {
+                return &(mpMarkup->mStrings[rAttribute.second]);
+            }
+        }
+        return NULL;
+    }
+
+    CompiledMarkup::CompiledMarkup(const tinyxml2::XMLDocument& rDocument)
+    {
+        tinyxml2::XMLElement const * xmlRoot = rDocument.FirstChildElement();
+        if (xmlRoot != NULL)
+        {
+            std::map<std::string, std::uint32_t> stringIds;
+            compileElement(xmlRoot, stringIds);
+        }
+    }
+
+    CompiledMarkup::CompiledMarkup()
+    {
+        // Nothing to do
+    }
+
+    std::unique_ptr<CompiledMarkup> CompiledMarkup::readFromFile(std::string filepath)
+    {
+        std::ifstream in(filepath.c_str(), std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return NULL;
+        }
+        std::uint64_t fileSize = (std::uint64_t)in.tellg();
+        in.seekg(0);
+
+        // Read and validate header
+        FileHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(FileHeader));
+        if (!in
+            || std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0
+            || header.version != FILE_VERSION)
+        {
+            return NULL;
+        }
+
+        // Counts must fit into file, so corrupted ones do not lead to huge allocations
+        std::uint64_t arraysSize =
+            (std::uint64_t)header.stringCount * sizeof(std::uint32_t)
+            + (std::uint64_t)header.characterCount
+            + (std::uint64_t)header.nodeCount * sizeof(FileNode)
+            + (std::uint64_t)header.attributeCount * sizeof(std::pair<std::uint32_t, std::uint32_t>);
+        if (arraysSize > fileSize - sizeof(FileHeader))
+        {
+            return NULL;
+        }
+
+        // Read arrays in one go each
+        std::vector<std::uint32_t> lengths(header.stringCount);
+        std::vector<char> characters(header.characterCount);
+        std::vector<FileNode> nodes(header.nodeCount);
+        std::vector<std::pair<std::uint32_t, std::uint32_t> > attributes(header.attributeCount);
+        in.read(reinterpret_cast<char*>(lengths.data()), lengths.size() * sizeof(std::uint32_t));
+        in.read(characters.data(), characters.size());
+        in.read(reinterpret_cast<char*>(nodes.data()), nodes.size() * sizeof(FileNode));
+        in.read(reinterpret_cast<char*>(attributes.data()), attributes.size() * sizeof(std::pair<std::uint32_t, std::uint32_t>));
+        if (!in)
+        {
+            return NULL;
+        }
+
+        // Validate everything refers to something existing, so markup can be used without further checks
+        std::unique_ptr<CompiledMarkup> upMarkup = std::unique_ptr<CompiledMarkup>(new CompiledMarkup());
+        std::uint32_t offset = 0;
+        for (std::uint32_t length : lengths)
+        {
+            if (length > characters.size() - offset)
+            {
+                return NULL;
+            }
+            upMarkup->mStrings.push_back(std::string(characters.data() + offset, length));
+            offset += length;
+        }
+        for (const auto& rAttribute : attributes)
+        {
+            if (rAttribute.first >= header.stringCount || rAttribute.second >= header.stringCount)
+            {
+                return NULL;
+            }
+        }
+        upMarkup->mNodes.resize(header.nodeCount);
+        for (std::uint32_t i = 0; i < header.nodeCount; i++)
+        {
+            // Children and siblings always come later in pre-order, which excludes cycles
+            const FileNode& rFileNode = nodes[i];
+            if (rFileNode.name >= header.stringCount
+                || rFileNode.firstAttribute > header.attributeCount
+                || rFileNode.attributeCount > header.attributeCount - rFileNode.firstAttribute
+                || (rFileNode.firstChild >= 0 && ((std::uint32_t)rFileNode.firstChild <= i || (std::uint32_t)rFileNode.firstChild >= header.nodeCount))
+                || (rFileNode.nextSibling >= 0 && ((std::uint32_t)rFileNode.nextSibling <= i || (std::uint32_t)rFileNode.nextSibling >= header.nodeCount)))
+            {
+                return NULL;
+            }
+
+            Node& rNode = upMarkup->mNodes[i];
+            rNode.mpMarkup = upMarkup.get();
+            rNode.mName = rFileNode.name;
+            rNode.mFirstAttribute = rFileNode.firstAttribute;
+            rNode.mAttributeCount = rFileNode.attributeCount;
+            rNode.mFirstChild = rFileNode.firstChild < 0 ? -1 : rFileNode.firstChild;
+            rNode.mNextSibling = rFileNode.nextSibling < 0 ? -1 : rFileNode.nextSibling;
+        }
+        upMarkup->mAttributes = std::move(attributes);
+
+        return upMarkup;
+    }
+
+    bool CompiledMarkup::writeToFile(std::string filepath) const
+    {
+        // Collect strings
+        std::vector<std::uint32_t> lengths;
+        std::vector<char> characters;
+        for (const std::string& rString : mStrings)
+        {
+            lengths.push_back((std::uint32_t)rString.size());
+            characters.insert(characters.end(), rString.begin(), rString.end());
+        }
+
+        // Collect nodes
+        std::vector<FileNode> nodes;
+        for (const Node& rNode : mNodes)
+        {
+            FileNode fileNode;
+            fileNode.name = rNode.mName;
+            fileNode.firstAttribute = rNode.mFirstAttribute;
+            fileNode.attributeCount = rNode.mAttributeCount;
+            fileNode.firstChild = rNode.mFirstChild;
+            fileNode.nextSibling = rNode.mNextSibling;
+            nodes.push_back(fileNode);
+        }
+
+        // Write to temporary file first, so no other process reads incomplete markup
+        std::string temporaryFilepath = filepath + ".tmp";
+        {
+            std::ofstream out(temporaryFilepath.c_str(), std::ios::binary);
+            if (!out)
+            {
+                return false;
+            }
+            FileHeader header;
+            std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+            header.version = FILE_VERSION;
+            header.stringCount = (std::uint32_t)lengths.size();
+            header.characterCount = (std::uint32_t)characters.size();
+            header.nodeCount = (std::uint32_t)nodes.size();
+            header.attributeCount = (std::uint32_t)mAttributes.size();
+            out.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+            out.write(reinterpret_cast<const char*>(lengths.data()), lengths.size() * sizeof(std::uint32_t));
+            out.write(characters.data(), characters.size());
+            out.write(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(FileNode));
+            out.write(reinterpret_cast<const char*>(mAttributes.data()), mAttributes.size() * sizeof(std::pair<std::uint32_t, std::uint32_t>));
+            if (!out)
+            {
+                out.close();
+                std::remove(temporaryFilepath.c_str());
+                return false;
+            }
+        }
+        std::remove(filepath.c_str()); // rename does not replace existing files on every platform
+        return std::rename(temporaryFilepath.c_str(), filepath.c_str()) == 0;
+    }
+
+    CompiledMarkup::Node const * CompiledMarkup::getRoot() const
+    {
+        return mNodes.empty() ? NULL : &(mNodes[0]);
+    }
+
+    std::int32_t CompiledMarkup::compileElement(tinyxml2::XMLElement const * xmlElement, std::map<std::string, std::uint32_t>& rStringIds)
+    {
+        // Append node, vector may grow later so use index only
+        std::int32_t index = (std::int32_t)mNodes.size();
+        Node node;
+        node.mpMarkup = this;
+        node.mName = internString(xmlElement->Value(), rStringIds);
+        node.mFirstAttribute = (std::uint32_t)mAttributes.size();
+        node.mAttributeCount = 0;
+        node.mFirstChild = -1;
+        node.mNextSibling = -1;
+
+        // Attributes of node are stored next to each other
+        for (tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FirstAttribute(); xmlAttribute != NULL; xmlAttribute = xmlAttribute->Next())
+        {
+            mAttributes.push_back(
+                std::make_pair(
+                    internString(xmlAttribute->Name(), rStringIds),
+                    internString(xmlAttribute->Value(), rStringIds)));
+            node.mAttributeCount++;
+        }
+        mNodes.push_back(node);
+
+        // Children
+        std::int32_t previousChild = -1;
+        for (tinyxml2::XMLElement const * xmlChild = xmlElement->FirstChildElement(); xmlChild != NULL; xmlChild = xmlChild->NextSiblingElement())
+        {
+            std::int32_t child = compileElement(xmlChild, rStringIds);
+            if (previousChild < 0)
+            {
+                mNodes[index].mFirstChild = child;
+            }
+            else
+            {
+                mNodes[previousChild].mNextSibling = child;
+            }
+            previousChild = child;
+        }
+
+        return index;
+    }
+
+    std::uint32_t CompiledMarkup::internString(const std::string& rString, std::map<std::string, std::uint32_t>& rStringIds)
+    {
+        auto it = rStringIds.find(rString);
+        if (it != rStringIds.end())
+        {
+            return it->second;
+        }
+        std::uint32_t id = (std::uint32_t)mStrings.size();
+        mStrings.push_back(rString);
+        rStringIds[rString] = id;
+        return id;
+    }
+}
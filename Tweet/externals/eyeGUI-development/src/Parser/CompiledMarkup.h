@@ -0,0 +1,95 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Element tree of a layout or brick file in compact form. Compiled once from
+// XML, it can be written to and read from a binary file, so element parser
+// instantiates elements without parsing XML again. Names and attribute values
+// are kept in a table of unique strings, nodes refer to them by index.
+
+#ifndef COMPILED_MARKUP_H_
+#define COMPILED_MARKUP_H_
+
+#include "src/Defines.h"
+
+#include "externals/TinyXML2/tinyxml2.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <cstdint>
+
+namespace eyegui
+{
+    class CompiledMarkup
+    {
+    public:
+
+        // Node of element tree
+        class Node
+        {
+        public:
+
+            // Name of element
+            const std::string& getName() const;
+
+            // Get first child, NULL if none
+            Node const * getFirstChild() const;
+
+            // Get next sibling, NULL if none
+            Node const * getNextSibling() const;
+
+            // Find value of attribute, NULL if not there
+            std::string const * findAttribute(const std::string& rName) const;
+
+        private:
+
+            friend class CompiledMarkup;
+
+            // Members
+            CompiledMarkup const * mpMarkup;
+            std::uint32_t mName;
+            std::uint32_t mFirstAttribute;
+            std::uint32_t mAttributeCount;
+            std::int32_t mFirstChild; // -1 if none
+            std::int32_t mNextSibling; // -1 if none
+        };
+
+        // Compile first element of parsed XML document and its children
+        CompiledMarkup(const tinyxml2::XMLDocument& rDocument);
+
+        // Read compiled markup from file. Returns NULL if file is missing or invalid
+        static std::unique_ptr<CompiledMarkup> readFromFile(std::string filepath);
+
+        // Write compiled markup to file. Returns whether successful
+        bool writeToFile(std::string filepath) const;
+
+        // Get root element, NULL if document has no element
+        Node const * getRoot() const;
+
+    private:
+
+        // Empty markup to be filled from file
+        CompiledMarkup();
+
+        // Nodes point to markup, so it must not be copied
+        CompiledMarkup(const CompiledMarkup&);
+        CompiledMarkup& operator=(const CompiledMarkup&);
+
+        // Append element and its children, returns index of element
+        std::int32_t compileElement(tinyxml2::XMLElement const * xmlElement, std::map<std::string, std::uint32_t>& rStringIds);
+
+        // Get index of string, adding it if not yet in table
+        std::uint32_t internString(const std::string& rString, std::map<std::string, std::uint32_t>& rStringIds);
+
+        // Members
+        std::vector<std::string> mStrings;
+        std::vector<Node> mNodes; // in pre-order, first one is root
+        std::vector<std::pair<std::uint32_t, std::uint32_t> > mAttributes; // index of name and value
+    };
+}
+
+#endif // COMPILED_MARKUP_H_
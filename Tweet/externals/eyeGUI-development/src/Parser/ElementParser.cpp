@@ -11,11 +11,13 @@
 #include "Layout.h"
 #include "src/Utilities/OperationNotifier.h"
 
+#include <cstdlib>
+
 namespace eyegui
 {
     namespace element_parser
     {
-        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
+        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, CompiledMarkup::Node const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
         {
             // Create map for ids
             std::unique_ptr<idMap> upIdMap = std::unique_ptr<idMap>(new std::map<std::string, Element*>);
@@ -32,7 +34,7 @@ namespace eyegui
             return std::move(upPair);
         }
 
-        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, CompiledMarkup::Node const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Name of style of element (if xmlElement == NULL, get style of parent if available)
             std::string styleName = parseStyleName(xmlElement, pParent, pLayout->getNamesOfAvailableStyles(), filepath);
@@ -68,7 +70,7 @@ namespace eyegui
             // Adaptive scaling
             bool adaptiveScaling = parseBoolAttribute("adaptivescaling", xmlElement);
 
-            std::string value = std::string(xmlElement->Value());
+            std::string value = xmlElement->getName();
             if (value == "grid")
             {
                 upElement = std::move(parseGrid(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
@@ -123,7 +125,7 @@ namespace eyegui
             }
             else
             {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + std::string(xmlElement->Value()), filepath);
+                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + xmlElement->getName(), filepath);
             }
 
             // Return element, but save id before
@@ -138,7 +140,7 @@ namespace eyegui
             }
         }
 
-        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlGrid, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlGrid, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Fetch values for block from xml
             bool consumeInput;
@@ -151,7 +153,7 @@ namespace eyegui
             bool showBackground = parseBoolAttribute("showbackground", xmlGrid);
 
             // Get first row
-            tinyxml2::XMLElement const * xmlRow = xmlGrid->FirstChildElement();
+            CompiledMarkup::Node const * xmlRow = xmlGrid->getFirstChild();
             if (!validateElement(xmlRow, "row"))
             {
                 throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
@@ -159,13 +161,13 @@ namespace eyegui
 
             // Count of rows
             int rows = 0;
-            tinyxml2::XMLElement const * xmlRowCounter = xmlRow;
+            CompiledMarkup::Node const * xmlRowCounter = xmlRow;
 
             while (xmlRowCounter != NULL)
             {
                 // Checking whether it is really a row element is done later
                 rows++;
-                xmlRowCounter = xmlRowCounter->NextSiblingElement();
+                xmlRowCounter = xmlRowCounter->getNextSibling();
             }
 
             // Create grid
@@ -193,7 +195,7 @@ namespace eyegui
             for (int i = 0; i < rows; i++)
             {
                 // Get first column
-                tinyxml2::XMLElement const * xmlColumn = xmlRow->FirstChildElement();
+                CompiledMarkup::Node const * xmlColumn = xmlRow->getFirstChild();
                 if (!validateElement(xmlColumn, "column"))
                 {
                     throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
@@ -201,13 +203,13 @@ namespace eyegui
 
                 // Get column count
                 int columns = 0;
-                tinyxml2::XMLElement const * xmlColumnCounter = xmlColumn;
+                CompiledMarkup::Node const * xmlColumnCounter = xmlColumn;
 
                 while (xmlColumnCounter != NULL)
                 {
                     // Checking whether it is really a column element is done later
                     columns++;
-                    xmlColumnCounter = xmlColumnCounter->NextSiblingElement();
+                    xmlColumnCounter = xmlColumnCounter->getNextSibling();
                 }
 
                 // Tell grid about column count
@@ -223,11 +225,11 @@ namespace eyegui
                     upGrid->setRelativeWidthOfCell(i, j, parsePercentAttribute("size", xmlColumn));
 
                     // Determine element in cell
-                    tinyxml2::XMLElement const * xmlElement = xmlColumn->FirstChildElement();
+                    CompiledMarkup::Node const * xmlElement = xmlColumn->getFirstChild();
                     upGrid->attachElement(i, j, std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upGrid.get(), filepath, rIdMapper, rIdMap)));
 
                     // Get column sibling if necessary
-                    xmlColumn = xmlColumn->NextSiblingElement();
+                    xmlColumn = xmlColumn->getNextSibling();
                     if (j < columns - 1)
                     {
                         if (!validateElement(xmlColumn, "column"))
@@ -245,7 +247,7 @@ namespace eyegui
                 }
 
                 // Get row sibling if necessary
-                xmlRow = xmlRow->NextSiblingElement();
+                xmlRow = xmlRow->getNextSibling();
                 if (i < rows - 1)
                 {
                     if (!validateElement(xmlRow, "row"))
@@ -272,14 +274,14 @@ namespace eyegui
             return std::move(upGrid);
         }
 
-        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlank, Element* pParent, std::string filepath)
+        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlBlank, Element* pParent, std::string filepath)
         {
             // Create and return blank
             std::unique_ptr<Blank> upBlank = std::unique_ptr<Blank>(new Blank(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
             return (std::move(upBlank));
         }
 
-        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlBlock, Element* pParent, std::string filepath)
         {
             // Fetch values for block from xml
             bool consumeInput;
@@ -309,7 +311,7 @@ namespace eyegui
             return (std::move(upBlock));
         }
 
-        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlPicture, Element* pParent, std::string filepath)
+        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlPicture, Element* pParent, std::string filepath)
         {
             // Get full path to image file
             std::string imageFilepath = parseStringAttribute("src", xmlPicture);
@@ -339,7 +341,7 @@ namespace eyegui
             return (std::move(upPicture));
         }
 
-        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlStack, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlStack, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Fetch values for block from xml
             bool consumeInput;
@@ -430,21 +432,21 @@ namespace eyegui
                     separator));
 
             // Insert elements
-            tinyxml2::XMLElement const * xmlElement = xmlStack->FirstChildElement();
+            CompiledMarkup::Node const * xmlElement = xmlStack->getFirstChild();
             while (xmlElement != NULL)
             {
                 // Fetch element
                 upStack->attachElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upStack.get(), filepath, rIdMapper, rIdMap)));
 
                 // Try to get next sibling element
-                xmlElement = xmlElement->NextSiblingElement();
+                xmlElement = xmlElement->getNextSibling();
             }
 
             // Return stack
             return (std::move(upStack));
         }
 
-        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlTextBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlTextBlock, Element* pParent, std::string filepath)
         {
             // Fetch values for block from xml
             bool consumeInput;
@@ -539,7 +541,7 @@ namespace eyegui
             return std::move(upTextBlock);
         }
 
-        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlCircleButton, Element* pParent, std::string filepath)
+        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlCircleButton, Element* pParent, std::string filepath)
         {
             // Extract filepath
             std::string iconFilepath = parseStringAttribute("icon", xmlCircleButton);
@@ -559,7 +561,7 @@ namespace eyegui
             return (std::move(upCircleButton));
         }
 
-        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBoxButton, Element* pParent, std::string filepath)
+        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlBoxButton, Element* pParent, std::string filepath)
         {
             // Extract filepath
             std::string iconFilepath = parseStringAttribute("icon", xmlBoxButton);
@@ -579,7 +581,7 @@ namespace eyegui
             return (std::move(upBoxButton));
         }
 
-        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlSensor, Element* pParent, std::string filepath)
+        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlSensor, Element* pParent, std::string filepath)
         {
             // Extract filepath
             std::string iconFilepath = parseStringAttribute("icon", xmlSensor);
@@ -596,7 +598,7 @@ namespace eyegui
             return (std::move(upSensor));
         }
 
-        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlDropButton, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlDropButton, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Extract filepath
             std::string iconFilepath = parseStringAttribute("icon", xmlDropButton);
@@ -617,13 +619,13 @@ namespace eyegui
             std::unique_ptr<DropButton> upDropButton = std::unique_ptr<DropButton>(new DropButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, desc, descKey, space));
 
             // Attach inner element
-            tinyxml2::XMLElement const * xmlElement = xmlDropButton->FirstChildElement();
+            CompiledMarkup::Node const * xmlElement = xmlDropButton->getFirstChild();
 
             if (xmlElement == NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "DropButton has no inner element", filepath);
             }
-            else if (xmlElement->NextSiblingElement() != NULL)
+            else if (xmlElement->getNextSibling() != NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "DropButton has more than one inner element", filepath);
             }
@@ -640,14 +642,14 @@ namespace eyegui
             return (std::move(upDropButton));
         }
 
-        std::unique_ptr<Keyboard> parseKeyboard(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlKeyboard, Element* pParent, std::string filepath)
+        std::unique_ptr<Keyboard> parseKeyboard(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlKeyboard, Element* pParent, std::string filepath)
         {
             // Create and return keyboard
             std::unique_ptr<Keyboard> upKeyboard = std::unique_ptr<Keyboard>(new Keyboard(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
             return (std::move(upKeyboard));
         }
 
-        std::unique_ptr<WordSuggest> parseWordSuggest(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlWordSuggest, Element* pParent, std::string filepath)
+        std::unique_ptr<WordSuggest> parseWordSuggest(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlWordSuggest, Element* pParent, std::string filepath)
         {
             // Get font size
             FontSize fontSize;
@@ -658,7 +660,7 @@ namespace eyegui
             return (std::move(upWordSuggest));
         }
 
-        std::unique_ptr<Flow> parseFlow(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlFlow, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Flow> parseFlow(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledMarkup::Node const * xmlFlow, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Fetch values for block from xml
             bool consumeInput;
@@ -712,13 +714,13 @@ namespace eyegui
                     space));
 
             // Attach inner element
-            tinyxml2::XMLElement const * xmlElement = xmlFlow->FirstChildElement();
+            CompiledMarkup::Node const * xmlElement = xmlFlow->getFirstChild();
 
             if (xmlElement == NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Flow has no inner element", filepath);
             }
-            else if (xmlElement->NextSiblingElement() != NULL)
+            else if (xmlElement->getNextSibling() != NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Flow has more than one inner element", filepath);
             }
@@ -729,7 +731,7 @@ namespace eyegui
             return (std::move(upFlow));
         }
 
-        void blockHelper(tinyxml2::XMLElement const * xmlBlock, bool& rConsumeInput, std::string& rBackgroundFilepath, ImageAlignment& rBackgroundAlignment, float& rInnerBorder)
+        void blockHelper(CompiledMarkup::Node const * xmlBlock, bool& rConsumeInput, std::string& rBackgroundFilepath, ImageAlignment& rBackgroundAlignment, float& rInnerBorder)
         {
             rConsumeInput = parseBoolAttribute("consumeinput", xmlBlock);
             rBackgroundFilepath = parseStringAttribute("backgroundsrc", xmlBlock);
@@ -765,7 +767,7 @@ namespace eyegui
             rInnerBorder = parsePercentAttribute("innerborder", xmlBlock);
         }
 
-        void fontSizeHelper(tinyxml2::XMLElement const * xmlElement, FontSize& rFontSize, std::string filepath)
+        void fontSizeHelper(CompiledMarkup::Node const * xmlElement, FontSize& rFontSize, std::string filepath)
         {
             std::string fontSizeValue = parseStringAttribute("fontsize", xmlElement);
             if (fontSizeValue == EMPTY_STRING_ATTRIBUTE || fontSizeValue == "medium")
@@ -786,7 +788,7 @@ namespace eyegui
             }
         }
 
-        void localizationHelper(tinyxml2::XMLElement const * xmlElement, std::string contentAttribute, std::string keyAttribute, std::u16string& rContent, std::string& rKey)
+        void localizationHelper(CompiledMarkup::Node const * xmlElement, std::string contentAttribute, std::string keyAttribute, std::u16string& rContent, std::string& rKey)
         {
             // Get content
             std::string contentValue = parseStringAttribute(contentAttribute, xmlElement);
@@ -801,16 +803,16 @@ namespace eyegui
             rKey = parseStringAttribute(keyAttribute, xmlElement);
         }
 
-        bool validateElement(tinyxml2::XMLElement const * xmlElement, const std::string& rExpectedValue)
+        bool validateElement(CompiledMarkup::Node const * xmlElement, const std::string& rExpectedValue)
         {
-            if (xmlElement == NULL || std::string(xmlElement->Value()).compare(rExpectedValue) != 0)
+            if (xmlElement == NULL || xmlElement->getName().compare(rExpectedValue) != 0)
             {
                 return false;
             }
             return true;
         }
 
-        float parseRelativeScale(tinyxml2::XMLElement const * xmlElement)
+        float parseRelativeScale(CompiledMarkup::Node const * xmlElement)
         {
             if (xmlElement == NULL)
             {
@@ -830,7 +832,7 @@ namespace eyegui
             }
         }
 
-        std::string parseStyleName(tinyxml2::XMLElement const * xmlElement, Element const * pParent, const std::set<std::string>& rNamesOfAvailableStyles, std::string filepath)
+        std::string parseStyleName(CompiledMarkup::Node const * xmlElement, Element const * pParent, const std::set<std::string>& rNamesOfAvailableStyles, std::string filepath)
         {
             if (xmlElement == NULL)
             {
@@ -873,12 +875,12 @@ namespace eyegui
             }
         }
 
-        std::string parseStringAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, std::string fallback)
+        std::string parseStringAttribute(std::string attributeName, CompiledMarkup::Node const * xmlElement, std::string fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            std::string const * pValue = xmlElement->findAttribute(attributeName);
+            if (pValue != NULL)
             {
-                return xmlAttribute->Value();
+                return *pValue;
             }
             else
             {
@@ -886,12 +888,12 @@ namespace eyegui
             }
         }
 
-        bool parseBoolAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, bool fallback)
+        bool parseBoolAttribute(std::string attributeName, CompiledMarkup::Node const * xmlElement, bool fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            std::string const * pValue = xmlElement->findAttribute(attributeName);
+            if (pValue != NULL)
             {
-                std::string value = xmlAttribute->Value();
+                std::string value = *pValue;
 
                 // File format case is not relevant
                 std::transform(value.begin(), value.end(), value.begin(), ::tolower);
@@ -904,12 +906,12 @@ namespace eyegui
             }
         }
 
-        int parseIntAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, int fallback)
+        int parseIntAttribute(std::string attributeName, CompiledMarkup::Node const * xmlElement, int fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            std::string const * pValue = xmlElement->findAttribute(attributeName);
+            if (pValue != NULL)
             {
-                return xmlAttribute->IntValue();
+                return std::atoi(pValue->c_str());
             }
             else
             {
@@ -917,12 +919,12 @@ namespace eyegui
             }
         }
 
-        float parsePercentAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, float fallback)
+        float parsePercentAttribute(std::string attributeName, CompiledMarkup::Node const * xmlElement, float fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            std::string const * pValue = xmlElement->findAttribute(attributeName);
+            if (pValue != NULL)
             {
-                std::string value = xmlAttribute->Value();
+                std::string value = *pValue;
                 std::string delimiter = "%";
                 std::string token = value.substr(0, value.find(delimiter));
                 return (std::stof(token) / 100.0f);
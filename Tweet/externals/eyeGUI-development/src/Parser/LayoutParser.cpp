@@ -25,16 +25,11 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
-            {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
-            }
+            // Read file, compiled only once and kept by asset manager
+            CompiledMarkup const * pMarkup = pAssetManager->fetchMarkup(filepath);
 
             // First xml element should be a layout
-            tinyxml2::XMLElement* xmlLayout = doc.FirstChildElement();
+            CompiledMarkup::Node const * xmlLayout = pMarkup != NULL ? pMarkup->getRoot() : NULL;
             if (!element_parser::validateElement(xmlLayout, "layout"))
             {
                 throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
@@ -47,7 +42,7 @@ namespace eyegui
             std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, stylesheetFilepath));
 
             // Then there should be an element
-            tinyxml2::XMLElement* xmlRoot = xmlLayout->FirstChildElement();
+            CompiledMarkup::Node const * xmlRoot = xmlLayout->getFirstChild();
 
             // Check for existence
             if (xmlRoot == NULL)
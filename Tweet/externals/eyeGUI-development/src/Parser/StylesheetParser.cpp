@@ -231,58 +231,91 @@ namespace eyegui
 
         void fillValue(Style& rStyle, std::string attribute, std::string value)
         {
-            // Assign value to correct field of struct
-            if (attribute == "color")
-            {
-                rStyle.color = parseColor(value);
-            }
-            else if (attribute == "background-color")
-            {
-                rStyle.backgroundColor = parseColor(value);
-            }
-            else if (attribute == "highlight-color")
-            {
-                rStyle.highlightColor = parseColor(value);
-            }
-            else if (attribute == "separator-color")
-            {
-                rStyle.separatorColor = parseColor(value);
-            }
-            else if (attribute == "selection-color")
+            // Names of attributes are resolved once into typed attributes
+            static const std::map<std::string, StyleColor> colorAttributes =
             {
-                rStyle.selectionColor = parseColor(value);
-            }
-            else if (attribute == "icon-color")
-            {
-                rStyle.iconColor = parseColor(value);
-            }
-            else if (attribute == "font-color")
+                { "color", StyleColor::COLOR },
+                { "background-color", StyleColor::BACKGROUND_COLOR },
+                { "highlight-color", StyleColor::HIGHLIGHT_COLOR },
+                { "separator-color", StyleColor::SEPARATOR_COLOR },
+                { "selection-color", StyleColor::SELECTION_COLOR },
+                { "icon-color", StyleColor::ICON_COLOR },
+                { "font-color", StyleColor::FONT_COLOR },
+                { "dim-color", StyleColor::DIM_COLOR },
+                { "mark-color", StyleColor::MARK_COLOR },
+                { "pick-color", StyleColor::PICK_COLOR },
+                { "threshold-color", StyleColor::THRESHOLD_COLOR }
+            };
+            static const std::map<std::string, StyleValue> valueAttributes =
             {
-                rStyle.fontColor = parseColor(value);
-            }
-            else if (attribute == "dim-color")
-            {
-                rStyle.dimColor = parseColor(value);
-            }
-			else if (attribute == "dim-alpha")
-			{
-				rStyle.dimAlpha = std::stof(value);
-			}
-            else if (attribute == "mark-color")
+                { "dim-alpha", StyleValue::DIM_ALPHA }
+            };
+
+            // Parse value by type of attribute
+            auto colorIt = colorAttributes.find(attribute);
+            if (colorIt != colorAttributes.end())
             {
-                rStyle.markColor = parseColor(value);
+                fillValue(rStyle, colorIt->second, parseColor(value));
+                return;
             }
-            else if (attribute == "pick-color")
+            auto valueIt = valueAttributes.find(attribute);
+            if (valueIt != valueAttributes.end())
             {
-                rStyle.pickColor = parseColor(value);
+                fillValue(rStyle, valueIt->second, std::stof(value));
+                return;
             }
-            else if (attribute == "threshold-color")
+            throwError(OperationNotifier::Operation::PARSING, "Unknown value on left side of '=': " + attribute, rStyle.filepath);
+        }
+
+        void fillValue(Style& rStyle, StyleColor attribute, glm::vec4 color)
+        {
+            // Assign color to correct field of struct
+            switch (attribute)
             {
-                rStyle.thresholdColor = parseColor(value);
+            case StyleColor::COLOR:
+                rStyle.color = color;
+                break;
+            case StyleColor::BACKGROUND_COLOR:
+                rStyle.backgroundColor = color;
+                break;
+            case StyleColor::HIGHLIGHT_COLOR:
+                rStyle.highlightColor = color;
+                break;
+            case StyleColor::SEPARATOR_COLOR:
+                rStyle.separatorColor = color;
+                break;
+            case StyleColor::SELECTION_COLOR:
+                rStyle.selectionColor = color;
+                break;
+            case StyleColor::ICON_COLOR:
+                rStyle.iconColor = color;
+                break;
+            case StyleColor::FONT_COLOR:
+                rStyle.fontColor = color;
+                break;
+            case StyleColor::DIM_COLOR:
+                rStyle.dimColor = color;
+                break;
+            case StyleColor::MARK_COLOR:
+                rStyle.markColor = color;
+                break;
+            case StyleColor::PICK_COLOR:
+                rStyle.pickColor = color;
+                break;
+            case StyleColor::THRESHOLD_COLOR:
+                rStyle.thresholdColor = color;
+                break;
             }
-            else
+        }
+
+        void fillValue(Style& rStyle, StyleValue attribute, float value)
+        {
+            // Assign value to correct field of struct
+            switch (attribute)
             {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown value on left side of '=': " + attribute, rStyle.filepath);
+            case StyleValue::DIM_ALPHA:
+                rStyle.dimAlpha = value;
+                break;
             }
         }
     }
@@ -25,8 +25,14 @@ namespace eyegui
         // Parses whole line and fills value in style struct
         void parseLine(std::string line, Style& rStyle);
 
-        // Fill value
+        // Fill value given as string like in stylesheet
         void fillValue(Style& rStyle, std::string attribute, std::string value);
+
+        // Fill typed color without parsing
+        void fillValue(Style& rStyle, StyleColor attribute, glm::vec4 color);
+
+        // Fill typed value without parsing
+        void fillValue(Style& rStyle, StyleValue attribute, float value);
     }
 }
 
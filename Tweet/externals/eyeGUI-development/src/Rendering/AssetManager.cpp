@@ -12,15 +12,18 @@
 #include "Shaders.h"
 #include "Meshes.h"
 #include "Graphics.h"
-#include "CharacterSets.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/Helper.h"
 #include "GUI.h"
 #include "Font/AtlasFont.h"
 #include "Font/EmptyFont.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Parser/StylesheetParser.h"
 
 #include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 
 namespace eyegui
 {
@@ -28,6 +31,7 @@ namespace eyegui
     {
         // Save members
         mpGUI = pGUI;
+        mupTextureLoader = std::unique_ptr<TextureLoader>(new TextureLoader(mpGUI->getGraphicsCacheDirectory()));
 
         // Initialize FreeType Library
         if (FT_Init_FreeType(&mFreeTypeLibrary))
@@ -40,6 +44,12 @@ namespace eyegui
 
     AssetManager::~AssetManager()
     {
+        // Get rid of render queue which may hold callbacks of elements
+        mupRenderQueue.reset();
+
+        // Stop workers before textures waiting for them are deleted
+        mupTextureLoader.reset();
+
         // Get rid of fonts first because they have to delete FreeType faces
         mFonts.clear();
 
@@ -91,7 +101,17 @@ namespace eyegui
         std::unique_ptr<Texture>& rupTexture = mTextures[filepath];
         Texture* pTexture = rupTexture.get();
 
-        if (pTexture == NULL)
+        if (pTexture != NULL)
+        {
+            // Count user and keep texture from eviction
+            TextureReference& rReference = mTextureReferences[pTexture];
+            if (rReference.count == 0)
+            {
+                mUnreferencedTextures.erase(std::remove(mUnreferencedTextures.begin(), mUnreferencedTextures.end(), pTexture), mUnreferencedTextures.end());
+            }
+            rReference.count++;
+        }
+        else
         {
             // Check for empty string
             if (filepath == "")
@@ -117,7 +137,8 @@ namespace eyegui
                 // Check token
                 if (input.compare("svg") == 0)
                 {
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI(), mupTextureLoader.get()));
+                    mPendingTextures.push_back(rupTexture.get());
                 }
                 else if (input.compare("png") == 0 || input.compare("jpg") == 0 || input.compare("jpeg") == 0 || input.compare("tga") == 0 || input.compare("bmp") == 0)
                 {
@@ -128,7 +149,8 @@ namespace eyegui
                         suspectedChannelCount = 4;
                     }
 
-                    rupTexture = std::unique_ptr<Texture>(new PixelTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, suspectedChannelCount));
+                    rupTexture = std::unique_ptr<Texture>(new PixelTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupTextureLoader.get(), suspectedChannelCount));
+                    mPendingTextures.push_back(rupTexture.get());
                 }
                 else
                 {
@@ -138,6 +160,11 @@ namespace eyegui
             }
             pTexture = rupTexture.get();
             mTextures[filepath] = std::move(rupTexture);
+
+            // First user
+            TextureReference& rReference = mTextureReferences[pTexture];
+            rReference.key = filepath;
+            rReference.count = 1;
         }
 
         return pTexture;
@@ -151,9 +178,30 @@ namespace eyegui
 		unsigned char const * pData,
 		bool flipY)
     {
-        // Just overwrite it if existing
-        mTextures[name] = std::move(std::unique_ptr<Texture>(new PixelTexture(width, height, format, pData, flipY, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP)));
-        return mTextures[name].get();
+        // Overwrite it if existing. Old one is kept alive until its users released it
+        std::unique_ptr<Texture>& rupOldTexture = mTextures[name];
+        Texture const * pOldTexture = rupOldTexture.get();
+        if (pOldTexture != NULL)
+        {
+            auto it = mTextureReferences.find(pOldTexture);
+            if (it != mTextureReferences.end() && it->second.count > 0)
+            {
+                it->second.key = "";
+                mReplacedTextures[pOldTexture] = std::move(rupOldTexture);
+            }
+            else
+            {
+                mTextureReferences.erase(pOldTexture);
+                mUnreferencedTextures.erase(std::remove(mUnreferencedTextures.begin(), mUnreferencedTextures.end(), pOldTexture), mUnreferencedTextures.end());
+                mPendingTextures.erase(std::remove(mPendingTextures.begin(), mPendingTextures.end(), pOldTexture), mPendingTextures.end());
+            }
+        }
+        rupOldTexture = std::unique_ptr<Texture>(new PixelTexture(width, height, format, pData, flipY, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+        Texture const * pTexture = rupOldTexture.get();
+        TextureReference& rReference = mTextureReferences[pTexture];
+        rReference.key = name;
+        rReference.count = 1;
+        return pTexture;
     }
 
     Texture const * AssetManager::fetchTexture(graphics::Type graphic)
@@ -201,14 +249,8 @@ namespace eyegui
             case shaders::Type::CIRCLE:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
                 break;
-            case shaders::Type::DIM:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pDimFragmentShader));
-                break;
-            case shaders::Type::ACTIVITY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pActivityFragmentShader));
-                break;
-            case shaders::Type::MARK:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pMarkFragmentShader));
+            case shaders::Type::BATCH:
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pBatchVertexShader, shaders::pBatchFragmentShader));
                 break;
             case shaders::Type::CIRCLE_THRESHOLD:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleThresholdFragmentShader));
@@ -216,12 +258,6 @@ namespace eyegui
             case shaders::Type::BOX_THRESHOLD:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxThresholdFragmentShader));
                 break;
-            case shaders::Type::HIGHLIGHT:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pHighlightFragmentShader));
-                break;
-            case shaders::Type::SELECTION:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSelectionFragmentShader));
-                break;
             case shaders::Type::CIRCLE_BUTTON:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader));
                 break;
@@ -232,7 +268,7 @@ namespace eyegui
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSensorFragmentShader));
                 break;
             case shaders::Type::TEXT:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pTextFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pTextVertexShader, shaders::pTextFragmentShader));
                 break;
             case shaders::Type::IMAGE:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pImageFragmentShader));
@@ -283,6 +319,62 @@ namespace eyegui
         return pMesh;
     }
 
+    void AssetManager::releaseTexture(Texture const * pTexture)
+    {
+        // Only textures fetched by filepath or name are counted
+        auto it = mTextureReferences.find(pTexture);
+        if (it == mTextureReferences.end() || it->second.count == 0)
+        {
+            return;
+        }
+
+        // Keep unused texture for reuse as long as there is space
+        it->second.count--;
+        if (it->second.count == 0 && mReplacedTextures.count(pTexture) > 0)
+        {
+            // Replaced texture cannot be fetched again, so delete it right away
+            mTextureReferences.erase(it);
+            mPendingTextures.erase(std::remove(mPendingTextures.begin(), mPendingTextures.end(), pTexture), mPendingTextures.end());
+            mReplacedTextures.erase(pTexture);
+        }
+        else if (it->second.count == 0)
+        {
+            mUnreferencedTextures.push_back(pTexture);
+            evictUnreferencedTextures();
+        }
+    }
+
+    void AssetManager::uploadLoadedTextures()
+    {
+        // Upload until budget of frame is spent, so burst of loaded textures is spread over frames
+        int budget = (int)TEXTURE_UPLOAD_BUDGET;
+        mPendingTextures.erase(
+            std::remove_if(
+                mPendingTextures.begin(),
+                mPendingTextures.end(),
+                [&budget](Texture* pTexture)
+                {
+                    if (budget <= 0 || !pTexture->isReadyForUpload())
+                    {
+                        return false;
+                    }
+                    budget -= (int)pTexture->upload();
+                    return true;
+                }),
+            mPendingTextures.end());
+    }
+
+    RenderQueue* AssetManager::getRenderQueue()
+    {
+        // Create render queue if needed
+        if (mupRenderQueue.get() == NULL)
+        {
+            mupRenderQueue = std::unique_ptr<RenderQueue>(new RenderQueue(this));
+        }
+
+        return mupRenderQueue.get();
+    }
+
     Font const * AssetManager::fetchFont(std::string filepath)
     {
         // Search for font
@@ -320,25 +412,12 @@ namespace eyegui
                 }
                 else
                 {
-                    // Decide character set
-                    std::set<char16_t> characters = charsets::BASIC;
-                    switch (mpGUI->getCharacterSet())
-                    {
-                    case CharacterSet::GERMANY_GERMAN:
-                        characters.insert(charsets::GERMANY_GERMAN.begin(), charsets::GERMANY_GERMAN.end());
-                        break;
-                    case CharacterSet::US_ENGLISH:
-                        // Are there any special characters in us english?
-                        break;
-                    }
-
-                    // Give face to a font object (it will delete it in the end)
+                    // Give face to a font object (it will delete it in the end). Glyphs are rasterized on demand
                     rupFont = std::unique_ptr<Font>(
                         new AtlasFont(
                             mpGUI,
                             filepath,
-                            std::move(upFace),
-                            characters));
+                            std::move(upFace)));
                 }
             }
 
@@ -360,6 +439,94 @@ namespace eyegui
         }
     }
 
+    CompiledMarkup const * AssetManager::fetchMarkup(std::string filepath)
+    {
+        // Search for markup
+        std::unique_ptr<CompiledMarkup>& rupMarkup = mMarkups[filepath];
+        if (rupMarkup != NULL)
+        {
+            return rupMarkup.get();
+        }
+
+        // Read file
+        std::ifstream in(buildPath(filepath).c_str(), std::ios::binary);
+        if (!in)
+        {
+            throwError(OperationNotifier::Operation::PARSING, "Markup file not found", filepath);
+            mMarkups.erase(filepath);
+            return NULL;
+        }
+        std::stringstream strStream;
+        strStream << in.rdbuf();
+        std::string content = strStream.str();
+        in.close();
+
+        // Try compiled markup of previous run, named by hash of content
+        std::string cacheFilepath;
+        if (mpGUI->getLayoutCacheDirectory() != EMPTY_STRING_ATTRIBUTE)
+        {
+            char name[17];
+            std::snprintf(name, sizeof(name), "%016llx", (unsigned long long)hashBytes(content.data(), content.size()));
+            cacheFilepath = buildPath(mpGUI->getLayoutCacheDirectory() + "/" + name + "." + MARKUP_CACHE_EXTENSION);
+            rupMarkup = CompiledMarkup::readFromFile(cacheFilepath);
+        }
+
+        // Otherwise, parse and compile XML
+        if (rupMarkup == NULL)
+        {
+            tinyxml2::XMLDocument doc;
+            doc.Parse(content.data(), content.size());
+            if (doc.Error())
+            {
+                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                mMarkups.erase(filepath);
+                return NULL;
+            }
+            rupMarkup = std::unique_ptr<CompiledMarkup>(new CompiledMarkup(doc));
+
+            // Keep it for next run
+            if (!cacheFilepath.empty() && !rupMarkup->writeToFile(cacheFilepath))
+            {
+                throwWarning(OperationNotifier::Operation::PARSING, "Compiled markup could not be written to cache", filepath);
+            }
+        }
+
+        return rupMarkup.get();
+    }
+
+    std::map<std::string, Style> const * AssetManager::fetchStylesheet(std::string filepath)
+    {
+        // Search for stylesheet and parse it if not existing
+        std::unique_ptr<std::map<std::string, Style> >& rupStylesheet = mStylesheets[filepath];
+        if (rupStylesheet == NULL)
+        {
+            rupStylesheet = stylesheet_parser::parse(filepath);
+        }
+        return rupStylesheet.get();
+    }
+
+    void AssetManager::evictUnreferencedTextures()
+    {
+        // Sum up size of unused textures
+        uint size = 0;
+        for (Texture const * pTexture : mUnreferencedTextures)
+        {
+            size += pTexture->getWidth() * pTexture->getHeight() * 4;
+        }
+
+        // Delete oldest ones until size is within limit
+        while (size > UNREFERENCED_TEXTURES_MAX_SIZE)
+        {
+            Texture const * pTexture = mUnreferencedTextures.front();
+            mUnreferencedTextures.pop_front();
+            size -= pTexture->getWidth() * pTexture->getHeight() * 4;
+            mPendingTextures.erase(std::remove(mPendingTextures.begin(), mPendingTextures.end(), pTexture), mPendingTextures.end());
+            std::string key = mTextureReferences[pTexture].key;
+            mTextureReferences.erase(pTexture);
+            mTextures.erase(key);
+        }
+    }
+
     std::unique_ptr<TextFlow> AssetManager::createTextFlow(
         FontSize fontSize,
         TextFlowAlignment alignment,
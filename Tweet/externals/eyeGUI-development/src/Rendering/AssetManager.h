@@ -14,26 +14,31 @@
 #include "Shader.h"
 #include "Mesh.h"
 #include "Textures/Texture.h"
+#include "Textures/VectorTexture.h"
 #include "RenderItem.h"
+#include "RenderQueue.h"
 #include "Font/Font.h"
 #include "Assets/Text/TextFlow.h"
 #include "Assets/Text/TextSimple.h"
 #include "Assets/Key.h"
 #include "Assets/CharacterKey.h"
 #include "Assets/Image.h"
+#include "src/Parser/CompiledMarkup.h"
+#include "src/Style.h"
 
 #include "externals/FreeType2/include/ft2build.h"
 #include FT_FREETYPE_H
 
 #include <memory>
 #include <map>
+#include <deque>
 
 namespace eyegui
 {
     // Available assets
 
     namespace shaders { enum class Type {
-    COLOR, CIRCLE, DIM, ACTIVITY, MARK, CIRCLE_THRESHOLD, BOX_THRESHOLD, HIGHLIGHT, SELECTION, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT, IMAGE, KEY, CHARACTER_KEY}; }
+    COLOR, CIRCLE, BATCH, CIRCLE_THRESHOLD, BOX_THRESHOLD, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT, IMAGE, KEY, CHARACTER_KEY}; }
 
     namespace meshes { enum class Type { QUAD, LINE }; }
     namespace graphics { enum class Type { CIRCLE, BOX, NOT_FOUND }; }
@@ -54,7 +59,8 @@ namespace eyegui
         // Fetch render item
         RenderItem const * fetchRenderItem(shaders::Type shader, meshes::Type mesh);
 
-        // Fetch texture
+        // Fetch texture. Textures fetched by filepath or name are counted and
+        // should be released when not used anymore
         Texture const * fetchTexture(std::string filepath);
         Texture const * fetchTexture(
 			std::string name,
@@ -67,18 +73,33 @@ namespace eyegui
         // Fetch graphics
         Texture const * fetchTexture(graphics::Type graphic);
 
+        // Release fetched texture. Unused textures are kept until their size exceeds a limit
+        void releaseTexture(Texture const * pTexture);
+
+        // Upload textures loaded by workers meanwhile, limited per frame (should be called by GUI only)
+        void uploadLoadedTextures();
+
         // Fetch shader
         Shader const * fetchShader(shaders::Type shader);
 
         // Fetch mesh
         Mesh const * fetchMesh(meshes::Type mesh);
 
+        // Get render queue shared by all elements, created at first call
+        RenderQueue* getRenderQueue();
+
         // Fetch font
         Font const * fetchFont(std::string filepath);
 
         // Resize font atlases (should be called by GUI only)
         void resizeFontAtlases();
 
+        // Fetch compiled markup of layout or brick file. NULL if file cannot be parsed
+        CompiledMarkup const * fetchMarkup(std::string filepath);
+
+        // Fetch parsed stylesheet, layouts copy it because they may change styles
+        std::map<std::string, Style> const * fetchStylesheet(std::string filepath);
+
         // Create text flow and return it as unique pointer
         std::unique_ptr<TextFlow> createTextFlow(
             FontSize fontSize,
@@ -101,6 +122,16 @@ namespace eyegui
 
     private:
 
+        // Count of users of texture fetched by filepath or name
+        struct TextureReference
+        {
+            std::string key;
+            uint count;
+        };
+
+        // Delete unused textures, oldest first, until limit is kept
+        void evictUnreferencedTextures();
+
         // Members
         GUI const * mpGUI;
         FT_Library mFreeTypeLibrary;
@@ -108,8 +139,16 @@ namespace eyegui
         std::map<meshes::Type, std::unique_ptr<Mesh> > mMeshes;
         std::map<shaders::Type, std::map<meshes::Type, std::unique_ptr<RenderItem> > > mRenderItems;
         std::map<std::string, std::unique_ptr<Texture> > mTextures;
+        std::map<Texture const *, std::unique_ptr<Texture> > mReplacedTextures; // replaced by name but still used
         std::map<graphics::Type, std::unique_ptr<Texture> > mGraphics;
         std::map<std::string, std::unique_ptr<Font> > mFonts;
+        std::map<std::string, std::unique_ptr<CompiledMarkup> > mMarkups;
+        std::map<std::string, std::unique_ptr<std::map<std::string, Style> > > mStylesheets;
+        std::unique_ptr<RenderQueue> mupRenderQueue;
+        std::map<Texture const *, TextureReference> mTextureReferences;
+        std::deque<Texture const *> mUnreferencedTextures; // oldest first
+        std::unique_ptr<TextureLoader> mupTextureLoader;
+        std::vector<Texture*> mPendingTextures; // waiting for content of worker
     };
 }
 
@@ -27,12 +27,13 @@ namespace eyegui
         // Fetch shader to render character
         mpQuadShader = mpAssetManager->fetchShader(shaders::Type::CHARACTER_KEY);
 
-        // Get glyph from font
-        mpGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
+        // Get glyph from font (fetched again when used, as atlas may change)
+        Glyph const * pGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
+        mAtlasGeneration = 0;
 
         // Calculate relative size of character
         float targetGlyphHeight = mpFont->getTargetGlyphHeight(FontSize::KEYBOARD);
-        mCharacterSize = std::max(KEY_MIN_SCALE, mpGlyph->size.y / targetGlyphHeight);
+        mCharacterSize = std::max(KEY_MIN_SCALE, pGlyph->size.y / targetGlyphHeight);
 
         // Prepare quad for displaying the character
         prepareQuad();
@@ -44,7 +45,7 @@ namespace eyegui
         mpFont = rOtherKey.mpFont;
         mCharacter = rOtherKey.mCharacter;
         mpQuadShader = rOtherKey.mpQuadShader;
-        mpGlyph = rOtherKey.mpGlyph;
+        mAtlasGeneration = 0;
         mCharacterSize = rOtherKey.mCharacterSize;
 
         // But create own quad!
@@ -67,7 +68,8 @@ namespace eyegui
         Key::transformAndSize();
 
         // Calculate ratio of glyph representing character
-        float ratio = (float)mpGlyph->size.x / (float)mpGlyph->size.y;
+        Glyph const * pGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
+        float ratio = (float)pGlyph->size.x / (float)pGlyph->size.y;
 
         // Calculate size multiplier
         glm::vec2 sizeMultiplier;
@@ -93,18 +95,7 @@ namespace eyegui
             (int)quadSize.y);
 
         // Set texture coordinates of quad
-        GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
-        std::vector<glm::vec2> textureCoordinates;
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        fillTextureCoordinates();
     }
 
     void CharacterKey::draw(
@@ -125,17 +116,23 @@ namespace eyegui
         mpQuadShader->bind();
         glBindVertexArray(mQuadVertexArrayObject);
 
+        // Update texture coordinates if atlas has changed
+        if (mAtlasGeneration != mpFont->getAtlasGeneration(FontSize::KEYBOARD))
+        {
+            fillTextureCoordinates();
+        }
+
         // Bind atlas texture
         mpFont->bindAtlasTexture(FontSize::KEYBOARD, 1, true);
 
         // Fill color
         glm::vec4 characterColor = iconColor;
         characterColor.a *= alpha;
-        mpQuadShader->fillValue("color", characterColor);
+        mpQuadShader->fillValue(ShaderUniform::COLOR, characterColor);
 
         // Fill other uniforms
-        mpQuadShader->fillValue("matrix", mQuadMatrix); // Matrix is updated in transform and size
-        mpQuadShader->fillValue("atlas", 1);
+        mpQuadShader->fillValue(ShaderUniform::MATRIX, mQuadMatrix); // Matrix is updated in transform and size
+        mpQuadShader->fillValue(ShaderUniform::ATLAS, 1);
 
         // Draw character quad (vertex count must be 6)
         glDrawArrays(GL_TRIANGLES, 0, 6);
@@ -152,6 +149,26 @@ namespace eyegui
         return std::u16string(&mCharacter, 1);
     }
 
+    void CharacterKey::fillTextureCoordinates() const
+    {
+        // Fetch glyph, which is rasterized again if it was evicted from atlas
+        Glyph const * pGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
+        mAtlasGeneration = mpFont->getAtlasGeneration(FontSize::KEYBOARD);
+
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
+        std::vector<glm::vec2> textureCoordinates;
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.y));
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.y));
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.w));
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.w));
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.w));
+        textureCoordinates.push_back(glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.y));
+        glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    }
+
     void CharacterKey::prepareQuad()
     {
         // Save currently set buffer and vertex array object
@@ -51,11 +51,14 @@ namespace eyegui
         // Prepare quad for displaying the character
         void prepareQuad();
 
+        // Fill texture coordinates of quad with current position of glyph in atlas
+        void fillTextureCoordinates() const;
+
         // Members
         Font const * mpFont;
         char16_t mCharacter;
-        Glyph const * mpGlyph;
         float mCharacterSize;
+        mutable uint mAtlasGeneration;
         Shader const * mpQuadShader;
         GLuint mQuadVertexBuffer;
         GLuint mQuadTextureCoordinateBuffer;
@@ -32,7 +32,7 @@ namespace eyegui
 
     Image::~Image()
     {
-        // Nothing to do
+        mpAssetManager->releaseTexture(mpTexture);
     }
 
     void Image::setContent(
@@ -43,6 +43,8 @@ namespace eyegui
         unsigned char const * pData,
 		bool flipY)
     {
+        // Release first, so texture with same name is replaced without further user
+        mpAssetManager->releaseTexture(mpTexture);
         mpTexture = mpAssetManager->fetchTexture(name, width, height, format, pData, flipY);
     }
 
@@ -104,7 +106,7 @@ namespace eyegui
 
         // Fill matrix
         mpQuad->getShader()->fillValue(
-            "matrix",
+            ShaderUniform::MATRIX,
             calculateDrawMatrix(
                 mpLayout->getLayoutWidth(),
                 mpLayout->getLayoutHeight(),
@@ -114,8 +116,8 @@ namespace eyegui
                 mHeight));
 
         // Fill values
-        mpQuad->getShader()->fillValue("alpha", alpha);
-        mpQuad->getShader()->fillValue("image", 1);
+        mpQuad->getShader()->fillValue(ShaderUniform::ALPHA, alpha);
+        mpQuad->getShader()->fillValue(ShaderUniform::IMAGE, 1);
 
         // Fill scale
         glm::vec2 scale = glm::vec2(1.f,1.f);
@@ -136,7 +138,7 @@ namespace eyegui
             }
 
         }
-        mpQuad->getShader()->fillValue("scale", scale);
+        mpQuad->getShader()->fillValue(ShaderUniform::SCALE, scale);
 
         // Bind texture to render
         mpTexture->bind(1);
@@ -142,12 +142,12 @@ namespace eyegui
         // Fill color
         glm::vec4 circleColor = color;
         circleColor.a *= alpha;
-        mpCircleRenderItem->getShader()->fillValue("color", circleColor);
+        mpCircleRenderItem->getShader()->fillValue(ShaderUniform::COLOR, circleColor);
 
         // Fill other uniforms
-        mpCircleRenderItem->getShader()->fillValue("matrix", mCircleMatrix); // Matrix is updated in transform and size
-        mpCircleRenderItem->getShader()->fillValue("pickColor", pickColor);
-        mpCircleRenderItem->getShader()->fillValue("pick", mPick.getValue());
+        mpCircleRenderItem->getShader()->fillValue(ShaderUniform::MATRIX, mCircleMatrix); // Matrix is updated in transform and size
+        mpCircleRenderItem->getShader()->fillValue(ShaderUniform::PICK_COLOR, pickColor);
+        mpCircleRenderItem->getShader()->fillValue(ShaderUniform::PICK, mPick.getValue());
 
         // Drawing
         mpCircleRenderItem->draw();
@@ -161,11 +161,11 @@ namespace eyegui
 		if (threshold > 0)
 		{
 			mpThresholdItem->bind();
-			mpThresholdItem->getShader()->fillValue("matrix", mCircleMatrix);
-			mpThresholdItem->getShader()->fillValue("thresholdColor", thresholdColor);
-			mpThresholdItem->getShader()->fillValue("threshold", threshold);
-			mpThresholdItem->getShader()->fillValue("alpha", alpha);
-			mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+			mpThresholdItem->getShader()->fillValue(ShaderUniform::MATRIX, mCircleMatrix);
+			mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD_COLOR, thresholdColor);
+			mpThresholdItem->getShader()->fillValue(ShaderUniform::THRESHOLD, threshold);
+			mpThresholdItem->getShader()->fillValue(ShaderUniform::ALPHA, alpha);
+			mpThresholdItem->getShader()->fillValue(ShaderUniform::MASK, 0); // mask is always in slot 0
 			mpThresholdItem->draw();
 		}
 	}
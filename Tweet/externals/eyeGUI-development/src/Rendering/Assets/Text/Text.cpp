@@ -10,6 +10,9 @@
 #include "src/GUI.h"
 #include "src/Rendering/AssetManager.h"
 #include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/Helper.h"
+
+#include <algorithm>
 
 namespace eyegui
 {
@@ -36,7 +39,11 @@ namespace eyegui
         // Initialize some members (x and y are somehow set by specialized classes)
         mX = 0;
         mY = 0;
-        mVertexCount = 0;
+        mInstanceCount = 0;
+        mInstanceCapacity = 0;
+        mAtlasGeneration = 0;
+        mMeshLineHeight = -1;
+        mWordCacheGeneration = 0;
 
 		// Background
 		mpBackground = mpAssetManager->fetchRenderItem(shaders::Type::COLOR, meshes::Type::QUAD);
@@ -55,8 +62,13 @@ namespace eyegui
 		this->mX = rOtherText.mX;
 		this->mY = rOtherText.mY;
 		this->mContent = rOtherText.mContent;
+		this->mpBackground = rOtherText.mpBackground;
 		this->mpShader = rOtherText.mpShader;
-		this->mVertexCount = 0;
+		this->mInstanceCount = 0;
+		this->mInstanceCapacity = 0;
+		this->mAtlasGeneration = 0;
+		this->mMeshLineHeight = -1;
+		this->mWordCacheGeneration = 0;
 
 		// Create own text for the copy
 		prepareText();
@@ -67,65 +79,98 @@ namespace eyegui
         // Delete vertex array object
         glDeleteVertexArrays(1, &mVertexArrayObject);
 
-        // Delete buffers
-        glDeleteBuffers(1, &mVertexBuffer);
-        glDeleteBuffers(1, &mTextureCoordinateBuffer);
+        // Delete buffer
+        glDeleteBuffers(1, &mInstanceBuffer);
     }
 
     void Text::setContent(std::u16string content)
     {
         mContent = content;
-        calculateMesh();
+
+        // Find first character which differs from content of current mesh
+        std::u16string streamlinedContent = content;
+        streamlineLineEnding(streamlinedContent);
+        auto mismatch = std::mismatch(
+            streamlinedContent.begin(),
+            streamlinedContent.begin() + std::min(streamlinedContent.size(), mStreamlinedContent.size()),
+            mStreamlinedContent.begin());
+        size_t firstChangedCharacter = (size_t)(mismatch.first - streamlinedContent.begin());
+
+        // Nothing to do if content is the same
+        if (firstChangedCharacter == streamlinedContent.size()
+            && streamlinedContent.size() == mStreamlinedContent.size())
+        {
+            return;
+        }
+
+        calculateMesh(firstChangedCharacter);
     }
 
     void Text::calculateMesh()
     {
-        // Save currently set buffer
-        GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
+        calculateMesh(0);
+    }
 
+    void Text::calculateMesh(size_t firstChangedCharacter)
+    {
         // Get height of line
         float lineHeight = mScale * mpFont->getLineHeight(mFontSize);
 
-        // Go over words in content
-        std::u16string copyContent = mContent;
-
         // Streamline line ending
-        streamlineLineEnding(copyContent);
+        mStreamlinedContent = mContent;
+        streamlineLineEnding(mStreamlinedContent);
 
-        // Structures for OpenGL
-        std::vector<glm::vec3> vertices;
-        std::vector<glm::vec2> textureCoordinates;
+        // Instances can be only kept if font size and atlas are the same
+        uint atlasGeneration = mpFont->getAtlasGeneration(mFontSize);
+        if (lineHeight != mMeshLineHeight || atlasGeneration != mAtlasGeneration)
+        {
+            firstChangedCharacter = 0;
+        }
+        mMeshLineHeight = lineHeight;
 
         // Let the subclasses to the work
-        specialCalculateMesh(copyContent, lineHeight, vertices, textureCoordinates);
+        prepareWordCache();
+        mAtlasGeneration = atlasGeneration;
+        uint firstInstance = specialCalculateMesh(lineHeight, firstChangedCharacter);
 
-        // Vertex count
-        mVertexCount = (GLuint)vertices.size();
+        // Repeat once if glyphs used before were evicted from atlas meanwhile
+        if (mAtlasGeneration != mpFont->getAtlasGeneration(mFontSize))
+        {
+            prepareWordCache();
+            mAtlasGeneration = mpFont->getAtlasGeneration(mFontSize);
+            firstInstance = specialCalculateMesh(lineHeight, 0);
+        }
 
         // Fill into buffer
-        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 3 * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-
-        glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
+        uploadInstances(firstInstance);
+    }
 
-        // Restore old setting
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    void Text::updateAtlasCoordinates() const
+    {
+        if (mAtlasGeneration != mpFont->getAtlasGeneration(mFontSize))
+        {
+            // Geometry stays the same, only texture coordinates change
+            const_cast<Text*>(this)->calculateMesh();
+        }
     }
 
-    Text::Word Text::calculateWord(std::u16string content, float scale) const
+    Text::Word const * Text::calculateWord(const std::u16string& rContent) const
     {
+        // Look up cache
+        auto it = mWordCache.find(rContent);
+        if (it != mWordCache.end())
+        {
+            return &(it->second);
+        }
+
         // Empty word
         Word word;
-        word.spVertices = std::shared_ptr<std::vector<glm::vec3> >(new std::vector<glm::vec3>);
-        word.spTextureCoordinates = std::shared_ptr<std::vector<glm::vec2> >(new std::vector<glm::vec2>);
 
         // Fill word with data
         float xPixelPen = 0;
-        for (uint i = 0; i < content.size(); i++)
+        for (char16_t character : rContent)
         {
-            Glyph const * pGlyph = mpFont->getGlyph(mFontSize, content[i]);
+            Glyph const * pGlyph = mpFont->getGlyph(mFontSize, character);
             if (pGlyph == NULL)
             {
                 throwWarning(
@@ -134,42 +179,52 @@ namespace eyegui
                 continue;
             }
 
-            float yPixelPen = 0 - (scale * (float)(pGlyph->size.y - pGlyph->bearing.y));
-
-            // Vertices for this quad
-            glm::vec3 vertexA = glm::vec3(xPixelPen, yPixelPen, 0);
-            glm::vec3 vertexB = glm::vec3(xPixelPen + (scale * pGlyph->size.x), yPixelPen, 0);
-            glm::vec3 vertexC = glm::vec3(xPixelPen + (scale * pGlyph->size.x), yPixelPen + (scale * pGlyph->size.y), 0);
-            glm::vec3 vertexD = glm::vec3(xPixelPen, yPixelPen + (scale * pGlyph->size.y), 0);
-
-            // Texture coordinates for this quad
-            glm::vec2 textureCoordinateA = glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.y);
-            glm::vec2 textureCoordinateB = glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.y);
-            glm::vec2 textureCoordinateC = glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.w);
-            glm::vec2 textureCoordinateD = glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.w);
-
-            xPixelPen += scale * pGlyph->advance.x;
-
-            // Fill into data blocks
-            word.spVertices->push_back(vertexA);
-            word.spVertices->push_back(vertexB);
-            word.spVertices->push_back(vertexC);
-            word.spVertices->push_back(vertexC);
-            word.spVertices->push_back(vertexD);
-            word.spVertices->push_back(vertexA);
-
-            word.spTextureCoordinates->push_back(textureCoordinateA);
-            word.spTextureCoordinates->push_back(textureCoordinateB);
-            word.spTextureCoordinates->push_back(textureCoordinateC);
-            word.spTextureCoordinates->push_back(textureCoordinateC);
-            word.spTextureCoordinates->push_back(textureCoordinateD);
-            word.spTextureCoordinates->push_back(textureCoordinateA);
+            // Quad for glyph, nothing to draw for glyphs without bitmap like space
+            if (pGlyph->size.x > 0 && pGlyph->size.y > 0)
+            {
+                float yPixelPen = 0 - (mScale * (float)(pGlyph->size.y - pGlyph->bearing.y));
+                GlyphInstance instance;
+                instance.rect = glm::vec4(
+                    xPixelPen,
+                    yPixelPen,
+                    xPixelPen + (mScale * pGlyph->size.x),
+                    yPixelPen + (mScale * pGlyph->size.y));
+                instance.atlasPosition = pGlyph->atlasPosition;
+                word.glyphs.push_back(instance);
+            }
+
+            xPixelPen += mScale * pGlyph->advance.x;
         }
 
         // Set width of whole word
         word.pixelWidth = xPixelPen;
 
-        return word;
+        return &(mWordCache.emplace(rContent, std::move(word)).first->second);
+    }
+
+    void Text::appendWord(const Word& rWord, float xPixelPen, float yPixelPen)
+    {
+        glm::vec4 offset(xPixelPen, yPixelPen, xPixelPen, yPixelPen);
+        for (const GlyphInstance& rGlyph : rWord.glyphs)
+        {
+            GlyphInstance instance = rGlyph;
+            instance.rect += offset;
+            mInstances.push_back(instance);
+        }
+    }
+
+    bool Text::isLineHeightOutdated() const
+    {
+        return mScale * mpFont->getLineHeight(mFontSize) != mMeshLineHeight;
+    }
+
+    void Text::drawInstances() const
+    {
+        if (mInstanceCount > 0)
+        {
+            // Quad is generated by vertex shader
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, mInstanceCount);
+        }
     }
 
 	void Text::prepareText()
@@ -180,28 +235,69 @@ namespace eyegui
 		glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
 		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
 
-		// Initialize mesh buffers and vertex array object
-		glGenBuffers(1, &mVertexBuffer);
-		glGenBuffers(1, &mTextureCoordinateBuffer);
+		// Initialize instance buffer and vertex array object
+		glGenBuffers(1, &mInstanceBuffer);
 		glGenVertexArrays(1, &mVertexArrayObject);
 
 		// Bind stuff to vertex array object
 		glBindVertexArray(mVertexArrayObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
 
-		// Vertices
-		GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
-		glEnableVertexAttribArray(vertexAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-		glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+		// Rectangles
+		GLuint rectAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "rectAttribute");
+		glEnableVertexAttribArray(rectAttrib);
+		glVertexAttribPointer(rectAttrib, 4, GL_FLOAT, GL_FALSE, sizeof(GlyphInstance), NULL);
+		glVertexAttribDivisor(rectAttrib, 1);
 
-		// Texture coordinates
-		GLuint uvAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
-		glEnableVertexAttribArray(uvAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-		glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+		// Positions in atlas
+		GLuint atlasAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "atlasAttribute");
+		glEnableVertexAttribArray(atlasAttrib);
+		glVertexAttribPointer(atlasAttrib, 4, GL_FLOAT, GL_FALSE, sizeof(GlyphInstance), (GLvoid*)sizeof(glm::vec4));
+		glVertexAttribDivisor(atlasAttrib, 1);
 
 		// Restore old settings
 		glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
 		glBindVertexArray(oldVAO);
 	}
+
+    void Text::prepareWordCache()
+    {
+        uint atlasGeneration = mpFont->getAtlasGeneration(mFontSize);
+        if (atlasGeneration != mWordCacheGeneration || mWordCache.size() > TEXT_WORD_CACHE_MAX_SIZE)
+        {
+            mWordCache.clear();
+            mWordCacheGeneration = atlasGeneration;
+        }
+    }
+
+    void Text::uploadInstances(uint firstInstance)
+    {
+        // Save currently set buffer
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+
+        // Grow buffer if necessary, everything has to be uploaded then
+        GLuint instanceCount = (GLuint)mInstances.size();
+        if (instanceCount > mInstanceCapacity)
+        {
+            mInstanceCapacity = std::max(instanceCount, 2 * mInstanceCapacity);
+            glBufferData(GL_ARRAY_BUFFER, mInstanceCapacity * sizeof(GlyphInstance), NULL, GL_DYNAMIC_DRAW);
+            firstInstance = 0;
+        }
+
+        // Upload changed instances
+        if (firstInstance < instanceCount)
+        {
+            glBufferSubData(
+                GL_ARRAY_BUFFER,
+                firstInstance * sizeof(GlyphInstance),
+                (instanceCount - firstInstance) * sizeof(GlyphInstance),
+                mInstances.data() + firstInstance);
+        }
+        mInstanceCount = instanceCount;
+
+        // Restore old setting
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    }
 }
@@ -4,7 +4,9 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Abstract superclass for text assets.
+// Abstract superclass for text assets. Glyphs are drawn as instanced quads
+// from a buffer which is kept between changes of content. Only instances
+// behind the first changed one are uploaded again.
 
 #ifndef TEXT_H_
 #define TEXT_H_
@@ -14,6 +16,7 @@
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <vector>
+#include <unordered_map>
 
 namespace eyegui
 {
@@ -44,30 +47,49 @@ namespace eyegui
         // Draw
         virtual void draw(glm::vec4 color, float alpha, bool renderBackground = false) const = 0;
 
-        // Set content and calls "calculateMesh"
+        // Set content and calculates mesh from first changed character on
         void setContent(std::u16string content);
 
     protected:
 
+        // Quad of single glyph, one instance in buffer
+        struct GlyphInstance
+        {
+            glm::vec4 rect; // minX, minY, maxX, maxY in pixel coordinates
+            glm::vec4 atlasPosition; // minU, minV, maxU, maxV
+        };
+
         // Struct for word
         struct Word
         {
-            std::shared_ptr<std::vector<glm::vec3> > spVertices;
-            std::shared_ptr<std::vector<glm::vec2> > spTextureCoordinates;
+            std::vector<GlyphInstance> glyphs; // relative to origin of word
             float pixelWidth;
         };
 
-        // Calculate mesh (in pixel coordinates). Calls specialized method of subclasses
+        // Calculate mesh (in pixel coordinates) from scratch. Calls specialized method of subclasses
         void calculateMesh();
 
-        // Special calculate mesh implemented by specialized classes
-        virtual void specialCalculateMesh(
-            std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates) = 0;
+        // Calculate mesh. Subclasses may keep instances in front of first changed character
+        void calculateMesh(size_t firstChangedCharacter);
+
+        // Calculate mesh again when glyphs were moved in atlas of font. Called before drawing
+        void updateAtlasCoordinates() const;
+
+        // Special calculate mesh implemented by specialized classes. Fills instances
+        // using streamlined content and returns index of first changed instance
+        virtual uint specialCalculateMesh(float lineHeight, size_t firstChangedCharacter) = 0;
+
+        // Get word from cache or calculate it. Pointer is valid until mesh is calculated again
+        Word const * calculateWord(const std::u16string& rContent) const;
 
-        // Calculate single word and returns it
-        Word calculateWord(std::u16string content, float scale) const;
+        // Append instances of word at pen position
+        void appendWord(const Word& rWord, float xPixelPen, float yPixelPen);
+
+        // Check whether mesh has to be calculated again because of changed font size
+        bool isLineHeightOutdated() const;
+
+        // Draw instances, shader and vertex array object have to be bound
+        void drawInstances() const;
 
 		// Prepare text
 		void prepareText();
@@ -81,13 +103,29 @@ namespace eyegui
         int mX;
         int mY;
         std::u16string mContent;
+        std::u16string mStreamlinedContent; // content of current mesh
 		RenderItem const * mpBackground;
 
         Shader const * mpShader;
-        GLuint mVertexCount;
-        GLuint mVertexBuffer;
-        GLuint mTextureCoordinateBuffer;
+        std::vector<GlyphInstance> mInstances;
+        GLuint mInstanceCount;
+        GLuint mInstanceCapacity;
+        GLuint mInstanceBuffer;
         GLuint mVertexArrayObject;
+        uint mAtlasGeneration;
+        float mMeshLineHeight;
+
+    private:
+
+        // Clear cache of words if atlas has changed (new generation for each font size, too) or cache is too big
+        void prepareWordCache();
+
+        // Upload instances from given index on
+        void uploadInstances(uint firstInstance);
+
+        // Cache of words. Measurements are independent from position, so they are reused between calculations
+        mutable std::unordered_map<std::u16string, Word> mWordCache;
+        uint mWordCacheGeneration;
     };
 }
 
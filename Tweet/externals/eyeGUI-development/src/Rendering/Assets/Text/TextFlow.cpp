@@ -56,11 +56,17 @@ namespace eyegui
         int width,
         int height)
     {
+        // Position is only applied at drawing
         mX = x;
         mY = y;
-        mWidth = width;
-        mHeight = height;
-        calculateMesh();
+
+        // Calculate mesh if size of flow or font has changed
+        if (width != mWidth || height != mHeight || isLineHeightOutdated())
+        {
+            mWidth = width;
+            mHeight = height;
+            calculateMesh();
+        }
     }
 
     void TextFlow::draw(
@@ -102,12 +108,15 @@ namespace eyegui
 			// Determine which 
 			glm::mat4 backgroundMatrix = calculateDrawMatrix(mpGUI->getWindowWidth(), mpGUI->getWindowHeight(), mX + ((mWidth - backgroundWidth) / 2), mY + yOffset - (extraPixels/2), backgroundWidth, backgroundHeight);
 			mpBackground->bind();
-			mpBackground->getShader()->fillValue("matrix", backgroundMatrix);
-			mpBackground->getShader()->fillValue("color", glm::vec4(0.f, 0.f, 0.f, 0.3f));
-			mpBackground->getShader()->fillValue("alpha", alpha);
+			mpBackground->getShader()->fillValue(ShaderUniform::MATRIX, backgroundMatrix);
+			mpBackground->getShader()->fillValue(ShaderUniform::COLOR, glm::vec4(0.f, 0.f, 0.f, 0.3f));
+			mpBackground->getShader()->fillValue(ShaderUniform::ALPHA, alpha);
 			mpBackground->draw();
 		}
 
+        // Rebuild mesh if atlas has changed
+        updateAtlasCoordinates();
+
         // Bind atlas texture
         if (mScale == 1.0f)
         {
@@ -123,25 +132,53 @@ namespace eyegui
 		glBindVertexArray(mVertexArrayObject);
 
         // Fill uniforms
-        mpShader->fillValue("matrix", matrix);
-        mpShader->fillValue("color", color);
-        mpShader->fillValue("alpha", alpha);
-        mpShader->fillValue("atlas", 1);
+        mpShader->fillValue(ShaderUniform::MATRIX, matrix);
+        mpShader->fillValue(ShaderUniform::COLOR, color);
+        mpShader->fillValue(ShaderUniform::ALPHA, alpha);
+        mpShader->fillValue(ShaderUniform::ATLAS, 1);
 
         // Draw flow
-        glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
+        drawInstances();
     }
 
-    void TextFlow::specialCalculateMesh(
-            std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates)
+    uint TextFlow::specialCalculateMesh(float lineHeight, size_t firstChangedCharacter)
     {
-		// Reset flow width to get longest line's width of this computation
-		mFlowWidth = 0;
-
         // OpenGL setup done in calling method
 
+        // Find line from which on layout has to be calculated again
+        size_t lineIndex = 0;
+        if (firstChangedCharacter > 0 && !mLines.empty())
+        {
+            // Line containing the first changed character
+            while (lineIndex + 1 < mLines.size() && mLines[lineIndex + 1].start <= firstChangedCharacter)
+            {
+                lineIndex++;
+            }
+
+            // Previous line may take words of changed one
+            if (lineIndex > 0)
+            {
+                lineIndex--;
+            }
+
+            // Line must not start with second part of split word
+            while (lineIndex > 0 && !startsWithWord(mLines[lineIndex]))
+            {
+                lineIndex--;
+            }
+        }
+
+        // Keep lines in front
+        size_t position = 0;
+        uint firstInstance = 0;
+        if (lineIndex < mLines.size())
+        {
+            position = mLines[lineIndex].start;
+            firstInstance = mLines[lineIndex].firstInstance;
+        }
+        mLines.resize(lineIndex);
+        mInstances.resize(firstInstance);
+
         // Get size of space character
         float pixelOfSpace = 0;
 
@@ -158,43 +195,27 @@ namespace eyegui
         }
 
         // Create mark for overflow
-        Word overflowMark = calculateWord(TEXT_FLOW_OVERFLOW_MARK, mScale);
-
-        // Get pararaphs separated by \n
-        std::vector<std::u16string> paragraphs;
-        std::u16string paragraphDelimiter = u"\n";
-
-        // Seperate into paragraphs
-        size_t pos = 0;
-        std::u16string token;
-        while ((pos = streamlinedContent.find(paragraphDelimiter)) != std::u16string::npos)
-        {
-            token = streamlinedContent.substr(0, pos);
-            paragraphs.push_back(token);
-            streamlinedContent.erase(0, pos + paragraphDelimiter.length());
-        }
-        paragraphs.push_back(streamlinedContent); // Last paragraph (paragraphs never empty)
+        Word const * pOverflowMark = calculateWord(TEXT_FLOW_OVERFLOW_MARK);
 
         // Do not generate text flow mesh when there is a failure
         bool failure = false;
 
-        // Go over paragraphs (pens are in local pixel coordinate system with origin in lower left corner of element)
-        float yPixelPen = -lineHeight; // First line should be also inside flow
-        for (std::u16string& rPargraph : paragraphs)
+        // Go over paragraphs separated by \n (pens are in local pixel coordinate system with origin in lower left corner of element)
+        float yPixelPen = -lineHeight * (float)(lineIndex + 1); // First line should be also inside flow
+        while (!failure)
         {
+            size_t paragraphEnd = std::min(mStreamlinedContent.find(u'\n', position), mStreamlinedContent.size());
+
             // Get words out of paragraph
-            std::vector<Word> words;
-            std::u16string wordDelimiter = u" ";
-            while ((pos = rPargraph.find(wordDelimiter)) != std::u16string::npos)
+            std::vector<WordPosition> words;
+            size_t wordStart = position;
+            while (wordStart <= paragraphEnd)
             {
-                token = rPargraph.substr(0, pos);
-                rPargraph.erase(0, pos + wordDelimiter.length());
-                failure |= !insertFitWord(words, token, mWidth, mScale);
+                size_t wordEnd = std::min(mStreamlinedContent.find(u' ', wordStart), paragraphEnd);
+                failure |= !insertFitWord(words, wordStart, wordEnd - wordStart, mWidth);
+                wordStart = wordEnd + 1;
             }
 
-            // Add last token from paragraph as well
-            failure |= !insertFitWord(words, rPargraph, mWidth, mScale);
-
             // Failure appeared, forget it
             if (!failure)
             {
@@ -207,6 +228,7 @@ namespace eyegui
                 {
                     // Collect words in one line
                     std::vector<Word const *> line;
+                    size_t lineStart = words[wordIndex].start;
                     float wordsPixelWidth = 0;
                     float newWordsWithSpacesPixelWidth = 0;
 
@@ -214,8 +236,8 @@ namespace eyegui
                     while (hasNext && newWordsWithSpacesPixelWidth <= mWidth)
                     {
                         // First word should always fit into width because of previous checks
-                        wordsPixelWidth += words[wordIndex].pixelWidth;
-                        line.push_back(&words[wordIndex]);
+                        wordsPixelWidth += words[wordIndex].pWord->pixelWidth;
+                        line.push_back(words[wordIndex].pWord);
                         wordIndex++;
 
                         if (wordIndex >= words.size())
@@ -227,22 +249,19 @@ namespace eyegui
                         {
                             // Calculate next width of line
                             newWordsWithSpacesPixelWidth = std::ceil(
-                                (wordsPixelWidth + (float)words[wordIndex].pixelWidth) // Words size (old ones and new one)
+                                (wordsPixelWidth + (float)words[wordIndex].pWord->pixelWidth) // Words size (old ones and new one)
                                 + (((float)line.size()) - 1.0f) * pixelOfSpace); // Spaces between words
                         }
                     }
 
                     // If this is last line and after it still words left, replace it by some mark for overflow
-                    if (hasNext && abs(yPixelPen - lineHeight) > mHeight && overflowMark.pixelWidth <= mWidth)
+                    if (hasNext && abs(yPixelPen - lineHeight) > mHeight && pOverflowMark->pixelWidth <= mWidth)
                     {
                         line.clear();
-                        wordsPixelWidth = overflowMark.pixelWidth;
-                        line.push_back(&overflowMark);
+                        wordsPixelWidth = pOverflowMark->pixelWidth;
+                        line.push_back(pOverflowMark);
                     }
 
-					// Remember longest line's width
-					mFlowWidth = mFlowWidth < ((int) wordsPixelWidth + 1) ? ((int)wordsPixelWidth + 1) : mFlowWidth;
-
                     // Decide dynamic space for line
                     float dynamicSpace = pixelOfSpace;
                     if (line.size() > 1)
@@ -271,91 +290,114 @@ namespace eyegui
                         }
                     }
 
+                    // Remember line
+                    Line lineRecord;
+                    lineRecord.start = lineStart;
+                    lineRecord.firstInstance = (uint)mInstances.size();
+                    lineRecord.pixelWidth = (int)wordsPixelWidth + 1;
+                    mLines.push_back(lineRecord);
+
                     // Combine word geometry to one line
                     float xPixelPen = xOffset;
-                    for (uint i = 0; i < line.size(); i++)
+                    for (Word const * pWord : line)
                     {
-                        // Assuming, that the count of vertices and texture coordinates is equal
-                        for (uint j = 0; j < line[i]->spVertices->size(); j++)
-                        {
-                            const glm::vec3& rVertex = line[i]->spVertices->at(j);
-                            rVertices.push_back(glm::vec3(rVertex.x + xPixelPen, rVertex.y + yPixelPen, rVertex.z));
-                            const glm::vec2& rTextureCoordinate = line[i]->spTextureCoordinates->at(j);
-                            rTextureCoordinates.push_back(glm::vec2(rTextureCoordinate.s, rTextureCoordinate.t));
-                        }
+                        appendWord(*pWord, xPixelPen, yPixelPen);
 
                         // Advance xPen
-                        xPixelPen += dynamicSpace + line[i]->pixelWidth;
+                        xPixelPen += dynamicSpace + pWord->pixelWidth;
                     }
 
                     // Advance yPen
                     yPixelPen -= lineHeight;
                 }
             }
+
+            // Next paragraph
+            if (paragraphEnd >= mStreamlinedContent.size())
+            {
+                break;
+            }
+            position = paragraphEnd + 1;
         }
 
         // If failure appeared, clean up
         if (failure)
         {
-            // Vertex count will become zero
-            rVertices.clear();
-            rTextureCoordinates.clear();
+            // Instance count will become zero
+            mInstances.clear();
+            mLines.clear();
+            firstInstance = 0;
         }
 
+		// Remember longest line's width
+		mFlowWidth = 0;
+		for (const Line& rLine : mLines)
+		{
+			mFlowWidth = std::max(mFlowWidth, rLine.pixelWidth);
+		}
+
         // Get height of all lines (yPixelPen is one line to low now)
         mFlowHeight = (int)std::max(std::ceil(abs(yPixelPen) - lineHeight), 0.0f);
+
+        return firstInstance;
     }
 
-    std::vector<TextFlow::Word> TextFlow::calculateFitWord(std::u16string content, int maxPixelWidth, float scale) const
+    std::vector<TextFlow::WordPosition> TextFlow::calculateFitWord(size_t start, size_t length, int maxPixelWidth) const
     {
-        // Calculate word from content
-        Word word = calculateWord(content, scale);
-
         // End of recursion
-        if ((content.size() == 1 && word.pixelWidth > maxPixelWidth) || content.empty())
+        if (length == 0)
         {
             // Return empty vector as signal of failure
-            return std::vector<Word>();
+            return std::vector<WordPosition>();
+        }
+
+        // Calculate word from content
+        WordPosition word;
+        word.pWord = calculateWord(mStreamlinedContent.substr(start, length));
+        word.start = start;
+
+        if (length == 1 && word.pWord->pixelWidth > maxPixelWidth)
+        {
+            // Single character does not fit
+            return std::vector<WordPosition>();
         }
-        else if (word.pixelWidth <= maxPixelWidth)
+        else if (word.pWord->pixelWidth <= maxPixelWidth)
         {
             // If word length is ok, just return it
-            return std::vector<Word>(1, word);
+            return std::vector<WordPosition>(1, word);
         }
         else
         {
             // Word is too wide and content longer than 1, split it!
-            int length = (int)content.size();
-            int left = length / 2;
-            int right = length - left;
+            size_t left = length / 2;
+            size_t right = length - left;
 
             // Combine results from recursive call
-            std::vector<Word> leftWord = calculateFitWord(content.substr(0, left), maxPixelWidth, scale);
-            std::vector<Word> rightWord = calculateFitWord(content.substr(left+1, right), maxPixelWidth, scale);
+            std::vector<WordPosition> leftWord = calculateFitWord(start, left, maxPixelWidth);
+            std::vector<WordPosition> rightWord = calculateFitWord(start + left, right, maxPixelWidth);
 
             // If one or more of both are empty, forget it
             if (leftWord.empty() || rightWord.empty())
             {
-                return std::vector<Word>();
+                return std::vector<WordPosition>();
             }
             else
             {
-                std::vector<Word> words(leftWord);
-                words.insert(words.end(), rightWord.begin(), rightWord.end());
-                return words;
+                leftWord.insert(leftWord.end(), rightWord.begin(), rightWord.end());
+                return leftWord;
             }
         }
     }
 
-    bool TextFlow::insertFitWord(std::vector<TextFlow::Word>& rWords, const std::u16string& rContent, int maxPixelWidth, float scale) const
+    bool TextFlow::insertFitWord(std::vector<TextFlow::WordPosition>& rWords, size_t start, size_t length, int maxPixelWidth) const
     {
         // Do nothing if input is empty
-        if (rContent.empty())
+        if (length == 0)
         {
             return true;
         }
 
-        std::vector<Word> newWords = calculateFitWord(rContent, maxPixelWidth, scale);
+        std::vector<WordPosition> newWords = calculateFitWord(start, length, maxPixelWidth);
 
         // Check, whether call was successful
         if (newWords.empty())
@@ -370,4 +412,11 @@ namespace eyegui
             return true;
         }
     }
+
+    bool TextFlow::startsWithWord(const Line& rLine) const
+    {
+        return rLine.start == 0
+            || mStreamlinedContent[rLine.start - 1] == u' '
+            || mStreamlinedContent[rLine.start - 1] == u'\n';
+    }
 }
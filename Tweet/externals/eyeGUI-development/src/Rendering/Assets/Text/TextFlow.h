@@ -46,17 +46,32 @@ namespace eyegui
 
     protected:
 
+        // Word with position of first character in streamlined content
+        struct WordPosition
+        {
+            Word const * pWord;
+            size_t start;
+        };
+
+        // Line of flow, remembered to calculate only lines behind a change of content
+        struct Line
+        {
+            size_t start; // first character in streamlined content
+            uint firstInstance;
+            int pixelWidth;
+        };
+
         // Calculate mesh (in pixel coordinates)
-        virtual void specialCalculateMesh(
-            std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates);
+        virtual uint specialCalculateMesh(float lineHeight, size_t firstChangedCharacter);
 
         // Calculate word with maximal width (in doubt split it). If result is empty, not enough space available
-        std::vector<Word> calculateFitWord(std::u16string content, int maxPixelWidth, float scale) const;
+        std::vector<WordPosition> calculateFitWord(size_t start, size_t length, int maxPixelWidth) const;
 
         // Inserts word into vector, returns true at success
-        bool insertFitWord(std::vector<Word>& rWords, const std::u16string& rContent, int maxPixelWidth, float scale) const;
+        bool insertFitWord(std::vector<WordPosition>& rWords, size_t start, size_t length, int maxPixelWidth) const;
+
+        // Check whether line starts with a complete word
+        bool startsWithWord(const Line& rLine) const;
 
         // Members
         TextFlowAlignment mAlignment;
@@ -65,6 +80,7 @@ namespace eyegui
         int mHeight;
 		int mFlowWidth;
         int mFlowHeight;
+        std::vector<Line> mLines;
     };
 }
 
@@ -12,6 +12,8 @@
 #include "src/Utilities/OperationNotifier.h"
 #include "externals/GLM/glm/gtc/matrix_transform.hpp"
 
+#include <algorithm>
+
 namespace eyegui
 {
     TextSimple::TextSimple(
@@ -50,8 +52,11 @@ namespace eyegui
 
     void TextSimple::transform()
     {
-        // Calculate mesh since window size could have been changed
-        calculateMesh();
+        // Calculate mesh if window size has changed font size
+        if (isLineHeightOutdated())
+        {
+            calculateMesh();
+        }
     }
 
 	void TextSimple::setPosition(int x, int y)
@@ -73,6 +78,9 @@ namespace eyegui
         matrix = glm::translate(matrix, glm::vec3(mX, mpGUI->getWindowHeight() - mY, 0)); // Change coordinate system and translate to position
         matrix = glm::ortho(0.0f, (float)(mpGUI->getWindowWidth() - 1), 0.0f, (float)(mpGUI->getWindowHeight() - 1)) * matrix; // Pixel to world space
 
+        // Rebuild mesh if atlas has changed
+        updateAtlasCoordinates();
+
         // Bind atlas texture
         if (mScale == 1.0f)
         {
@@ -83,13 +91,13 @@ namespace eyegui
             mpFont->bindAtlasTexture(mFontSize, 1, true);
         }
 
-        mpShader->fillValue("matrix", matrix);
-        mpShader->fillValue("color", color);
-        mpShader->fillValue("alpha", alpha);
-        mpShader->fillValue("atlas", 1);
+        mpShader->fillValue(ShaderUniform::MATRIX, matrix);
+        mpShader->fillValue(ShaderUniform::COLOR, color);
+        mpShader->fillValue(ShaderUniform::ALPHA, alpha);
+        mpShader->fillValue(ShaderUniform::ATLAS, 1);
 
-        // Draw flow
-        glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
+        // Draw text
+        drawInstances();
     }
 
 	int TextSimple::getX() const
@@ -117,52 +125,42 @@ namespace eyegui
 		return mContent;
 	}
 
-    void TextSimple::specialCalculateMesh(
-            std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates)
+    uint TextSimple::specialCalculateMesh(float lineHeight, size_t /*firstChangedCharacter*/)
     {
-        // OpenGL setup done in calling method
+        // Text is short, so always calculate everything (words are cached anyway)
+        mInstances.clear();
 
-        // Go over lines and collect them
-        std::u16string delimiter = u"\n";
-        size_t pos = 0;
-        std::vector<std::u16string> collectedLines;
-        while ((pos = streamlinedContent.find(delimiter)) != std::u16string::npos)
-        {
-            collectedLines.push_back(streamlinedContent.substr(0, pos));
-            streamlinedContent.erase(0, pos + delimiter.length());
-        }
-        collectedLines.push_back(streamlinedContent);
-
-        // Go over collected lines
+        // Go over lines
         float yPixelPen = -lineHeight; // First line should be also inside element
         float maxPixelWidth = 0;
         float pixelHeight = 0;
-        for(const std::u16string line : collectedLines)
+        size_t lineStart = 0;
+        while (true)
         {
-            // Just do whole line as one big word
-            Word word = calculateWord(line, mScale);
+            size_t lineEnd = std::min(mStreamlinedContent.find(u'\n', lineStart), mStreamlinedContent.size());
 
-            // Assuming, that the count of vertices and texture coordinates is equal
-            for (uint i = 0; i < word.spVertices->size(); i++)
-            {
-                const glm::vec3& rVertex = word.spVertices->at(i);
-                rVertices.push_back(glm::vec3(rVertex.x, rVertex.y + yPixelPen, rVertex.z));
-                const glm::vec2& rTextureCoordinate = word.spTextureCoordinates->at(i);
-                rTextureCoordinates.push_back(glm::vec2(rTextureCoordinate.s, rTextureCoordinate.t));
-            }
+            // Just do whole line as one big word
+            Word const * pWord = calculateWord(mStreamlinedContent.substr(lineStart, lineEnd - lineStart));
+            appendWord(*pWord, 0, yPixelPen);
 
             // Advance yPen
             yPixelPen -= lineHeight;
 
             // Remember that line for evaluate size
-            maxPixelWidth = std::max(maxPixelWidth, word.pixelWidth);
+            maxPixelWidth = std::max(maxPixelWidth, pWord->pixelWidth);
             pixelHeight += lineHeight;
+
+            if (lineEnd >= mStreamlinedContent.size())
+            {
+                break;
+            }
+            lineStart = lineEnd + 1;
         }
 
         // Save used width and height
         mWidth = (int)maxPixelWidth;
         mHeight = (int)pixelHeight;
+
+        return 0;
     }
 }
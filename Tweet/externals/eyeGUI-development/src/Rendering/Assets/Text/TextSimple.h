@@ -50,10 +50,7 @@ namespace eyegui
     protected:
 
         // Calculate mesh (in pixel coordinates)
-        virtual void specialCalculateMesh(
-            std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates);
+        virtual uint specialCalculateMesh(float lineHeight, size_t firstChangedCharacter);
 
         // Members
         int mWidth;
@@ -17,35 +17,32 @@ namespace eyegui
     AtlasFont::AtlasFont(
         GUI const * pGUI,
         std::string filepath,
-        std::unique_ptr<FT_Face> upFace,
-        std::set<char16_t> characterSet) : Font()
+        std::unique_ptr<FT_Face> upFace) : Font()
     {
         // Fill members
         mpGUI = pGUI;
         mFilepath = filepath;
         mupFace = std::move(upFace);
-        mCharacterSet = characterSet;
+        mFacePixelHeight = 0;
+        mUseCounter = 0;
+        mGenerationCounter = 0;
 
-        // Initilialize textures
-        glGenTextures(1, &mTallTexture);
-        glGenTextures(1, &mMediumTexture);
-        glGenTextures(1, &mSmallTexture);
-        glGenTextures(1, &mKeyboardTexture);
-
-        // Update pixel heights
-        fillPixelHeights();
+        // Get the maximum resolution of textures on this GPU
+        int maxTextureResolution;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureResolution);
+        mPageResolution = std::min(FONT_ATLAS_PAGE_RESOLUTION, maxTextureResolution);
 
-        // Fill atlases the first time
-        fillAtlases();
+        // Assign atlases the first time (glyphs are rasterized when requested)
+        resizeFontAtlases();
     }
 
     AtlasFont::~AtlasFont()
     {
         // Delete textures
-        glDeleteTextures(1, &mTallTexture);
-        glDeleteTextures(1, &mMediumTexture);
-        glDeleteTextures(1, &mSmallTexture);
-        glDeleteTextures(1, &mKeyboardTexture);
+        for (auto& rupAtlas : mSizedAtlases)
+        {
+            glDeleteTextures(1, &(rupAtlas->texture));
+        }
 
         // Delete used face
         FT_Done_Face(*(mupFace.get()));
@@ -54,63 +51,49 @@ namespace eyegui
     void AtlasFont::resizeFontAtlases()
     {
         // Update pixel heights
-        fillPixelHeights();
+        float windowHeight = (float)mpGUI->getWindowHeight();
+        const FontSize fontSizes[] = { FontSize::TALL, FontSize::MEDIUM, FontSize::SMALL, FontSize::KEYBOARD };
+        for (FontSize fontSize : fontSizes)
+        {
+            mPixelHeights[(int)fontSize] = (int)(windowHeight * mpGUI->getSizeOfFont(fontSize));
+        }
 
-        // Update all atlases
-        fillAtlases();
+        // Assign atlases, sizes used before keep their glyphs
+        for (FontSize fontSize : fontSizes)
+        {
+            mFontSizeAtlases[(int)fontSize] = fetchSizedAtlas(mPixelHeights[(int)fontSize]);
+        }
+
+        // Delete atlases of sizes which were not used for longest time
+        while (mSizedAtlases.size() > (size_t)FONT_ATLAS_CACHED_SIZE_COUNT)
+        {
+            SizedAtlas* pAtlas = mSizedAtlases.back().get();
+            if (std::find(mFontSizeAtlases.begin(), mFontSizeAtlases.end(), pAtlas) != mFontSizeAtlases.end())
+            {
+                break; // still in use
+            }
+            glDeleteTextures(1, &(pAtlas->texture));
+            mSizedAtlases.pop_back();
+        }
     }
 
     Glyph const * AtlasFont::getGlyph(FontSize fontSize, char16_t character) const
     {
-        Glyph const * pGlyph = NULL;
-
-        switch (fontSize)
-        {
-        case FontSize::TALL:
-            pGlyph = getGlyph(mTallGlyphs, character);
-            break;
-        case FontSize::MEDIUM:
-            pGlyph = getGlyph(mMediumGlyphs, character);
-            break;
-        case FontSize::SMALL:
-            pGlyph = getGlyph(mSmallGlyphs, character);
-            break;
-        case FontSize::KEYBOARD:
-            pGlyph = getGlyph(mKeyboardGlyphs, character);
-            break;
-        }
+        SizedAtlas& rAtlas = *(mFontSizeAtlases[(int)fontSize]);
+        Glyph const * pGlyph = getGlyph(rAtlas, character);
 
-        // Check whether key was found
+        // Check whether glyph was found
         if (pGlyph == NULL)
         {
-            throwWarning(
-                OperationNotifier::Operation::RUNTIME,
-                "Failed to find a character, check font file and character set",
-                mFilepath);
-
             // Try to load fallback
-            switch (fontSize)
-            {
-            case FontSize::TALL:
-                pGlyph = getGlyph(mTallGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::MEDIUM:
-                pGlyph = getGlyph(mMediumGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::SMALL:
-                pGlyph = getGlyph(mSmallGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::KEYBOARD:
-                pGlyph = getGlyph(mKeyboardGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            }
+            pGlyph = getGlyph(rAtlas, FONT_FALLBACK_CHARACTER);
 
             // Check fallback
             if (pGlyph == NULL)
             {
                 throwError(
                     OperationNotifier::Operation::RUNTIME,
-                    "Fallback character not found, check font file and character set",
+                    "Fallback character not found, check font file",
                     mFilepath);
             }
         }
@@ -126,37 +109,7 @@ namespace eyegui
 
     float AtlasFont::getTargetGlyphHeight(FontSize fontSize) const
     {
-        // Values seems to be not correct (not depending on bitmap size)
-        /*switch(fontSize)
-        {
-        case FontSize::TALL:
-        return mTallLineHeight;
-        break;
-        case FontSize::MEDIUM:
-        return mMediumLineHeight;
-        break;
-        case FontSize::SMALL:
-        return mSmallLineHeight;
-        break;
-        }*/
-
-        switch (fontSize)
-        {
-        case FontSize::TALL:
-            return (float)mTallPixelHeight;
-            break;
-        case FontSize::MEDIUM:
-            return (float)mMediumPixelHeight;
-            break;
-        case FontSize::SMALL:
-            return (float)mSmallPixelHeight;
-            break;
-        case FontSize::KEYBOARD:
-            return (float)mKeyboardPixelHeight;
-            break;
-        default:
-            return 0;
-        }
+        return (float)mPixelHeights[(int)fontSize];
     }
 
     void AtlasFont::bindAtlasTexture(FontSize fontSize, uint slot, bool linearFiltering) const
@@ -165,299 +118,335 @@ namespace eyegui
         glActiveTexture(GL_TEXTURE0 + slot);
 
         // Bind atlas texture
-        switch (fontSize)
-        {
-        case FontSize::TALL:
-            glBindTexture(GL_TEXTURE_2D, mTallTexture);
-            break;
-        case FontSize::MEDIUM:
-            glBindTexture(GL_TEXTURE_2D, mMediumTexture);
-            break;
-        case FontSize::SMALL:
-            glBindTexture(GL_TEXTURE_2D, mSmallTexture);
-            break;
-        case FontSize::KEYBOARD:
-            glBindTexture(GL_TEXTURE_2D, mKeyboardTexture);
-            break;
-        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mFontSizeAtlases[(int)fontSize]->texture);
 
         // Set sampling
         if (linearFiltering)
         {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         }
         else
         {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         }
     }
 
-    Glyph const * AtlasFont::getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const
+    uint AtlasFont::getAtlasGeneration(FontSize fontSize) const
     {
-        auto it = rGlyphMap.find(character);
+        return mFontSizeAtlases[(int)fontSize]->generation;
+    }
 
-        if (it != rGlyphMap.end())
+    Glyph const * AtlasFont::getGlyph(SizedAtlas& rAtlas, char16_t character) const
+    {
+        // Glyphs without bitmap (like space) are never put into a page
+        auto it = rAtlas.glyphs.find(character);
+        if (it != rAtlas.glyphs.end())
         {
-            return &(it->second);
+            GlyphEntry& rEntry = it->second;
+            if (rEntry.missing)
+            {
+                return NULL;
+            }
+            if (rEntry.page >= 0)
+            {
+                rAtlas.pages[rEntry.page].lastUse = ++mUseCounter;
+                return &(rEntry.glyph);
+            }
+            if (rEntry.glyph.size.x == 0 || rEntry.glyph.size.y == 0)
+            {
+                return &(rEntry.glyph);
+            }
         }
-        else
+
+        // Rasterize glyph (first use or page was evicted)
+        GlyphEntry& rEntry = rAtlas.glyphs[character];
+        if (!rasterizeGlyph(rAtlas, character, rEntry))
         {
+            rEntry.missing = true;
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Failed to find character in font file, check coverage of font",
+                mFilepath);
             return NULL;
         }
+        return &(rEntry.glyph);
     }
 
-    int AtlasFont::calculatePadding(int pixelHeight)
-    {
-        return std::max(
-            FONT_MINIMAL_CHARACTER_PADDING,
-            (int)(pixelHeight * FONT_CHARACTER_PADDING));
-    }
-
-    void AtlasFont::fillPixelHeights()
-    {
-        float windowHeight =(float) mpGUI->getWindowHeight();
-        mTallPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::TALL));
-        mMediumPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::MEDIUM));
-        mSmallPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::SMALL));
-        mKeyboardPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::KEYBOARD));
-    }
-
-    void AtlasFont::fillAtlases()
-    {
-        fillAtlas(
-            mTallPixelHeight,
-            mTallGlyphs,
-            mTallLinePixelHeight,
-            mTallTexture,
-            calculatePadding(mTallPixelHeight));
-        fillAtlas(
-            mMediumPixelHeight,
-            mMediumGlyphs,
-            mMediumLinePixelHeight,
-            mMediumTexture,
-            calculatePadding(mMediumPixelHeight));
-        fillAtlas(
-            mSmallPixelHeight,
-            mSmallGlyphs,
-            mSmallLinePixelHeight,
-            mSmallTexture,
-            calculatePadding(mSmallPixelHeight));
-        fillAtlas(
-            mKeyboardPixelHeight,
-            mKeyboardGlyphs,
-            mKeyboardLinePixelHeight,
-            mKeyboardTexture,
-            calculatePadding(mKeyboardPixelHeight));
-    }
-
-    void AtlasFont::fillAtlas(
-        int pixelHeight,
-        std::map<char16_t, Glyph>& rGlyphMap,
-        float& rLineHeight,
-        GLuint textureHandle,
-        int padding)
+    bool AtlasFont::rasterizeGlyph(SizedAtlas& rAtlas, char16_t character, GlyphEntry& rEntry) const
     {
-        // Some typedef, keeps track of combination of each glyph and its bitmap
-        typedef std::pair<Glyph*, std::vector<unsigned char> > glyphBitmapPair;
-
-        // Store bitmaps temporarily
-        std::vector<glyphBitmapPair> bitmaps;
-
         // Reference to face
         FT_Face& rFace = *(mupFace.get());
 
         // Set the height for generation of glyphs
-        FT_Set_Pixel_Sizes(rFace, 0, pixelHeight);
-
-        // Set line height
-        rLineHeight = (float)(rFace->height) / 64; // Given in 1/64 pixel
-
-        // Go over character set and collect glyphs and bitmaps
-        for (char16_t c : mCharacterSet)
+        if (mFacePixelHeight != rAtlas.pixelHeight)
         {
-            // Load current glyph in face
-            if (FT_Load_Char(rFace, c, FT_LOAD_RENDER))
-            {
-                throwWarning(
-                    OperationNotifier::Operation::RUNTIME,
-                    "Failed to find character in font file, check coverage of font",
-                    mFilepath);
-                continue;
-            }
-
-            // Determine width and height
-            int bitmapWidth = rFace->glyph->bitmap.width;
-            int bitmapHeight = rFace->glyph->bitmap.rows;
-
-            // Save some values of the glyph
-            rGlyphMap[c].advance = glm::vec2(
-                (float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
-                (float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
-            rGlyphMap[c].size = glm::ivec2(bitmapWidth, bitmapHeight);
-            rGlyphMap[c].bearing = glm::ivec2(
-                rFace->glyph->bitmap_left,
-                rFace->glyph->bitmap_top);
-
-            // Go over rows and write it mirrored into own buffer
-            std::vector<unsigned char> mirrorBuffer;
-            for (int i = bitmapHeight - 1; i >= 0; i--)
-            {
-                for (int j = 0; j < bitmapWidth; j++)
-                {
-                    mirrorBuffer.push_back(rFace->glyph->bitmap.buffer[i*bitmapWidth + j]);
-                }
-            }
-
-            // Fetch current glyph and bitmap and store it in vector as pair
-            bitmaps.push_back(
-                glyphBitmapPair(
-                    &rGlyphMap[c],
-                    mirrorBuffer));
+            FT_Set_Pixel_Sizes(rFace, 0, rAtlas.pixelHeight);
+            mFacePixelHeight = rAtlas.pixelHeight;
         }
 
-        // Decide, which resolution is minimum when texture would be quadratic
-        int sumPixelWidth = 0;
-        for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+        // Load glyph in face
+        if (FT_Get_Char_Index(rFace, character) == 0 || FT_Load_Char(rFace, character, FT_LOAD_RENDER))
         {
-            sumPixelWidth += rGlyphBitmapPair.first->size.x + 2 * padding;
+            return false;
         }
-        int pixelCount = (pixelHeight + 2 * padding) * sumPixelWidth;
-        float sqrtPixelCount = sqrt((float)pixelCount);
 
-        int i = 5;
-        while (pow(2, i) < sqrtPixelCount)
+        // Determine width and height
+        int bitmapWidth = rFace->glyph->bitmap.width;
+        int bitmapHeight = rFace->glyph->bitmap.rows;
+
+        // Save some values of the glyph
+        Glyph& rGlyph = rEntry.glyph;
+        rGlyph.advance = glm::vec2(
+            (float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
+            (float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
+        rGlyph.size = glm::ivec2(bitmapWidth, bitmapHeight);
+        rGlyph.bearing = glm::ivec2(
+            rFace->glyph->bitmap_left,
+            rFace->glyph->bitmap_top);
+        rGlyph.atlasPosition = glm::vec4(0, 0, 0, 0);
+
+        // Nothing to write for empty bitmap
+        if (bitmapWidth == 0 || bitmapHeight == 0)
         {
-            i++;
+            return true;
         }
-        int xResolution = (int)pow(2, i);
-
-        // Get the maximum resolution of textures on this GPU
-        int maxTextureResolution;
-        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureResolution);
 
-        if (xResolution > maxTextureResolution)
+        // Write bitmap mirrored into cell buffer which includes padding
+        int padding = rAtlas.padding;
+        int cellWidth = bitmapWidth + 2 * padding;
+        int cellHeight = bitmapHeight + 2 * padding;
+        if (cellWidth > mPageResolution || cellHeight > mPageResolution)
         {
             throwError(
                 OperationNotifier::Operation::RUNTIME,
-                "Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
+                "Glyph too big for texture atlas. GPU supported texture size is insufficient",
                 mFilepath);
+            return false;
         }
+        std::vector<GLubyte> cellBuffer(cellWidth * cellHeight, 0);
+        int pitch = rFace->glyph->bitmap.pitch;
+        for (int i = 0; i < bitmapHeight; i++)
+        {
+            const unsigned char* pRow = rFace->glyph->bitmap.buffer + (bitmapHeight - 1 - i) * pitch;
+            std::copy(pRow, pRow + bitmapWidth, cellBuffer.begin() + (i + padding) * cellWidth + padding);
+        }
+
+        // Find space for cell
+        int page, x, y;
+        allocateCell(rAtlas, cellWidth, cellHeight, page, x, y);
+
+        // Enable writing of non power of two
+        GLint oldUnpackAlignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &oldTexture);
+
+        // Write into texture (whole cell, so remains of evicted glyphs are overwritten)
+        glBindTexture(GL_TEXTURE_2D_ARRAY, rAtlas.texture);
+        glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY,
+            0,
+            x,
+            y,
+            page,
+            cellWidth,
+            cellHeight,
+            1,
+            GL_RED,
+            GL_UNSIGNED_BYTE,
+            cellBuffer.data());
+
+        // Restore settings
+        glBindTexture(GL_TEXTURE_2D_ARRAY, oldTexture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
 
-        // Build up rows with vectors of words
-        std::vector<int> rows;
-        std::vector<std::vector<glyphBitmapPair const *> > bitmapOrder;
-        for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+        // Save position in atlas. Index of page is added to horizontal coordinates and separated in shader
+        float resolution = (float)mPageResolution;
+        rGlyph.atlasPosition = glm::vec4(
+            (float)page + (float)(x + padding) / resolution,
+            (float)(y + padding) / resolution,
+            (float)page + (float)(x + padding + bitmapWidth) / resolution,
+            (float)(y + padding + bitmapHeight) / resolution);
+        rEntry.page = page;
+        rAtlas.pages[page].lastUse = ++mUseCounter;
+
+        return true;
+    }
+
+    void AtlasFont::allocateCell(SizedAtlas& rAtlas, int width, int height, int& rPage, int& rX, int& rY) const
+    {
+        // Search shelf which fits best
+        int bestPage = -1;
+        Shelf* pBestShelf = NULL;
+        for (int i = 0; i < (int)rAtlas.pages.size(); i++)
         {
-            // Try different rows
-            int width = rGlyphBitmapPair.first->size.x + 2 * padding;
-            bool check = false;
+            for (Shelf& rShelf : rAtlas.pages[i].shelves)
+            {
+                if (rShelf.height >= height
+                    && rShelf.xPen + width <= mPageResolution
+                    && (pBestShelf == NULL || rShelf.height < pBestShelf->height))
+                {
+                    bestPage = i;
+                    pBestShelf = &rShelf;
+                }
+            }
+        }
 
-            for (uint j = 0; j < rows.size(); j++)
+        // Open new shelf if no existing one is tight enough
+        if (pBestShelf == NULL || pBestShelf->height > (height * 3) / 2)
+        {
+            // Search page with enough space left at top
+            int newShelfPage = -1;
+            for (int i = 0; i < (int)rAtlas.pages.size(); i++)
             {
-                // Does this word fit in this row?
-                if ((rows[j] + width) < xResolution)
+                if (rAtlas.pages[i].yPen + height <= mPageResolution)
                 {
-                    rows[j] += width;
-                    bitmapOrder[j].push_back(&rGlyphBitmapPair);
-                    check = true;
+                    newShelfPage = i;
                     break;
                 }
             }
-            if (!check)
+
+            // Add or evict page if there is no space at all
+            if (newShelfPage < 0 && pBestShelf == NULL)
+            {
+                if ((int)rAtlas.pages.size() < FONT_ATLAS_MAX_PAGE_COUNT)
+                {
+                    addPage(rAtlas);
+                    newShelfPage = (int)rAtlas.pages.size() - 1;
+                }
+                else
+                {
+                    newShelfPage = evictPage(rAtlas);
+                }
+            }
+
+            // Create shelf
+            if (newShelfPage >= 0)
             {
-                // No more room in existing rows, add more
-                rows.push_back(width);
-                std::vector<glyphBitmapPair const *> rowBitmapOrder;
-                rowBitmapOrder.push_back(&rGlyphBitmapPair);
-                bitmapOrder.push_back(rowBitmapOrder);
+                Page& rPage = rAtlas.pages[newShelfPage];
+                rPage.shelves.push_back({ rPage.yPen, height, 0 });
+                rPage.yPen += height;
+                bestPage = newShelfPage;
+                pBestShelf = &(rPage.shelves.back());
             }
         }
 
-        // Calculate necessary rows
-        i = 5;
-        int yResolution = (int)rows.size() * (pixelHeight + 2 * padding);
-        while (pow(2, i) < yResolution)
+        // Put cell into shelf
+        rPage = bestPage;
+        rX = pBestShelf->xPen;
+        rY = pBestShelf->y;
+        pBestShelf->xPen += width;
+    }
+
+    void AtlasFont::addPage(SizedAtlas& rAtlas) const
+    {
+        int oldPageCount = (int)rAtlas.pages.size();
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &oldTexture);
+
+        // Create array texture with one more layer (filtering set at texture binding)
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage3D(
+            GL_TEXTURE_2D_ARRAY,
+            0,
+            GL_R8,
+            mPageResolution,
+            mPageResolution,
+            oldPageCount + 1,
+            0,
+            GL_RED,
+            GL_UNSIGNED_BYTE,
+            NULL);
+
+        // Copy existing pages on the GPU
+        if (rAtlas.texture != 0)
         {
-            i++;
+            GLint oldReadFramebuffer = 0;
+            glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldReadFramebuffer);
+            GLuint framebuffer = 0;
+            glGenFramebuffers(1, &framebuffer);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+            for (int i = 0; i < oldPageCount; i++)
+            {
+                glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, rAtlas.texture, 0, i);
+                glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, 0, 0, mPageResolution, mPageResolution);
+            }
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, oldReadFramebuffer);
+            glDeleteFramebuffers(1, &framebuffer);
+            glDeleteTextures(1, &(rAtlas.texture));
         }
 
-        // Let's make y resolution also power of two
-        yResolution = (int)pow(2, i);
+        // Restore binding
+        glBindTexture(GL_TEXTURE_2D_ARRAY, oldTexture);
+
+        // Use new texture
+        rAtlas.texture = texture;
+        rAtlas.pages.push_back(Page());
+    }
 
-        // Do check for vertical resolution as well
-        if (yResolution > maxTextureResolution)
+    int AtlasFont::evictPage(SizedAtlas& rAtlas) const
+    {
+        // Find least recently used page
+        int page = 0;
+        for (int i = 1; i < (int)rAtlas.pages.size(); i++)
         {
-            throwError(
-                OperationNotifier::Operation::RUNTIME,
-                "Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
-                mFilepath);
+            if (rAtlas.pages[i].lastUse < rAtlas.pages[page].lastUse)
+            {
+                page = i;
+            }
         }
 
-        // Enable writing of non power of two
-        GLint oldUnpackAlignment = 4;
-        glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        // Remove glyphs from page, their metrics are kept
+        for (auto& rPair : rAtlas.glyphs)
+        {
+            if (rPair.second.page == page)
+            {
+                rPair.second.page = -1;
+            }
+        }
+        rAtlas.pages[page] = Page();
 
-        // Initialize texture for atlas (filtering set at texture binding)
-        glBindTexture(GL_TEXTURE_2D, textureHandle);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // Texture coordinates of texts using this atlas are outdated now
+        rAtlas.generation = ++mGenerationCounter;
 
-        std::vector<GLubyte> emptyData(xResolution * yResolution, 0);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_R8,
-            xResolution,
-            yResolution,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            emptyData.data());
+        return page;
+    }
 
-        // Write bitmaps into texture and save further values to the glyph
-        int yPen = yResolution - pixelHeight - 2 * padding;
-        for (uint i = 0; i < bitmapOrder.size(); i++)
+    AtlasFont::SizedAtlas* AtlasFont::fetchSizedAtlas(int pixelHeight)
+    {
+        // Look for existing atlas and move it to front
+        for (auto it = mSizedAtlases.begin(); it != mSizedAtlases.end(); it++)
         {
-            int xPen = 0;
-            for (uint j = 0; j < bitmapOrder[i].size(); j++)
+            if ((*it)->pixelHeight == pixelHeight)
             {
-                int bitmapWidth = bitmapOrder[i][j]->first->size.x;
-                int bitmapHeight = bitmapOrder[i][j]->first->size.y;
-
-                // Write into texture
-                glTexSubImage2D(
-                    GL_TEXTURE_2D,
-                    0,
-                    xPen + padding,
-                    yPen + padding,
-                    bitmapWidth,
-                    bitmapHeight,
-                    GL_RED,
-                    GL_UNSIGNED_BYTE,
-                    bitmapOrder[i][j]->second.data());
-
-                // Save further values to glyph structure
-                bitmapOrder[i][j]->first->atlasPosition = glm::vec4(
-                    (float)(xPen + padding) / xResolution,
-                    (float)(yPen + padding) / yResolution,
-                    (float)(xPen + padding + bitmapWidth) / xResolution,
-                    (float)(yPen + padding + bitmapHeight) / yResolution);
-
-                // Advance pen
-                xPen += bitmapWidth + 2 * padding;
+                mSizedAtlases.splice(mSizedAtlases.begin(), mSizedAtlases, it);
+                return mSizedAtlases.front().get();
             }
-
-            // Advance pen
-            yPen -= pixelHeight + 2 * padding;
         }
 
-        // Unbind texture
-        glBindTexture(GL_TEXTURE_2D, 0);
+        // Create new atlas with first page
+        std::unique_ptr<SizedAtlas> upAtlas = std::unique_ptr<SizedAtlas>(new SizedAtlas);
+        upAtlas->pixelHeight = pixelHeight;
+        upAtlas->padding = calculatePadding(pixelHeight);
+        upAtlas->generation = ++mGenerationCounter;
+        addPage(*(upAtlas.get()));
+        mSizedAtlases.push_front(std::move(upAtlas));
+        return mSizedAtlases.front().get();
+    }
 
-        // Reset unpack alignment
-        glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+    int AtlasFont::calculatePadding(int pixelHeight) const
+    {
+        return std::max(
+            FONT_MINIMAL_CHARACTER_PADDING,
+            (int)(pixelHeight * FONT_CHARACTER_PADDING));
     }
 }
@@ -5,7 +5,10 @@
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Font implementation using FreeType library to render glyphs as bitmaps
-// onto a texture atlas.
+// onto texture atlases. Glyphs are rasterized at first use and cached per
+// pixel size. Each pixel size owns an array texture, whose layers are pages
+// packed in shelves. When all pages are full, the least recently used page
+// is cleared and its glyphs are rasterized again when requested.
 
 #ifndef ATLAS_FONT_H_
 #define ATLAS_FONT_H_
@@ -16,9 +19,10 @@
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <memory>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <list>
 #include <vector>
+#include <array>
 
 #include FT_FREETYPE_H
 
@@ -32,8 +36,7 @@ namespace eyegui
         AtlasFont(
             GUI const * pGUI,
             std::string filepath,
-            std::unique_ptr<FT_Face> upFace,
-            std::set<char16_t> characterSet);
+            std::unique_ptr<FT_Face> upFace);
 
         // Destructor
         virtual ~AtlasFont();
@@ -41,7 +44,7 @@ namespace eyegui
         // Resize font atlases
         virtual void resizeFontAtlases();
 
-        // Get glyph (may return NULL if not found)
+        // Get glyph (may return NULL if not found). Rasterizes glyph if necessary
         virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const;
 
         // Get height of line
@@ -53,54 +56,86 @@ namespace eyegui
         // Bind atlas texture of font
         virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const;
 
+        // Get generation of atlas
+        virtual uint getAtlasGeneration(FontSize fontSize) const;
+
     private:
 
-        // Get glyph (may return NULL if not found)
-        Glyph const * getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const;
+        // Entry of glyph in atlas
+        struct GlyphEntry
+        {
+            Glyph glyph;
+            int page = -1; // -1 when bitmap is not in atlas
+            bool missing = false; // not covered by font file
+        };
+
+        // Row of glyphs in page
+        struct Shelf
+        {
+            int y;
+            int height;
+            int xPen;
+        };
+
+        // Layer of atlas texture
+        struct Page
+        {
+            std::vector<Shelf> shelves;
+            int yPen = 0;
+            uint lastUse = 0;
+        };
+
+        // Atlas for one pixel size
+        struct SizedAtlas
+        {
+            int pixelHeight;
+            int padding;
+            GLuint texture = 0;
+            std::vector<Page> pages;
+            std::unordered_map<char16_t, GlyphEntry> glyphs; // entries are never erased, so pointers stay valid
+            uint generation = 0;
+        };
+
+        // Get glyph from atlas, rasterize it when not in atlas (may return NULL if not found)
+        Glyph const * getGlyph(SizedAtlas& rAtlas, char16_t character) const;
+
+        // Rasterize glyph and write it into atlas. Returns false if character is not covered by font
+        bool rasterizeGlyph(SizedAtlas& rAtlas, char16_t character, GlyphEntry& rEntry) const;
+
+        // Find space in pages of atlas. Adds or evicts page if necessary
+        void allocateCell(SizedAtlas& rAtlas, int width, int height, int& rPage, int& rX, int& rY) const;
+
+        // Add page to atlas by copying existing layers into bigger array texture
+        void addPage(SizedAtlas& rAtlas) const;
+
+        // Clear least recently used page. Glyphs on it are rasterized again when requested
+        int evictPage(SizedAtlas& rAtlas) const;
+
+        // Get atlas for pixel size, created if necessary
+        SizedAtlas* fetchSizedAtlas(int pixelHeight);
 
         // Calculate padding
-        int calculatePadding(int pixelHeight);
-
-        // Fill pixel heights
-        void fillPixelHeights();
-
-        // Fill all atlases
-        void fillAtlases();
-
-        // Fill atlas
-        void fillAtlas(
-            int pixelHeight,
-            std::map<char16_t, Glyph>& rGlyphMap,
-            float& rLineHeight,
-            GLuint textureHandle,
-            int padding);
+        int calculatePadding(int pixelHeight) const;
 
         // Members
         GUI const * mpGUI;
         std::unique_ptr<FT_Face> mupFace;
-        std::set<char16_t> mCharacterSet;
-
-        std::map<char16_t, Glyph> mTallGlyphs;
-        std::map<char16_t, Glyph> mMediumGlyphs;
-        std::map<char16_t, Glyph> mSmallGlyphs;
-        std::map<char16_t, Glyph> mKeyboardGlyphs;
+        std::string mFilepath;
+        int mPageResolution;
 
-        float mTallLinePixelHeight;
-        float mMediumLinePixelHeight;
-        float mSmallLinePixelHeight;
-        float mKeyboardLinePixelHeight;
+        // Atlases per pixel size. Most recently used ones are at front
+        std::list<std::unique_ptr<SizedAtlas> > mSizedAtlases;
 
-        GLuint mTallTexture;
-        GLuint mMediumTexture;
-        GLuint mSmallTexture;
-        GLuint mKeyboardTexture;
+        // Atlas and pixel height of each font size
+        std::array<SizedAtlas*, 4> mFontSizeAtlases;
+        std::array<int, 4> mPixelHeights;
 
-        int mTallPixelHeight;
-        int mMediumPixelHeight;
-        int mSmallPixelHeight;
-        int mKeyboardPixelHeight;
+        // Pixel size currently set at face
+        mutable int mFacePixelHeight;
 
-        std::string mFilepath;
+        // Counters for use of pages and generation of atlases
+        mutable uint mUseCounter;
+        mutable uint mGenerationCounter;
     };
 }
 
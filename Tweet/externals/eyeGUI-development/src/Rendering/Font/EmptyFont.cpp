@@ -66,4 +66,9 @@ namespace eyegui
         // Nothing to do
     }
 
+    uint EmptyFont::getAtlasGeneration(FontSize fontSize) const
+    {
+        return 0;
+    }
+
 }
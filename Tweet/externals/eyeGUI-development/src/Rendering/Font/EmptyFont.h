@@ -42,6 +42,9 @@ namespace eyegui
         // Bind atlas texture of font
         virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const;
 
+        // Get generation of atlas
+        virtual uint getAtlasGeneration(FontSize fontSize) const;
+
     private:
 
         // Members
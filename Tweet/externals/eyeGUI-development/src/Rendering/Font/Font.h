@@ -18,7 +18,7 @@ namespace eyegui
 {
     struct Glyph
     {
-        glm::vec4	atlasPosition;	// Position in atlas (minU, minV, maxU, maxV)
+        glm::vec4	atlasPosition;	// Position in atlas (minU, minV, maxU, maxV). Integer part of u is layer of atlas
         glm::ivec2  size;			// Size in pixel
         glm::ivec2	bearing;		// Offset from baseline to left / top of glyph in pixel
         glm::vec2	advance;        // Offset to advance to next glyph in pixel
@@ -48,6 +48,9 @@ namespace eyegui
 
         // Bind atlas texture of font
         virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const = 0;
+
+        // Get generation of atlas. Changes when texture coordinates of glyphs became invalid
+        virtual uint getAtlasGeneration(FontSize fontSize) const = 0;
     };
 }
 
@@ -143,9 +143,9 @@ namespace eyegui
             // Projection
             matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
 
-            mpLine->getShader()->fillValue("matrix", matrix);
-            mpLine->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpLine->getShader()->fillValue("alpha", mPoints[i].alpha.getValue());
+            mpLine->getShader()->fillValue(ShaderUniform::MATRIX, matrix);
+            mpLine->getShader()->fillValue(ShaderUniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+            mpLine->getShader()->fillValue(ShaderUniform::ALPHA, mPoints[i].alpha.getValue());
             mpLine->draw(GL_LINES);
         }
 
@@ -177,9 +177,9 @@ namespace eyegui
             matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
 
             // Set values
-            mpCircle->getShader()->fillValue("matrix", matrix);
-            mpCircle->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpCircle->getShader()->fillValue("alpha", rGazePoint.alpha.getValue());
+            mpCircle->getShader()->fillValue(ShaderUniform::MATRIX, matrix);
+            mpCircle->getShader()->fillValue(ShaderUniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+            mpCircle->getShader()->fillValue(ShaderUniform::ALPHA, rGazePoint.alpha.getValue());
 
             // Draw
             mpCircle->draw();
@@ -0,0 +1,254 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "RenderQueue.h"
+
+#include "src/Rendering/AssetManager.h"
+#include "src/Rendering/ScissorStack.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace eyegui
+{
+    RenderQueue::RenderQueue(AssetManager* pAssetManager)
+    {
+        // Fill members
+        mpAssetManager = pAssetManager;
+        mpShader = mpAssetManager->fetchShader(shaders::Type::BATCH);
+        mpCircleMask = mpAssetManager->fetchTexture(graphics::Type::CIRCLE);
+        mBatchCount = 0;
+        mInstanceCapacity = 0;
+
+        // Save currently set buffer and vertex array object
+        GLint oldBuffer = -1;
+        GLint oldVAO = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+
+        // Initialize instance buffer and vertex array object
+        glGenBuffers(1, &mInstanceBuffer);
+        glGenVertexArrays(1, &mVertexArrayObject);
+        glBindVertexArray(mVertexArrayObject);
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+
+        // Attributes advance per instance, pointers are set for each batch
+        mRectAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "rectAttribute");
+        mUVAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
+        mColorAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "colorAttribute");
+        mMaskAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "maskAttribute");
+        for (GLuint attrib : { mRectAttrib, mUVAttrib, mColorAttrib, mMaskAttrib })
+        {
+            glEnableVertexAttribArray(attrib);
+            glVertexAttribDivisor(attrib, 1);
+        }
+
+        // Restore old settings
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        glBindVertexArray(oldVAO);
+    }
+
+    RenderQueue::~RenderQueue()
+    {
+        // Delete vertex array object
+        glDeleteVertexArrays(1, &mVertexArrayObject);
+
+        // Delete buffer
+        glDeleteBuffers(1, &mInstanceBuffer);
+    }
+
+    void RenderQueue::enqueueQuad(
+        int x,
+        int y,
+        int width,
+        int height,
+        glm::vec4 color,
+        bool circleMask,
+        bool radialGradient)
+    {
+        // Invisible quads are not worth a record
+        glm::ivec4 rect;
+        if (color.a <= 0 || !clip(x, y, width, height, rect))
+        {
+            return;
+        }
+
+        // Texture coordinates of clipped rectangle, origin of them is in lower left
+        QuadInstance instance;
+        instance.rect = glm::vec4(rect);
+        instance.uvRect = glm::vec4(
+            (float)(rect.x - x) / (float)width,
+            (float)(y + height - rect.w) / (float)height,
+            (float)(rect.z - x) / (float)width,
+            (float)(y + height - rect.y) / (float)height);
+        instance.color = color;
+        instance.maskUsage = glm::vec2(circleMask ? 1.f : 0.f, radialGradient ? 1.f : 0.f);
+
+        // Add to batch
+        Batch& rBatch = findBatch(true, rect);
+        rBatch.quadInstances.push_back(instance);
+    }
+
+    void RenderQueue::enqueueCallback(
+        int x,
+        int y,
+        int width,
+        int height,
+        Texture const * pMask,
+        std::function<void()> callback)
+    {
+        glm::ivec4 rect;
+        if (!clip(x, y, width, height, rect))
+        {
+            return;
+        }
+
+        // Add to batch
+        Batch& rBatch = findBatch(false, rect);
+        Callback record;
+        record.rect = rect;
+        record.pMask = pMask;
+        record.function = std::move(callback);
+        rBatch.callbacks.push_back(std::move(record));
+    }
+
+    void RenderQueue::flush(int windowWidth, int windowHeight)
+    {
+        // Collect instances of all batches, so they can be uploaded at once
+        mInstances.clear();
+        for (uint i = 0; i < mBatchCount; i++)
+        {
+            const Batch& rBatch = mBatches[i];
+            mInstances.insert(mInstances.end(), rBatch.quadInstances.begin(), rBatch.quadInstances.end());
+        }
+
+        // Upload instances
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+        GLuint instanceCount = (GLuint)mInstances.size();
+        if (instanceCount > mInstanceCapacity)
+        {
+            mInstanceCapacity = std::max(instanceCount, 2 * mInstanceCapacity);
+            glBufferData(GL_ARRAY_BUFFER, mInstanceCapacity * sizeof(QuadInstance), NULL, GL_DYNAMIC_DRAW);
+        }
+        if (instanceCount > 0)
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(QuadInstance), mInstances.data());
+        }
+
+        // Go over batches
+        glm::ivec4 window(0, 0, windowWidth, windowHeight);
+        GLuint firstInstance = 0;
+        for (uint i = 0; i < mBatchCount; i++)
+        {
+            Batch& rBatch = mBatches[i];
+            if (rBatch.quads)
+            {
+                // Quads are already clipped
+                ScissorStack::restore(window);
+
+                // Point attributes to instances of batch (no base instance in OpenGL 3.3)
+                glBindVertexArray(mVertexArrayObject);
+                GLsizei stride = sizeof(QuadInstance);
+                size_t offset = firstInstance * sizeof(QuadInstance);
+                glVertexAttribPointer(mRectAttrib, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(offset + offsetof(QuadInstance, rect)));
+                glVertexAttribPointer(mUVAttrib, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(offset + offsetof(QuadInstance, uvRect)));
+                glVertexAttribPointer(mColorAttrib, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(offset + offsetof(QuadInstance, color)));
+                glVertexAttribPointer(mMaskAttrib, 2, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(offset + offsetof(QuadInstance, maskUsage)));
+
+                // Draw all quads of batch at once
+                mpShader->bind();
+                mpShader->fillValue(ShaderUniform::RESOLUTION, glm::vec2(windowWidth, windowHeight));
+                mpShader->fillValue(ShaderUniform::MASK, 0); // mask is always in slot 0
+                mpCircleMask->bind(0);
+                glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)rBatch.quadInstances.size());
+                firstInstance += (GLuint)rBatch.quadInstances.size();
+            }
+            else
+            {
+                // Execute callbacks in order
+                for (const Callback& rCallback : rBatch.callbacks)
+                {
+                    ScissorStack::restore(rCallback.rect);
+                    if (rCallback.pMask != NULL)
+                    {
+                        rCallback.pMask->bind(0);
+                    }
+                    rCallback.function();
+                }
+            }
+
+            // Clear batch but keep its memory
+            rBatch.rects.clear();
+            rBatch.quadInstances.clear();
+            rBatch.callbacks.clear();
+        }
+        mBatchCount = 0;
+
+        // Restore scissor and buffer
+        ScissorStack::restore(window);
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    }
+
+    RenderQueue::Batch& RenderQueue::findBatch(bool quads, const glm::ivec4& rRect)
+    {
+        // Search backwards for batch of same kind, records in between must not overlap
+        int lastCandidate = std::max(0, (int)mBatchCount - (int)RENDER_QUEUE_LOOK_BACK);
+        for (int i = (int)mBatchCount - 1; i >= lastCandidate; i--)
+        {
+            Batch& rBatch = mBatches[i];
+            if (rBatch.quads == quads)
+            {
+                rBatch.rects.push_back(rRect);
+                rBatch.bounds = glm::ivec4(
+                    glm::min(rBatch.bounds.x, rRect.x),
+                    glm::min(rBatch.bounds.y, rRect.y),
+                    glm::max(rBatch.bounds.z, rRect.z),
+                    glm::max(rBatch.bounds.w, rRect.w));
+                return rBatch;
+            }
+
+            // Check bounds first and single records only when necessary
+            if (overlap(rBatch.bounds, rRect)
+                && std::any_of(
+                    rBatch.rects.begin(),
+                    rBatch.rects.end(),
+                    [&](const glm::ivec4& rOther) { return overlap(rOther, rRect); }))
+            {
+                break;
+            }
+        }
+
+        // Append new batch, reusing one of previous frames if available
+        if (mBatchCount == mBatches.size())
+        {
+            mBatches.push_back(Batch());
+        }
+        Batch& rBatch = mBatches[mBatchCount++];
+        rBatch.quads = quads;
+        rBatch.bounds = rRect;
+        rBatch.rects.push_back(rRect);
+        return rBatch;
+    }
+
+    bool RenderQueue::clip(int x, int y, int width, int height, glm::ivec4& rRect)
+    {
+        glm::ivec4 scissor = ScissorStack::getCurrent();
+        rRect = glm::ivec4(
+            glm::max(x, scissor.x),
+            glm::max(y, scissor.y),
+            glm::min(x + width, scissor.z),
+            glm::min(y + height, scissor.w));
+        return rRect.x < rRect.z && rRect.y < rRect.w;
+    }
+
+    bool RenderQueue::overlap(const glm::ivec4& rA, const glm::ivec4& rB)
+    {
+        return rA.x < rB.z && rB.x < rA.z && rA.y < rB.w && rB.y < rA.w;
+    }
+}
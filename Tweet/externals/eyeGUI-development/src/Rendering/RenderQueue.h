@@ -0,0 +1,120 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Queue collecting draw records of elements during drawing and submitting
+// them at the end of the frame. Colored quads like backgrounds, dimming or
+// highlighting share one material and are drawn as instances. A record may
+// join an earlier batch of the same kind as long as it does not overlap any
+// record enqueued after that batch, so the result of blending stays the same.
+// Everything else is enqueued as callback and executed in order.
+
+#ifndef RENDER_QUEUE_H_
+#define RENDER_QUEUE_H_
+
+#include "src/Defines.h"
+#include "src/Rendering/Shader.h"
+#include "src/Rendering/Textures/Texture.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "externals/GLM/glm/glm.hpp"
+
+#include <vector>
+#include <functional>
+
+namespace eyegui
+{
+    // Forward declaration
+    class AssetManager;
+
+    class RenderQueue
+    {
+    public:
+
+        // Constructor
+        RenderQueue(AssetManager* pAssetManager);
+
+        // Destructor
+        virtual ~RenderQueue();
+
+        // Enqueue colored quad in pixel space, clipped by current scissor. Circle
+        // mask and radial gradient are applied to alpha if wished
+        void enqueueQuad(
+            int x,
+            int y,
+            int width,
+            int height,
+            glm::vec4 color,
+            bool circleMask = false,
+            bool radialGradient = false);
+
+        // Enqueue callback drawing into given rectangle. Scissor is set to the
+        // rectangle clipped by current scissor and mask is bound to slot 0 at call
+        void enqueueCallback(
+            int x,
+            int y,
+            int width,
+            int height,
+            Texture const * pMask,
+            std::function<void()> callback);
+
+        // Draw everything enqueued and clear queue
+        void flush(int windowWidth, int windowHeight);
+
+    private:
+
+        // Instance of quad as stored in buffer
+        struct QuadInstance
+        {
+            glm::vec4 rect; // minX, minY, maxX, maxY in pixels with origin in upper left
+            glm::vec4 uvRect; // texture coordinates at lower left and upper right corner
+            glm::vec4 color; // alpha already multiplied
+            glm::vec2 maskUsage; // usage of circle mask and radial gradient
+        };
+
+        // Callback with its clipped rectangle
+        struct Callback
+        {
+            glm::ivec4 rect; // minX, minY, maxX, maxY in pixels with origin in upper left
+            Texture const * pMask;
+            std::function<void()> function;
+        };
+
+        // Batch of records of one kind. Vectors are kept between frames
+        struct Batch
+        {
+            bool quads; // either quads or callbacks
+            glm::ivec4 bounds; // union of all records
+            std::vector<glm::ivec4> rects; // rectangles of records
+            std::vector<QuadInstance> quadInstances;
+            std::vector<Callback> callbacks;
+        };
+
+        // Find batch which may take record with given rectangle
+        Batch& findBatch(bool quads, const glm::ivec4& rRect);
+
+        // Clip rectangle by current scissor. Returns false if nothing remains
+        static bool clip(int x, int y, int width, int height, glm::ivec4& rRect);
+
+        // Check whether rectangles overlap
+        static bool overlap(const glm::ivec4& rA, const glm::ivec4& rB);
+
+        // Members
+        AssetManager* mpAssetManager;
+        Shader const * mpShader;
+        Texture const * mpCircleMask;
+        std::vector<Batch> mBatches;
+        uint mBatchCount;
+        std::vector<QuadInstance> mInstances; // instances of all batches in order of drawing
+        GLuint mInstanceCapacity;
+        GLuint mInstanceBuffer;
+        GLuint mVertexArrayObject;
+        GLuint mRectAttrib;
+        GLuint mUVAttrib;
+        GLuint mColorAttrib;
+        GLuint mMaskAttrib;
+    };
+}
+
+#endif // RENDER_QUEUE_H_
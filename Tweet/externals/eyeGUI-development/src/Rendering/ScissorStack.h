@@ -46,6 +46,18 @@ namespace eyegui
 			getInstance()->internalInitForDrawing(width, height);
 		}
 
+		// Get current intersection as minX, minY, maxX, maxY with origin in upper left corner
+		static glm::ivec4 getCurrent()
+		{
+			return getInstance()->intersect();
+		}
+
+		// Replace stack by single rect given as minX, minY, maxX, maxY (used by render queue)
+		static void restore(const glm::ivec4& rRect)
+		{
+			getInstance()->internalRestore(rRect);
+		}
+
 	private:
 
 		// Struct for rect (origin in upper left corner)
@@ -112,8 +124,16 @@ namespace eyegui
 			scissor();
 		}
 
-		// Do scissoring
-		void scissor() const
+		// Replace stack by single rect
+		void internalRestore(const glm::ivec4& rRect)
+		{
+			mRects.clear();
+			mRects.push_back(Rect(rRect.x, rRect.y, rRect.z - rRect.x, rRect.w - rRect.y));
+			scissor();
+		}
+
+		// Intersect rects of stack
+		glm::ivec4 intersect() const
 		{
 			// Go over stack and intersect in space with origin in upper left corner
 			int x1 = 0;
@@ -138,8 +158,15 @@ namespace eyegui
 				if (y1 > y2) { y2 = y1; }	
 			}
 
+			return glm::ivec4(x1, y1, x2, y2);
+		}
+
+		// Do scissoring
+		void scissor() const
+		{
 			// Transform to OpenGL space
-			glScissor(x1, mWindowHeight - y2, x2 - x1, y2 - y1);
+			glm::ivec4 rect = intersect();
+			glScissor(rect.x, mWindowHeight - rect.w, rect.z - rect.x, rect.w - rect.y);
 		}
 
 		// Check for instance existence
@@ -11,9 +11,21 @@
 #include "src/Utilities/OperationNotifier.h"
 
 #include <fstream>
+#include <climits>
 
 namespace eyegui
 {
+    // Names of uniforms in same order as enumeration
+    static const char* const SHADER_UNIFORM_NAMES[] =
+    {
+        "matrix", "color", "alpha", "mask", "icon", "atlas", "image", "scale", "resolution",
+        "threshold", "thresholdColor", "orientation",
+        "iconColor", "iconUVScale", "pressing", "penetration", "pick", "pickColor"
+    };
+    static_assert(
+        sizeof(SHADER_UNIFORM_NAMES) / sizeof(SHADER_UNIFORM_NAMES[0]) == (int)ShaderUniform::COUNT,
+        "Each shader uniform needs a name");
+
     Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
     {
         // Vertex shader
@@ -60,6 +72,14 @@ namespace eyegui
             // Save mapping from name to location in map
             mUniformLocationCache[name] = glGetUniformLocation(mShaderProgram, name);
         }
+
+        // Resolve locations of known uniforms
+        for (int i = 0; i < (int)ShaderUniform::COUNT; i++)
+        {
+            auto it = mUniformLocationCache.find(SHADER_UNIFORM_NAMES[i]);
+            mUniformLocations[i] = it != mUniformLocationCache.end() ? it->second : -1;
+        }
+        mIntegerValues.fill(INT_MIN);
     }
 
     Shader::~Shader()
@@ -72,34 +92,70 @@ namespace eyegui
         glUseProgram(mShaderProgram);
     }
 
-        void Shader::fillValue(std::string location, const int rValue) const
+    void Shader::fillValue(ShaderUniform uniform, const int rValue) const
+    {
+        // Skip value which is already set
+        int& rCurrent = mIntegerValues[(int)uniform];
+        if (rCurrent != rValue)
+        {
+            glUniform1i(location(uniform), rValue);
+            rCurrent = rValue;
+        }
+    }
+
+    void Shader::fillValue(ShaderUniform uniform, const float rValue) const
+    {
+        glUniform1fv(location(uniform), 1, &rValue);
+    }
+
+    void Shader::fillValue(ShaderUniform uniform, const glm::vec2& rValue) const
+    {
+        glUniform2fv(location(uniform), 1, glm::value_ptr(rValue));
+    }
+
+    void Shader::fillValue(ShaderUniform uniform, const glm::vec3& rValue) const
+    {
+        glUniform3fv(location(uniform), 1, glm::value_ptr(rValue));
+    }
+
+    void Shader::fillValue(ShaderUniform uniform, const glm::vec4& rValue) const
+    {
+        glUniform4fv(location(uniform), 1, glm::value_ptr(rValue));
+    }
+
+    void Shader::fillValue(ShaderUniform uniform, const glm::mat4x4& rValue) const
+    {
+        glUniformMatrix4fv(location(uniform), 1, GL_FALSE, glm::value_ptr(rValue));
+    }
+
+    void Shader::fillValue(const std::string& rLocation, const int rValue) const
     {
-        glUniform1i(mUniformLocationCache.at(location), rValue);
+        glUniform1i(mUniformLocationCache.at(rLocation), rValue);
     }
 
-    void Shader::fillValue(std::string location, const float rValue) const
+    void Shader::fillValue(const std::string& rLocation, const float rValue) const
     {
-        glUniform1fv(mUniformLocationCache.at(location), 1, &rValue);
+        glUniform1fv(mUniformLocationCache.at(rLocation), 1, &rValue);
     }
 
-    void Shader::fillValue(std::string location, const glm::vec2& rValue) const
+    void Shader::fillValue(const std::string& rLocation, const glm::vec2& rValue) const
     {
-        glUniform2fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        glUniform2fv(mUniformLocationCache.at(rLocation), 1, glm::value_ptr(rValue));
     }
 
-    void Shader::fillValue(std::string location, const glm::vec3& rValue) const
+    void Shader::fillValue(const std::string& rLocation, const glm::vec3& rValue) const
     {
-        glUniform3fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        glUniform3fv(mUniformLocationCache.at(rLocation), 1, glm::value_ptr(rValue));
     }
 
-    void Shader::fillValue(std::string location, const glm::vec4& rValue) const
+    void Shader::fillValue(const std::string& rLocation, const glm::vec4& rValue) const
     {
-        glUniform4fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        glUniform4fv(mUniformLocationCache.at(rLocation), 1, glm::value_ptr(rValue));
     }
 
-    void Shader::fillValue(std::string location, const glm::mat4x4& rValue) const
+    void Shader::fillValue(const std::string& rLocation, const glm::mat4x4& rValue) const
     {
-        glUniformMatrix4fv(mUniformLocationCache.at(location), 1, GL_FALSE, glm::value_ptr(rValue));
+        glUniformMatrix4fv(mUniformLocationCache.at(rLocation), 1, GL_FALSE, glm::value_ptr(rValue));
     }
 
     GLuint Shader::getShaderProgram() const
@@ -4,7 +4,9 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Encapsulation of the OpenGL shader creation and usage.
+// Encapsulation of the OpenGL shader creation and usage. Locations of known
+// uniforms are resolved once at link time and filled via enumeration. Filling
+// via name is slower and only kept for uniforms not covered by the enumeration.
 
 #ifndef SHADER_H_
 #define SHADER_H_
@@ -14,9 +16,19 @@
 
 #include <string>
 #include <map>
+#include <array>
 
 namespace eyegui
 {
+    // Uniforms used by internal shaders
+    enum class ShaderUniform
+    {
+        MATRIX, COLOR, ALPHA, MASK, ICON, ATLAS, IMAGE, SCALE, RESOLUTION,
+        THRESHOLD, THRESHOLD_COLOR, ORIENTATION,
+        ICON_COLOR, ICON_UV_SCALE, PRESSING, PENETRATION, PICK, PICK_COLOR,
+        COUNT // has to be last entry
+    };
+
     class Shader
     {
     public:
@@ -30,13 +42,21 @@ namespace eyegui
         // Bind shader for filling uniforms and rendering
         void bind() const;
 
-        // Fill value for rendering
-        void fillValue(std::string location, const int rValue) const;
-        void fillValue(std::string location, const float rValue) const;
-        void fillValue(std::string location, const glm::vec2& rValue) const;
-        void fillValue(std::string location, const glm::vec3& rValue) const;
-        void fillValue(std::string location, const glm::vec4& rValue) const;
-        void fillValue(std::string location, const glm::mat4x4& rValue) const;
+        // Fill value for rendering, shader has to be bound
+        void fillValue(ShaderUniform uniform, const int rValue) const;
+        void fillValue(ShaderUniform uniform, const float rValue) const;
+        void fillValue(ShaderUniform uniform, const glm::vec2& rValue) const;
+        void fillValue(ShaderUniform uniform, const glm::vec3& rValue) const;
+        void fillValue(ShaderUniform uniform, const glm::vec4& rValue) const;
+        void fillValue(ShaderUniform uniform, const glm::mat4x4& rValue) const;
+
+        // Fill value by name, slow path
+        void fillValue(const std::string& rLocation, const int rValue) const;
+        void fillValue(const std::string& rLocation, const float rValue) const;
+        void fillValue(const std::string& rLocation, const glm::vec2& rValue) const;
+        void fillValue(const std::string& rLocation, const glm::vec3& rValue) const;
+        void fillValue(const std::string& rLocation, const glm::vec4& rValue) const;
+        void fillValue(const std::string& rLocation, const glm::mat4x4& rValue) const;
 
         // Getter for handle
         GLuint getShaderProgram() const;
@@ -46,9 +66,14 @@ namespace eyegui
         // Evaluate shader compiling log
         void evaluateShaderLog(GLuint handle) const;
 
+        // Location of uniform, -1 if not used by shader
+        GLint location(ShaderUniform uniform) const { return mUniformLocations[(int)uniform]; }
+
         // Member
         GLuint mShaderProgram;
         std::map<std::string, int> mUniformLocationCache;
+        std::array<GLint, (int)ShaderUniform::COUNT> mUniformLocations;
+        mutable std::array<int, (int)ShaderUniform::COUNT> mIntegerValues; // integer uniforms are texture slots which rarely change
     };
 }
 
@@ -24,60 +24,69 @@ namespace eyegui
             "   gl_Position = matrix * vec4(posAttribute, 1);\n"
             "}\n";
 
-        static const char* pColorFragmentShader =
+        static const char* pTextVertexShader =
             "#version 330 core\n"
-            "out vec4 fragColor;\n"
-            "uniform vec4 color = vec4(1,1,1,1);\n"
-            "uniform float alpha = 1;\n"
+            "in vec4 rectAttribute;\n" // one instance per glyph
+            "in vec4 atlasAttribute;\n"
+            "out vec2 uv;\n"
+            "uniform mat4 matrix = mat4(1.0);\n"
             "void main() {\n"
-            "   fragColor = vec4(color.rgb, color.a * alpha);\n"
+            "   vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n" // quad as triangle strip
+            "   uv = mix(atlasAttribute.xy, atlasAttribute.zw, corner);\n"
+            "   gl_Position = matrix * vec4(mix(rectAttribute.xy, rectAttribute.zw, corner), 0, 1);\n"
             "}\n";
 
-        static const char* pCircleFragmentShader =
+        static const char* pBatchVertexShader =
             "#version 330 core\n"
-            "out vec4 fragColor;\n"
-            "in vec2 uv;\n"
-            "uniform vec4 color = vec4(1,1,1,1);\n"
-            "uniform float alpha = 1;\n"
+            "in vec4 rectAttribute;\n" // one instance per quad, in pixels with origin in upper left
+            "in vec4 uvAttribute;\n"
+            "in vec4 colorAttribute;\n"
+            "in vec2 maskAttribute;\n"
+            "out vec2 uv;\n"
+            "flat out vec4 color;\n"
+            "flat out vec2 maskUsage;\n"
+            "uniform vec2 resolution = vec2(1,1);\n"
             "void main() {\n"
-            "   float gradient = length(2*uv-1);\n" // simple gradient as base
-            "   float circle = (1-gradient) * 75;\n" // extend gradient to unclamped circle
-            "   fragColor = vec4(color.rgb, color.a * alpha * min(circle, 1.0));\n"
+            "   vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n" // quad as triangle strip
+            "   uv = mix(uvAttribute.xy, uvAttribute.zw, corner);\n"
+            "   color = colorAttribute;\n"
+            "   maskUsage = maskAttribute;\n"
+            "   vec2 pixel = mix(rectAttribute.xw, rectAttribute.zy, corner);\n"
+            "   gl_Position = vec4(2 * pixel.x / resolution.x - 1, 1 - 2 * pixel.y / resolution.y, 0, 1);\n"
             "}\n";
 
-        static const char* pDimFragmentShader =
+        static const char* pColorFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
-            "in vec2 uv;\n"
-            "uniform vec4 dimColor = vec4(1,0,0,0.5);\n"
-            "uniform float dim = 1;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
             "uniform float alpha = 1;\n"
-            "uniform sampler2D mask;\n"
             "void main() {\n"
-            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha) * dimColor * dim;\n"
+            "   fragColor = vec4(color.rgb, color.a * alpha);\n"
             "}\n";
 
-        static const char* pActivityFragmentShader =
+        static const char* pCircleFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform float activity;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
             "uniform float alpha = 1;\n"
-            "uniform sampler2D mask;\n"
             "void main() {\n"
-            "   fragColor = vec4(0.3, 0.3, 0.3, texture(mask, uv).r * 0.5 * alpha) * (1.0 - activity);\n"
+            "   float gradient = length(2*uv-1);\n" // simple gradient as base
+            "   float circle = (1-gradient) * 75;\n" // extend gradient to unclamped circle
+            "   fragColor = vec4(color.rgb, color.a * alpha * min(circle, 1.0));\n"
             "}\n";
 
-        static const char* pMarkFragmentShader =
+        static const char* pBatchFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform vec4 markColor = vec4(1,0,0,0.5);\n"
-            "uniform float mark = 1;\n"
-            "uniform float alpha = 1;\n"
+            "flat in vec4 color;\n"
+            "flat in vec2 maskUsage;\n" // usage of mask texture and of radial gradient
             "uniform sampler2D mask;\n"
             "void main() {\n"
-            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha) * markColor * mark;\n"
+            "   float gradient = length(2*uv-1);\n" // simple gradient as base
+            "   float alpha = mix(1.0, texture(mask, uv).r, maskUsage.x) * mix(1.0, pow(gradient,2), maskUsage.y);\n"
+            "   fragColor = vec4(1.0, 1.0, 1.0, alpha) * color;\n"
             "}\n";
 
         static const char* pCircleThresholdFragmentShader =
@@ -110,32 +119,6 @@ namespace eyegui
 			"   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * sqrt(threshold) * (1.0 - thresholdMask) * alpha) * thresholdColor;\n"
             "}\n";
 
-        static const char* pHighlightFragmentShader =
-            "#version 330 core\n"
-            "out vec4 fragColor;\n"
-            "in vec2 uv;\n"
-            "uniform vec4 highlightColor = vec4(1,0,0,0.5);\n"
-            "uniform float highlight = 1;\n"
-            "uniform float time;\n"
-            "uniform float alpha = 1;\n"
-            "uniform sampler2D mask;\n"
-            "void main() {\n"
-            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha * 0.5 * (1 + sin(3 * time))) * highlightColor * highlight;\n"
-            "}\n";
-
-        static const char* pSelectionFragmentShader =
-            "#version 330 core\n"
-            "out vec4 fragColor;\n"
-            "in vec2 uv;\n"
-            "uniform vec4 selectionColor = vec4(1,0,0,0.5);\n"
-            "uniform float selection = 1;\n"
-            "uniform float alpha = 1;\n"
-            "uniform sampler2D mask;\n"
-            "void main() {\n"
-            "   float gradient = length(2*uv-1);\n" // simple gradient as base
-            "	fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha * pow(gradient,2) * selection) * selectionColor;\n"
-            "}\n";
-
         static const char* pCircleButtonFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
@@ -205,9 +188,10 @@ namespace eyegui
             "in vec2 uv;\n"
             "uniform vec4 color;\n"
             "uniform float alpha;\n"
-            "uniform sampler2D atlas;\n"
+            "uniform sampler2DArray atlas;\n"
             "void main() {\n"
-            "   float character = texture(atlas, uv).r;\n"
+            "   float layer = floor(uv.x);\n" // integer part of u is layer
+            "   float character = texture(atlas, vec3(uv.x - layer, uv.y, layer)).r;\n"
             "   vec4 col = color;\n"
             "   fragColor = vec4(col.rgb, col.a * alpha * character);\n"
             "}\n";
@@ -250,9 +234,10 @@ namespace eyegui
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
             "uniform vec4 color = vec4(1,0,0,1);\n"
-            "uniform sampler2D atlas;\n"
+            "uniform sampler2DArray atlas;\n"
             "void main() {\n"
-            "   float value = texture(atlas, uv).r;\n"
+            "   float layer = floor(uv.x);\n" // integer part of u is layer
+            "   float value = texture(atlas, vec3(uv.x - layer, uv.y, layer)).r;\n"
             "   fragColor = vec4(color.rgb, color.a * value);\n"
             "}\n";
     }
@@ -18,23 +18,58 @@
 
 namespace eyegui
 {
+    namespace
+    {
+        // Decoding of image file on worker thread
+        struct DecodingJob : public TextureLoader::Job
+        {
+            DecodingJob(std::string filepath, uint width, uint height, uint channelCount)
+            {
+                this->filepath = filepath;
+                this->width = width;
+                this->height = height;
+                this->channelCount = channelCount;
+            }
+
+            virtual void execute()
+            {
+                // Decode image with channels as expected
+                int decodedWidth, decodedHeight, decodedChannelCount;
+                unsigned char* data = stbi_load(filepath.c_str(), &decodedWidth, &decodedHeight, &decodedChannelCount, channelCount);
+                if (data == NULL || (uint)decodedWidth != width || (uint)decodedHeight != height)
+                {
+                    failed = true;
+                }
+                else
+                {
+                    // Copy and flip here, so render thread only uploads
+                    image.assign(data, data + width * height * channelCount);
+                    TextureLoader::flipRows(image, width, height, channelCount);
+                }
+                stbi_image_free(data);
+            }
+
+            std::string filepath;
+        };
+    }
+
     PixelTexture::PixelTexture(
 		std::string filepath,
 		Filtering filtering,
 		Wrap wrap,
+		TextureLoader* pLoader,
 		int suspectedChannels) : Texture()
     {
-        // Setup stb_image
-        stbi_set_flip_vertically_on_load(true);
-
-        // Try to load image
+        // Only read size of image, decoding is done by worker
         int width, height, channelCount;
-        unsigned char* data = stbi_load(buildPath(filepath).c_str(), &width, &height, &channelCount, suspectedChannels);
-
-        // Check whether file was found and parsed
-        if (data == NULL)
+        if (!stbi_info(buildPath(filepath).c_str(), &width, &height, &channelCount))
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", filepath);
+
+            // Leave transparent pixel
+            const uchar transparent[4] = { 0, 0, 0, 0 };
+            createOpenGLTexture(transparent, filtering, wrap, 1, 1, 4, GL_RGBA, GL_RGBA, false, filepath);
+            return;
         }
 
 		// Decide format
@@ -61,11 +96,11 @@ namespace eyegui
 			break;
 		}
 
-        // Create OpenGL texture
-        createOpenGLTexture(data, filtering, wrap, width, height, channelCount, glFormat, glInternalFormat, false, filepath);
-
-        // Delete raw image data
-        stbi_image_free(data);
+        // Let worker decode image, channels are converted to suspected ones
+        uint decodedChannelCount = suspectedChannels > 0 ? (uint)suspectedChannels : (uint)channelCount;
+        createPlaceholderTexture(
+            std::make_shared<DecodingJob>(buildPath(filepath), (uint)width, (uint)height, decodedChannelCount),
+            pLoader, filtering, wrap, glFormat, glInternalFormat, filepath);
     }
 
     PixelTexture::PixelTexture(
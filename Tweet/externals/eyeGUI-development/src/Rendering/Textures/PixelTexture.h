@@ -17,11 +17,12 @@ namespace eyegui
     {
     public:
 
-        // Constructor
+        // Constructor for image on disk, which is decoded by texture loader
         PixelTexture(
 			std::string filepath,
 			Filtering filtering,
 			Wrap wrap,
+			TextureLoader* pLoader,
 			int suspectedChannels = 0);
 
         PixelTexture(
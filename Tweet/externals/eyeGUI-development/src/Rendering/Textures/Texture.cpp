@@ -19,6 +19,9 @@ namespace eyegui
         mTexture = 0;
         mWidth = 0;
         mHeight = 0;
+        mFiltering = Filtering::LINEAR;
+        mFormat = GL_RGBA;
+        mInternalFormat = GL_RGBA;
     }
 
     Texture::~Texture()
@@ -119,6 +122,63 @@ namespace eyegui
         glBindTexture(GL_TEXTURE_2D, 0);
     }
 
+    void Texture::createPlaceholderTexture(std::shared_ptr<TextureLoader::Job> spJob, TextureLoader* pLoader, Filtering filtering, Wrap wrap, GLenum format, GLenum internalFormat, std::string filepath)
+    {
+        // Single transparent pixel, so nothing has to be allocated for content yet
+        const uchar transparent[4] = { 0, 0, 0, 0 };
+        createOpenGLTexture(transparent, Filtering::NEAREST, wrap, 1, 1, 4, GL_RGBA, GL_RGBA, false, filepath);
+
+        // Aspect ratio is already the one of content
+        mWidth = spJob->width;
+        mHeight = spJob->height;
+
+        // Remember everything necessary for upload
+        mspJob = spJob;
+        mFiltering = filtering;
+        mFormat = format;
+        mInternalFormat = internalFormat;
+        mFilepath = filepath;
+        pLoader->enqueue(spJob);
+    }
+
+    bool Texture::isReadyForUpload() const
+    {
+        return mspJob.get() != NULL && mspJob->done;
+    }
+
+    uint Texture::upload()
+    {
+        // Keep placeholder if worker failed
+        std::shared_ptr<TextureLoader::Job> spJob = std::move(mspJob);
+        if (spJob->failed)
+        {
+            throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", mFilepath);
+            return 0;
+        }
+
+        // Replace placeholder by content
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, mInternalFormat, mWidth, mHeight, 0, mFormat, GL_UNSIGNED_BYTE, spJob->image.data());
+
+        // Filtering
+        switch (mFiltering)
+        {
+        case Filtering::LINEAR:
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            break;
+        case Filtering::NEAREST:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            break;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return (uint)spJob->image.size();
+    }
+
 	void Texture::flipPixelsY(unsigned char const * pData, unsigned char* pFlippedData, uint width, uint height, uint channelCount) const
 	{
 		// Go over lines
@@ -12,10 +12,12 @@
 #include "include/eyeGUI.h"
 
 #include "Defines.h"
+#include "TextureLoader.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <string>
 #include <vector>
+#include <memory>
 
 namespace eyegui
 {
@@ -49,11 +51,21 @@ namespace eyegui
         // Getter for aspect ratio
         float getAspectRatio() const;
 
+        // Whether content was loaded by worker and waits for upload
+        bool isReadyForUpload() const;
+
+        // Upload content loaded by worker, returns count of uploaded bytes
+        uint upload();
+
     protected:
 
         // Create OpenGL texture (something like initialization)
 		void createOpenGLTexture(unsigned char const * pData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount, GLenum format, GLenum internalFormat, bool flipY, std::string filepath);
 
+        // Create transparent placeholder and let worker load content. Width and
+        // height of job are already the final ones
+        void createPlaceholderTexture(std::shared_ptr<TextureLoader::Job> spJob, TextureLoader* pLoader, Filtering filtering, Wrap wrap, GLenum format, GLenum internalFormat, std::string filepath);
+
 		// Flip pixels vertically
 		void flipPixelsY(unsigned char const * pData, unsigned char* pFlippedData, uint width, uint height, uint channelCount) const;
 
@@ -63,6 +75,11 @@ namespace eyegui
         GLuint mTexture;
         uint mWidth;
         uint mHeight;
+        std::shared_ptr<TextureLoader::Job> mspJob; // NULL when content is uploaded
+        Filtering mFiltering;
+        GLenum mFormat;
+        GLenum mInternalFormat;
+        std::string mFilepath;
     };
 }
 
@@ -0,0 +1,206 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "TextureLoader.h"
+
+#include "src/Utilities/PathBuilder.h"
+#include "src/Utilities/Helper.h"
+
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+namespace eyegui
+{
+    // Header of raster in cache, followed by pixels
+    namespace
+    {
+        const char CACHE_MAGIC[4] = { 'E', 'G', 'R', 'C' };
+        const std::uint32_t CACHE_VERSION = 1;
+
+        struct CacheHeader
+        {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t width;
+            std::uint32_t height;
+        };
+    }
+
+    TextureLoader::Job::Job()
+    {
+        width = 0;
+        height = 0;
+        channelCount = 4;
+        failed = false;
+        done = false;
+    }
+
+    TextureLoader::Job::~Job()
+    {
+        // Nothing to do
+    }
+
+    TextureLoader::TextureLoader(std::string cacheDirectory)
+    {
+        mCacheDirectory = cacheDirectory;
+        mStop = false;
+    }
+
+    TextureLoader::~TextureLoader()
+    {
+        // Let workers finish current job and stop
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        for (std::thread& rWorker : mWorkers)
+        {
+            rWorker.join();
+        }
+    }
+
+    std::string TextureLoader::buildCacheFilepath(const std::vector<char>& rGraphics, float dpi) const
+    {
+        if (mCacheDirectory == EMPTY_STRING_ATTRIBUTE)
+        {
+            return "";
+        }
+
+        // Hash over content of graphics file and dpi
+        std::uint64_t hash = hashBytes(rGraphics.data(), rGraphics.size());
+        hash = hashBytes(reinterpret_cast<char const *>(&dpi), sizeof(float), hash);
+
+        // Name file by hash
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+        return buildPath(mCacheDirectory + "/" + name + "." + GRAPHICS_CACHE_EXTENSION);
+    }
+
+    bool TextureLoader::readCache(std::string cacheFilepath, uint& rWidth, uint& rHeight, std::vector<uchar>& rImage)
+    {
+        std::ifstream in(cacheFilepath.c_str(), std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return false;
+        }
+        std::uint64_t fileSize = (std::uint64_t)in.tellg();
+        in.seekg(0);
+
+        // Check header
+        CacheHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(CacheHeader));
+        if (!in
+            || std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0
+            || header.version != CACHE_VERSION)
+        {
+            return false;
+        }
+
+        // Pixels must fill rest of file. Otherwise cache is corrupted and dropped
+        std::uint64_t pixelCount = (std::uint64_t)header.width * header.height; // cannot overflow for 32 bit dimensions
+        std::uint64_t imageSize = fileSize - sizeof(CacheHeader);
+        if (pixelCount > imageSize / 4 || pixelCount * 4 != imageSize)
+        {
+            in.close();
+            std::remove(cacheFilepath.c_str());
+            return false;
+        }
+
+        // Read pixels
+        rWidth = header.width;
+        rHeight = header.height;
+        rImage.resize((size_t)imageSize);
+        in.read(reinterpret_cast<char*>(rImage.data()), rImage.size());
+        return (bool)in;
+    }
+
+    void TextureLoader::writeCache(std::string cacheFilepath, uint width, uint height, const std::vector<uchar>& rImage)
+    {
+        // Write to temporary file first, so no other process reads incomplete raster
+        std::string temporaryFilepath = cacheFilepath + ".tmp";
+        {
+            std::ofstream out(temporaryFilepath.c_str(), std::ios::binary);
+            if (!out)
+            {
+                return;
+            }
+            CacheHeader header;
+            std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+            header.version = CACHE_VERSION;
+            header.width = width;
+            header.height = height;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+            out.write(reinterpret_cast<const char*>(rImage.data()), rImage.size());
+            if (!out)
+            {
+                out.close();
+                std::remove(temporaryFilepath.c_str());
+                return;
+            }
+        }
+        std::remove(cacheFilepath.c_str()); // rename does not replace existing files on every platform
+        std::rename(temporaryFilepath.c_str(), cacheFilepath.c_str());
+    }
+
+    void TextureLoader::flipRows(std::vector<uchar>& rImage, uint width, uint height, uint channelCount)
+    {
+        const uint rowSize = width * channelCount;
+        for (uint i = 0; i < height / 2; i++)
+        {
+            std::swap_ranges(
+                rImage.begin() + i * rowSize,
+                rImage.begin() + (i + 1) * rowSize,
+                rImage.begin() + (height - 1 - i) * rowSize);
+        }
+    }
+
+    void TextureLoader::enqueue(std::shared_ptr<Job> spJob)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.push_back(spJob);
+
+            // Start workers with first job
+            if (mWorkers.empty())
+            {
+                uint workerCount = std::min(std::max(std::thread::hardware_concurrency(), 2u) - 1, TEXTURE_LOADER_MAX_WORKERS); // leave one core to the application
+                for (uint i = 0; i < workerCount; i++)
+                {
+                    mWorkers.push_back(std::thread(&TextureLoader::work, this));
+                }
+            }
+        }
+        mCondition.notify_one();
+    }
+
+    void TextureLoader::work()
+    {
+        while (true)
+        {
+            // Wait for job
+            std::shared_ptr<Job> spJob;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this]() { return mStop || !mJobs.empty(); });
+                if (mStop)
+                {
+                    break;
+                }
+                spJob = mJobs.front();
+                mJobs.pop_front();
+            }
+
+            // Execute it, texture picks up result on render thread
+            spJob->execute();
+            spJob->done = true;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Loads content of textures on worker threads, so neither decoding of images
+// nor rasterization of vector graphics makes the GUI wait. Rasters of vector
+// graphics are kept in a cache directory on disk, named by a hash of the
+// graphics file and the dpi. Later runs read them instead of rasterizing again.
+
+#ifndef TEXTURE_LOADER_H_
+#define TEXTURE_LOADER_H_
+
+#include "src/Defines.h"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace eyegui
+{
+    class TextureLoader
+    {
+    public:
+
+        // Job shared by texture and worker. Subclasses fill image on worker thread
+        struct Job
+        {
+            Job();
+            virtual ~Job();
+
+            // Called on worker thread, sets failed if image could not be loaded
+            virtual void execute() = 0;
+
+            uint width;
+            uint height;
+            uint channelCount;
+            std::vector<uchar> image; // already flipped for OpenGL
+            bool failed;
+            std::atomic<bool> done;
+        };
+
+        // Constructor. Empty cache directory disables cache
+        TextureLoader(std::string cacheDirectory);
+
+        // Destructor
+        virtual ~TextureLoader();
+
+        // Build filepath of raster in cache. Returns empty string if cache is disabled
+        std::string buildCacheFilepath(const std::vector<char>& rGraphics, float dpi) const;
+
+        // Read raster from cache. Returns whether successful
+        static bool readCache(std::string cacheFilepath, uint& rWidth, uint& rHeight, std::vector<uchar>& rImage);
+
+        // Write raster to cache
+        static void writeCache(std::string cacheFilepath, uint width, uint height, const std::vector<uchar>& rImage);
+
+        // Flip rows of image in place, as OpenGL expects first row at bottom
+        static void flipRows(std::vector<uchar>& rImage, uint width, uint height, uint channelCount);
+
+        // Enqueue job for execution on worker thread
+        void enqueue(std::shared_ptr<Job> spJob);
+
+    private:
+
+        // Loop of worker thread
+        void work();
+
+        // Members
+        std::string mCacheDirectory;
+        std::vector<std::thread> mWorkers; // started with first job
+        std::deque<std::shared_ptr<Job> > mJobs;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mStop;
+    };
+}
+
+#endif // TEXTURE_LOADER_H_
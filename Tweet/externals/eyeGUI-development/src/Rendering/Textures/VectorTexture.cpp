@@ -18,24 +18,88 @@
 #include "externals/NanoSVG/nanosvg.h"
 #include "externals/NanoSVG/nanosvgrast.h"
 
+#include <fstream>
+#include <iterator>
+
 namespace eyegui
 {
-    VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi) : Texture()
+    namespace
+    {
+        // Rasterization of graphics on worker thread
+        struct RasterizationJob : public TextureLoader::Job
+        {
+            RasterizationJob(NSVGimage* pSVG, std::string cacheFilepath)
+            {
+                this->pSVG = pSVG;
+                this->cacheFilepath = cacheFilepath;
+                width = (uint)(pSVG->width);
+                height = (uint)(pSVG->height);
+            }
+
+            virtual ~RasterizationJob()
+            {
+                nsvgDelete(pSVG);
+            }
+
+            virtual void execute()
+            {
+                // Rasterize
+                NSVGrasterizer* pRasterizer = nsvgCreateRasterizer();
+                image.resize(width * height * 4);
+                nsvgRasterize(pRasterizer, pSVG, 0, 0, 1, image.data(), width, height, width * 4);
+                nsvgDeleteRasterizer(pRasterizer);
+                TextureLoader::flipRows(image, width, height, 4);
+
+                // Keep raster for next time
+                if (!cacheFilepath.empty())
+                {
+                    TextureLoader::writeCache(cacheFilepath, width, height, image);
+                }
+            }
+
+            NSVGimage* pSVG;
+            std::string cacheFilepath; // empty if cache is disabled
+        };
+    }
+
+    VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi, TextureLoader* pLoader) : Texture()
     {
-        // Parse file
-        NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", dpi);
+        // Read file, content is also used to find raster in cache
+        std::ifstream in(buildPath(filepath).c_str(), std::ios::binary);
+        std::vector<char> graphics((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        graphics.push_back('\0');
+
+        // Take raster from cache if available
+        std::string cacheFilepath = pLoader->buildCacheFilepath(graphics, dpi);
+        uint width = 0;
+        uint height = 0;
+        std::vector<uchar> image;
+        if (cacheFilepath != "" && TextureLoader::readCache(cacheFilepath, width, height, image))
+        {
+            createOpenGLTexture(image.data(), filtering, wrap, width, height, 4, GL_RGBA, GL_RGBA, false, filepath);
+            return;
+        }
+
+        // Parse graphics, which is fast compared to rasterization
+        NSVGimage* svg = NULL;
+        if (in)
+        {
+            svg = nsvgParse(graphics.data(), "px", dpi);
+        }
 
         // Check whether file found and parsed
         if (svg == NULL)
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Graphics file not found or error while parsing", filepath);
-        }
 
-        // Rasterize it and create OpenGL texture
-        rasterizeGraphics(svg, filtering, wrap, filepath);
+            // Leave transparent pixel
+            image.resize(4, 0);
+            createOpenGLTexture(image.data(), filtering, wrap, 1, 1, 4, GL_RGBA, GL_RGBA, false, filepath);
+            return;
+        }
 
-        // Delete graphics
-        nsvgDelete(svg);
+        // Let worker rasterize graphics
+        createPlaceholderTexture(std::make_shared<RasterizationJob>(svg, cacheFilepath), pLoader, filtering, wrap, GL_RGBA, GL_RGBA, filepath);
     }
 
     VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi)
@@ -55,7 +119,7 @@ namespace eyegui
 
     VectorTexture::~VectorTexture()
     {
-        // Nothing to do
+        // Nothing to do, job is deleted with last reference to it
     }
 
     void VectorTexture::rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath)
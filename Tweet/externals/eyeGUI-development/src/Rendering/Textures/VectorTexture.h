@@ -4,7 +4,9 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Specialization of texture for vector based images.
+// Specialization of texture for vector based images. Graphics from disk are
+// rasterized by texture loader or taken from the raster cache. Until the
+// raster is uploaded, the texture is transparent.
 
 #ifndef VECTOR_TEXTURE_H_
 #define VECTOR_TEXTURE_H_
@@ -20,7 +22,7 @@ namespace eyegui
     public:
 
         // Constructor for graphics on disk
-        VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi);
+        VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi, TextureLoader* pLoader);
 
         // Constructor for internal graphics
         VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi);
@@ -32,7 +34,6 @@ namespace eyegui
 
         // Rasterize
         void rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath);
-
     };
 }
 
@@ -10,62 +10,55 @@
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/Helper.h"
 #include "src/Utilities/PathBuilder.h"
-#include "externals/levenshtein-sse/levenshtein-sse.hpp"
 
 #include <fstream>
 #include <algorithm>
 #include <sstream>
+#include <unordered_set>
+#include <cstring>
 
 namespace eyegui
 {
-    Dictionary::Dictionary(std::string filepath)
+    // Header of compiled dictionary file, followed by nodes and edges
+    namespace
     {
-        // Read file with instream
-        std::ifstream in(buildPath(filepath).c_str());
+        const char FILE_MAGIC[4] = { 'E', 'G', 'D', 'G' };
+        const std::uint32_t FILE_VERSION = 1;
 
-        // Build up dictionary
-        if(in)
+        struct FileHeader
         {
-            // Convert input file to string
-            std::stringstream strStream;
-            strStream << in.rdbuf();
-            std::string content = strStream.str();
-
-            // Close file
-            in.close();
-
-            // Streamline line endings
-            streamlineLineEnding(content, true);
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t nodeCount;
+            std::uint32_t edgeCount;
+        };
+    }
 
-            // Add words to dictionary
-            std::string delimiter = "\n";
-            size_t pos = 0;
-            std::string line;
-            while ((pos = content.find(delimiter)) != std::string::npos)
+    Dictionary::Dictionary(std::string filepath)
+    {
+        if (checkFileNameExtension(filepath, DICTIONARY_EXTENSION))
+        {
+            // Compiled dictionary can be used as it is
+            if (!readFromFile(filepath))
             {
-                // Extract line
-                line = content.substr(0, pos);
-                content.erase(0, pos + delimiter.length());
-
-                // Convert line to utf-16 string
-                if (!(line.empty()))
-                {
-                    std::u16string line16;
-                    if(convertUTF8ToUTF16(line, line16))
-                    {
-                        // Add word to dictionary
-                        addWord(line16);
-                    }
-                    else
-                    {
-                        throwError(OperationNotifier::Operation::DICTIONARY, "Following line could not be parsed: " + line, filepath);
-                    }
-                }
+                throwError(OperationNotifier::Operation::DICTIONARY, "Compiled dictionary could not be read", filepath);
             }
         }
         else
         {
-            throwError(OperationNotifier::Operation::DICTIONARY, "Dictionary file not found", filepath);
+            // Build up dictionary from list of words
+            std::vector<std::pair<std::u16string, WordState> > words;
+            if (readWordList(filepath, words))
+            {
+                buildGraph(std::move(words));
+            }
+        }
+
+        // Make sure there is a root
+        if (mNodes.empty())
+        {
+            Node root = { 0, 0, WordState::NONE, 0 };
+            mNodes.push_back(root);
         }
     }
 
@@ -74,216 +67,336 @@ namespace eyegui
         // Nothing to do
     }
 
+    bool Dictionary::writeToFile(std::string filepath) const
+    {
+        std::ofstream out(buildPath(filepath).c_str(), std::ios::binary);
+        if (!out)
+        {
+            return false;
+        }
+
+        // Write header, nodes and edges as they are in memory
+        FileHeader header;
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.nodeCount = (std::uint32_t)mNodes.size();
+        header.edgeCount = (std::uint32_t)mEdges.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        out.write(reinterpret_cast<const char*>(mNodes.data()), mNodes.size() * sizeof(Node));
+        out.write(reinterpret_cast<const char*>(mEdges.data()), mEdges.size() * sizeof(Edge));
+        return (bool)out;
+    }
+
     bool Dictionary::checkForWord(const std::u16string& rWord) const
     {
+        if (rWord.empty())
+        {
+            return false;
+        }
+
         // Convert to lower case and remember it
         std::u16string lowerWord = rWord;
         WordState wordState = convertToLower(lowerWord);
 
-        // Pointer to current node
-        Node const * pNode = NULL;
-
-        // Pointer to current map
-        NodeMap const * pMap = &mRootMap;
-
         // Go over nodes
-        uint count = (uint)lowerWord.size();
-        for (uint i = 0; i < count; i++)
+        std::uint32_t node = 0;
+        for (char16_t c : lowerWord)
         {
-            // Try to find letter in current map
-            const char16_t c = lowerWord[i];
-            NodeMap::const_iterator it = pMap->find(c);
-            if (it == pMap->end())
+            if (!findChild(node, c, node))
             {
                 return false;
             }
-            else
-            {
-                if (!(pMap->empty()))
-                {
-                    pNode = &(it->second);
-                    pMap = &(pNode->children); // Map of current pointer
-                }
-            }
         }
 
         // Check whether found word has correct case
-        if (pNode != NULL && (pNode->wordState == wordState || pNode->wordState == WordState::BOTH_STARTS))
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        WordState foundState = mNodes[node].wordState;
+        return foundState == wordState || foundState == WordState::BOTH_STARTS;
     }
 
-    std::vector<std::u16string> Dictionary::similarWords(const std::u16string& rWord, bool makeFirstLetterUpperCase) const
+    std::vector<std::u16string> Dictionary::similarWords(const std::u16string& rWord, bool makeFirstLetterUpperCase, uint maxCount) const
     {
+        std::vector<std::u16string> resultVector;
+        if (rWord.empty())
+        {
+            return resultVector;
+        }
+
         // Convert to lower case
         std::u16string lowerWord = rWord;
         convertToLower(lowerWord); // state is not necessary to remember
-        uint wordLength = (uint)rWord.size();
-
-        // Create set to collect results
-        std::set<std::u16string> resultSet;
-
-        // Search for given word, ignore identical letters in one row
-        fuzzyWordSearch(
-            lowerWord,
-            DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH,
-            DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH,
-            DICTIONARY_INPUT_PAUSE_DEPTH,
-            DICTIONARY_INPUT_IGNORE_DEPTH,
-            resultSet);
 
-        // Save size of result set
-        int sizeOfResultSet = (int)resultSet.size();
+        // Search for given word, best ones are found first
+        prepareSearch(lowerWord);
+        runSearch(maxCount, resultVector);
 
-        // Only continue when necessary
-        std::vector<std::u16string> resultVector;
-        if(sizeOfResultSet > 0)
-        {
-            // Rate results by word distance
-            int distance;
-            std::vector<std::pair<std::u16string, int> > sortedResults;
-            sortedResults.reserve(sizeOfResultSet);
-            std::u16string comparsionWord = lowerWord;
-            firstCharacterToUpper(comparsionWord);
-            for(const std::u16string& rFoundWord : resultSet)
-            {
-                // Determine common size of both words to not discriminate appended letters
-                uint commonLength = std::min(wordLength, (uint)rFoundWord.size());
+        // Make first letter upper case if wished
+        if (makeFirstLetterUpperCase)
+        {
+            std::for_each(resultVector.begin(), resultVector.end(), firstCharacterToUpper);
+
+            // Remove words which are now the same
+            std::unordered_set<std::u16string> seen;
+            resultVector.erase(
+                std::remove_if(
+                    resultVector.begin(),
+                    resultVector.end(),
+                    [&seen](const std::u16string& rWord) { return !seen.insert(rWord).second; }),
+                resultVector.end());
+        }
 
-                // Use input with possible first upper letter as comparsion
-                // Since in the structure is only the case of the first letter saved
-                distance = (int)levenshteinSSE::levenshtein(
-                    comparsionWord.begin(), comparsionWord.begin() + commonLength,
-                    rFoundWord.begin(), rFoundWord.begin() + commonLength);
+        // Return what you have
+        return resultVector;
+    }
 
-                // Build up structure with found word and distance to searched one
-                sortedResults.push_back(std::make_pair(rFoundWord, distance));
-            }
+    bool Dictionary::readWordList(std::string filepath, std::vector<std::pair<std::u16string, WordState> >& rWords)
+    {
+        // Read file with instream
+        std::ifstream in(buildPath(filepath).c_str());
+        if (!in)
+        {
+            throwError(OperationNotifier::Operation::DICTIONARY, "Dictionary file not found", filepath);
+            return false;
+        }
 
-            // Sort the built structure
-            std::sort(
-                sortedResults.begin(),
-                sortedResults.end(),
-                [&comparsionWord](const std::pair<std::u16string, int>& left, const std::pair<std::u16string, int>& right)
-                {
-                    // Collect information
-                    int distanceLeft = left.second;
-                    int distanceRight = right.second;
-                    bool leftFirstIdentical = false;
-                    bool leftLastIdentical = false;
-                    bool rightFirstIdentical = false;
-                    bool rightLastIdentical = false;
-
-                    if (!comparsionWord.empty())
-                    {
-                        if (!left.first.empty())
-                        {
-                            leftFirstIdentical = left.first.front() == comparsionWord.front();
-                            leftLastIdentical = left.first.back() == comparsionWord.back();
-                        }
-                        if (!right.first.empty())
-                        {
-                            rightFirstIdentical = right.first.front() == comparsionWord.front();
-                            rightLastIdentical = right.first.back() == comparsionWord.back();
-                        }
-                    }
+        // Convert input file to string
+        std::stringstream strStream;
+        strStream << in.rdbuf();
+        std::string content = strStream.str();
 
-                    // Decide which word is the better suggestion (just some random stuff which looks good)
-                    if (leftFirstIdentical && leftLastIdentical)
-                    {
-                        // Integer division
-                        distanceLeft /= 2;
-                    }
-                    if (rightFirstIdentical && rightLastIdentical)
-                    {
-                        // Integer division
-                        distanceRight /= 2;
-                    }
+        // Close file
+        in.close();
 
-                    return distanceLeft < distanceRight;
-                });
+        // Streamline line endings
+        streamlineLineEnding(content, true);
 
-            // Copy results to final vector
-            resultVector.reserve(sizeOfResultSet);
-            std::transform(
-                sortedResults.begin(),
-                sortedResults.end(),
-                std::back_inserter(resultVector),
-                [](const std::pair<std::u16string, int>& item)
-                {
-                    return item.first;
-                });
+        // Collect words
+        size_t start = 0;
+        size_t pos = 0;
+        while ((pos = content.find('\n', start)) != std::string::npos)
+        {
+            // Extract line
+            std::string line = content.substr(start, pos - start);
+            start = pos + 1;
 
-            // Make first letter upper case if wished
-            if(makeFirstLetterUpperCase)
+            // Convert line to utf-16 string
+            if (!(line.empty()))
             {
-                std::for_each(resultVector.begin(), resultVector.end(), firstCharacterToUpper);
+                std::u16string line16;
+                if (convertUTF8ToUTF16(line, line16))
+                {
+                    WordState wordState = convertToLower(line16);
+                    rWords.push_back(std::make_pair(std::move(line16), wordState));
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::DICTIONARY, "Following line could not be parsed: " + line, filepath);
+                }
             }
         }
+        return true;
+    }
 
-        // Return what you have
-        return resultVector;
+    bool Dictionary::readFromFile(std::string filepath)
+    {
+        std::ifstream in(buildPath(filepath).c_str(), std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return false;
+        }
+        std::uint64_t fileSize = (std::uint64_t)in.tellg();
+        in.seekg(0);
+
+        // Read and validate header
+        FileHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(FileHeader));
+        if (!in
+            || std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0
+            || header.version != FILE_VERSION
+            || header.nodeCount == 0)
+        {
+            return false;
+        }
+
+        // Counts must fit into file, so corrupted ones do not lead to huge allocations
+        std::uint64_t arraysSize =
+            (std::uint64_t)header.nodeCount * sizeof(Node)
+            + (std::uint64_t)header.edgeCount * sizeof(Edge);
+        if (arraysSize > fileSize - sizeof(FileHeader))
+        {
+            return false;
+        }
+
+        // Read arrays in one go each
+        mNodes.resize(header.nodeCount);
+        mEdges.resize(header.edgeCount);
+        in.read(reinterpret_cast<char*>(mNodes.data()), mNodes.size() * sizeof(Node));
+        in.read(reinterpret_cast<char*>(mEdges.data()), mEdges.size() * sizeof(Edge));
+        bool valid = (bool)in;
+
+        // Validate everything refers to something existing, so graph can be searched without further checks
+        for (std::uint32_t i = 0; valid && i < header.nodeCount; i++)
+        {
+            const Node& rNode = mNodes[i];
+            valid = rNode.firstEdge <= header.edgeCount
+                && rNode.edgeCount <= header.edgeCount - rNode.firstEdge
+                && rNode.wordState <= WordState::BOTH_STARTS;
+        }
+        for (std::uint32_t i = 0; valid && i < header.edgeCount; i++)
+        {
+            valid = mEdges[i].target < header.nodeCount;
+        }
+        if (!valid)
+        {
+            mNodes.clear();
+            mEdges.clear();
+            return false;
+        }
+        return true;
     }
 
-    void Dictionary::addWord(const std::u16string& rWord)
+    void Dictionary::buildGraph(std::vector<std::pair<std::u16string, WordState> > words)
     {
-        // Convert to lower case and remember it
-        std::u16string lowerWord = rWord;
-        WordState wordState = convertToLower(lowerWord);
+        // Sort words, so graph can be minimized while adding them
+        std::sort(words.begin(), words.end());
 
-        // Pointer to node
-        Node* pNode = NULL;
+        // Node while building, children are appended in sorted order
+        struct BuildNode
+        {
+            std::vector<std::pair<char16_t, std::uint32_t> > children;
+            WordState wordState = WordState::NONE;
+        };
+        std::vector<BuildNode> nodes(1); // root
+
+        // Nodes which are already minimal, accessed by signature of state and children
+        std::unordered_map<std::string, std::uint32_t> registry;
+        auto signature = [&nodes](std::uint32_t node)
+        {
+            std::string key(1, (char)nodes[node].wordState);
+            for (const auto& rChild : nodes[node].children)
+            {
+                key.append(reinterpret_cast<const char*>(&rChild.first), sizeof(char16_t));
+                key.append(reinterpret_cast<const char*>(&rChild.second), sizeof(std::uint32_t));
+            }
+            return key;
+        };
 
-        // Pointer to map
-        NodeMap* pMap = &mRootMap;
+        // Path of last added word (parent and child), which is not yet minimized
+        std::vector<std::pair<std::uint32_t, std::uint32_t> > unchecked;
+        auto minimize = [&](size_t downTo)
+        {
+            while (unchecked.size() > downTo)
+            {
+                const auto& rPair = unchecked.back();
+                std::string key = signature(rPair.second);
+                auto it = registry.find(key);
+                if (it != registry.end())
+                {
+                    // Equal node exists, use it instead
+                    nodes[rPair.first].children.back().second = it->second;
+                }
+                else
+                {
+                    registry.emplace(std::move(key), rPair.second);
+                }
+                unchecked.pop_back();
+            }
+        };
 
-        // Go over characters in word
-        uint count = (uint)lowerWord.size();
-        NodeMap::iterator it;
-        for (uint i = 0; i < count; i++)
+        // Add words
+        std::u16string previousWord;
+        for (size_t i = 0; i < words.size(); i++)
         {
-            // Try to find letter in current map
-            const char16_t c = lowerWord[i];
-            it = pMap->find(c);
-            if (it == pMap->end())
+            const std::u16string& rWord = words[i].first;
+            if (rWord.empty())
             {
-                // Add it to map and go on
-                pMap->insert(std::make_pair(c, Node()));
+                continue;
             }
 
-            // Remember current node and new map
-            pNode = &(pMap->at(c));
-            pMap = &(pNode->children);
+            // Merge states of same word in different cases
+            WordState wordState = words[i].second;
+            while (i + 1 < words.size() && words[i + 1].first == rWord)
+            {
+                i++;
+                if (words[i].second != wordState)
+                {
+                    wordState = WordState::BOTH_STARTS;
+                }
+            }
+
+            // Minimize nodes of previous word which are not shared
+            size_t commonPrefix = 0;
+            while (commonPrefix < rWord.size() && commonPrefix < previousWord.size() && rWord[commonPrefix] == previousWord[commonPrefix])
+            {
+                commonPrefix++;
+            }
+            minimize(commonPrefix);
+
+            // Add suffix
+            std::uint32_t node = unchecked.empty() ? 0 : unchecked.back().second;
+            for (size_t j = commonPrefix; j < rWord.size(); j++)
+            {
+                std::uint32_t child = (std::uint32_t)nodes.size();
+                nodes.push_back(BuildNode());
+                nodes[node].children.push_back(std::make_pair(rWord[j], child));
+                unchecked.push_back(std::make_pair(node, child));
+                node = child;
+            }
+            nodes[node].wordState = wordState;
+            previousWord = rWord;
         }
+        minimize(0);
 
-        // Set word state in last letter of word, seen from root
-        // NONE is initial value
-        if (pNode != NULL)
+        // Write reachable nodes into flat arrays in breadth first order
+        std::vector<std::uint32_t> newIndices(nodes.size(), UINT32_MAX);
+        std::vector<std::uint32_t> order(1, 0);
+        newIndices[0] = 0;
+        for (size_t i = 0; i < order.size(); i++)
         {
-            if (pNode->wordState == WordState::NONE)
+            for (const auto& rChild : nodes[order[i]].children)
             {
-                // First occurence, use given case
-                pNode->wordState = wordState;
+                if (newIndices[rChild.second] == UINT32_MAX)
+                {
+                    newIndices[rChild.second] = (std::uint32_t)order.size();
+                    order.push_back(rChild.second);
+                }
             }
-            else if (pNode->wordState != wordState)
+        }
+        mNodes.clear();
+        mEdges.clear();
+        mNodes.reserve(order.size());
+        for (std::uint32_t oldIndex : order)
+        {
+            const BuildNode& rBuildNode = nodes[oldIndex];
+            Node node = { (std::uint32_t)mEdges.size(), (std::uint16_t)rBuildNode.children.size(), rBuildNode.wordState, 0 };
+            mNodes.push_back(node);
+            for (const auto& rChild : rBuildNode.children)
             {
-                // Already saved with other case or already added as upper and lower case
-                pNode->wordState = WordState::BOTH_STARTS;
+                Edge edge = { rChild.first, 0, newIndices[rChild.second] };
+                mEdges.push_back(edge);
             }
         }
     }
 
-    Dictionary::WordState Dictionary::convertToLower(std::u16string& rWord) const
+    bool Dictionary::findChild(std::uint32_t node, char16_t letter, std::uint32_t& rChild) const
+    {
+        const Node& rNode = mNodes[node];
+        auto begin = mEdges.begin() + rNode.firstEdge;
+        auto end = begin + rNode.edgeCount;
+        auto it = std::lower_bound(begin, end, letter, [](const Edge& rEdge, char16_t c) { return rEdge.letter < c; });
+        if (it == end || it->letter != letter)
+        {
+            return false;
+        }
+        rChild = it->target;
+        return true;
+    }
+
+    Dictionary::WordState Dictionary::convertToLower(std::u16string& rWord)
     {
         WordState wordState = WordState::LOWER_START;
         std::u16string lowerWord = rWord;
         toLower(lowerWord); // One could use return value for error checking
-        if (lowerWord[0] != rWord[0])
+        if (!lowerWord.empty() && lowerWord[0] != rWord[0])
         {
             // Something has changed
             wordState = WordState::UPPER_START;
@@ -292,247 +405,280 @@ namespace eyegui
         return wordState;
     }
 
-    void Dictionary::fuzzyWordSearch(
-        const std::u16string& rInput,
-        uint inputRepeatIgnoreDepth,
-        uint inputRepeatPauseDepth,
-        uint inputPauseDepth,
-        uint inputIgnoreDepth,
-        std::set<std::u16string>& rFoundWords) const
+    void Dictionary::prepareSearch(const std::u16string& rInput) const
     {
-        // Just pipe it (start the recursion)
-        fuzzyWordSearch(
-            rInput,
-            0,
-            u"",
-            NULL,
-            (int)inputRepeatIgnoreDepth,
-            (int)inputRepeatPauseDepth,
-            (int)inputPauseDepth,
-            (int)inputIgnoreDepth,
-            true,
-            rFoundWords);
+        Search& rSearch = mSearch;
+
+        // Continue previous search if input only got longer. Restart when states were dropped or too many exist
+        if (!rSearch.input.empty()
+            && !rSearch.statesDropped
+            && rSearch.states.size() < DICTIONARY_SEARCH_MAX_STATES
+            && rInput.size() > rSearch.input.size()
+            && rInput.compare(0, rSearch.input.size(), rSearch.input) == 0)
+        {
+            // Completions belong to shorter input, throw them away
+            for (auto& rQueue : rSearch.frontier)
+            {
+                rQueue.erase(
+                    std::remove_if(rQueue.begin(), rQueue.end(), [&rSearch](std::uint32_t i) { return rSearch.states[i].completion; }),
+                    rQueue.end());
+            }
+
+            // States which consumed complete input can go on with new letters
+            std::vector<std::uint32_t> completeStates;
+            completeStates.swap(rSearch.completeStates);
+            rSearch.input = rInput;
+            for (std::uint32_t i : completeStates)
+            {
+                rSearch.frontier[rSearch.states[i].cost].push_back(i);
+            }
+            return;
+        }
+
+        // Start new search at root
+        rSearch.input = rInput;
+        rSearch.states.clear();
+        rSearch.completeStates.clear();
+        rSearch.statesDropped = false;
+        rSearch.frontier.assign(
+            1 + DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH + DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH + DICTIONARY_INPUT_PAUSE_DEPTH + DICTIONARY_INPUT_IGNORE_DEPTH,
+            std::deque<std::uint32_t>());
+        SearchState root;
+        root.node = 0;
+        root.parent = UINT32_MAX;
+        root.origin = UINT32_MAX;
+        root.letter = 0;
+        root.inputIndex = 0;
+        root.cost = 0;
+        root.remainingInputRepeatIgnores = (std::int8_t)DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH;
+        root.remainingInputRepeatPauses = (std::int8_t)DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH;
+        root.remainingInputPauses = (std::int8_t)DICTIONARY_INPUT_PAUSE_DEPTH;
+        root.remainingInputIgnores = (std::int8_t)DICTIONARY_INPUT_IGNORE_DEPTH;
+        root.mayAddLongerWords = true;
+        root.completion = false;
+        pushState(root);
     }
 
-    void Dictionary::fuzzyWordSearch(
-        const std::u16string& rInput,
-        uint inputStartIndex,
-        std::u16string collectedWord,
-        Node const * pNode,
-        int remainingInputRepeatIgnores,
-        int remainingInputRepeatPauses,
-        int remainingInputPauses,
-        int reaminingInputIgnores,
-        bool mayAddLongerWords,
-        std::set<std::u16string>& rFoundWords) const
+    void Dictionary::runSearch(uint maxCount, std::vector<std::u16string>& rFoundWords) const
     {
-        // Pointer to root map as fallback
-        NodeMap const * pMap = &mRootMap;
-
-        // Get pointer to map provided by node
-        if (pNode != NULL)
-        {
-            // Use the the map given in node
-            pMap = &(pNode->children);
-        }
+        // Count of found words for each completed state
+        std::unordered_map<std::uint32_t, uint> completionCounts;
 
-        // Consume letters from start index of input word
-        uint count = (uint)rInput.size();
-        uint i = inputStartIndex; // Must be visible outside of loop
-        for (; i < count; i++)
+        // Expand states with fewest corrections first
+        uint expansions = 0;
+        for (auto& rQueue : mSearch.frontier)
         {
-            // Suspect input to be incomplete ("Hus" -> "Haus")
-            if(remainingInputPauses > 0)
+            while (!rQueue.empty())
             {
-                for(const auto& rCharNode : *pMap)
+                // Stop when enough words are found or time is up. Remaining states are kept for next input
+                if (rFoundWords.size() >= maxCount || expansions >= DICTIONARY_SEARCH_MAX_EXPANSIONS)
                 {
-                    fuzzyWordSearch(
-                        rInput,
-                        i,
-                        collectedWord + rCharNode.first,
-                        &(rCharNode.second),
-                        0,
-                        0,
-                        remainingInputPauses - 1,
-                        reaminingInputIgnores,
-                        false,
-                        rFoundWords);
+                    return;
                 }
+                std::uint32_t stateIndex = rQueue.front();
+                rQueue.pop_front();
+                expandState(stateIndex, maxCount, completionCounts, rFoundWords);
+                expansions++;
             }
+        }
+    }
 
-            // Ignore some input ("Huus" -> "Haus")
-            if(reaminingInputIgnores > 0)
+    void Dictionary::expandState(
+        std::uint32_t stateIndex,
+        uint maxCount,
+        std::unordered_map<std::uint32_t, uint>& rCompletionCounts,
+        std::vector<std::u16string>& rFoundWords) const
+    {
+        // Copy, since vector of states grows
+        const SearchState state = mSearch.states[stateIndex];
+        const Node& rNode = mNodes[state.node];
+        const std::u16string& rInput = mSearch.input;
+        uint count = (uint)rInput.size();
+
+        // Add letters behind complete input
+        if (state.completion)
+        {
+            uint& rCompletionCount = rCompletionCounts[state.origin];
+            if (rCompletionCount >= DICTIONARY_MAX_FOLLOWING_WORDS)
             {
-                // Just ignore given letter from input, add letter from map and go on
-                for(const auto& rCharNode : *pMap)
-                {
-                    fuzzyWordSearch(
-                        rInput,
-                        i + 1,
-                        collectedWord + rCharNode.first,
-                        &(rCharNode.second),
-                        0,
-                        0,
-                        remainingInputPauses,
-                        reaminingInputIgnores - 1,
-                        false,
-                        rFoundWords);
-                }
+                return;
             }
-
-            // Current letter
-            const char16_t& c = rInput[i];
-
-            // "Aaal" -> "Aal" should be found (too many letters)
-            if (i > 0 && remainingInputRepeatIgnores > 0 && c == rInput[i-1])
+            if (addFoundWord(stateIndex, rFoundWords))
             {
-                fuzzyWordSearch(
-                    rInput,
-                    i + 1,
-                    collectedWord,
-                    pNode,
-                    remainingInputRepeatIgnores -1,
-                    remainingInputRepeatPauses,
-                    remainingInputPauses,
-                    reaminingInputIgnores,
-                    mayAddLongerWords,
-                    rFoundWords);
+                rCompletionCount++;
             }
 
-            // Try to find letter in current map
-            NodeMap::const_iterator it = pMap->find(c);
-            if (it == pMap->end())
+            // Completions are thrown away at next input, so only continue while words are missing
+            if (rFoundWords.size() >= maxCount)
             {
-                // Next character was not found. Only add to found words if
-                // remaining input pauses are enough to compensate extra letters
-                if(pNode != NULL && (int)count - (int)(i+1) < remainingInputPauses)
-                {
-                    // Decision whether here is a node is done in add method
-                    addFuzzyWord(collectedWord, pNode->wordState, rFoundWords);
-                }
-
-				// Return from this recursion
                 return;
             }
-            else
+            for (uint i = 0; i < rNode.edgeCount; i++)
             {
-                // Some node was found since iterator not at end of map, so remember that
-                pNode = &(it->second);
+                const Edge& rEdge = mEdges[rNode.firstEdge + i];
+                SearchState child = state;
+                child.node = rEdge.target;
+                child.parent = stateIndex;
+                child.letter = rEdge.letter;
+                pushState(child);
+            }
+            return;
+        }
 
-                // Add letter to collected word
-                collectedWord += c;
+        // Complete input consumed
+        if (state.inputIndex >= count)
+        {
+            mSearch.completeStates.push_back(stateIndex);
 
-                // "Al" -> "Aal" should be found  (not enough letters, repeating ones missing)
-                if(remainingInputRepeatPauses > 0)
+            // No words shorter than input are added (but words like "Aaal" because of repeat ignores)
+            if (state.parent != UINT32_MAX)
+            {
+                addFoundWord(stateIndex, rFoundWords);
+
+                // Add words which have the collected word as prefix, if wished and words are missing
+                if (state.mayAddLongerWords && rFoundWords.size() < maxCount)
                 {
-                    fuzzyWordSearch(
-                        rInput,
-                        i,
-                        collectedWord,
-                        pNode,
-                        remainingInputRepeatIgnores,
-                        remainingInputRepeatPauses - 1,
-                        remainingInputPauses,
-                        reaminingInputIgnores,
-                        mayAddLongerWords,
-                        rFoundWords);
+                    for (uint i = 0; i < rNode.edgeCount; i++)
+                    {
+                        const Edge& rEdge = mEdges[rNode.firstEdge + i];
+                        SearchState child = state;
+                        child.node = rEdge.target;
+                        child.parent = stateIndex;
+                        child.origin = stateIndex;
+                        child.letter = rEdge.letter;
+                        child.completion = true;
+                        pushState(child);
+                    }
                 }
-
-				// Prepare next iteration
-				pMap = &(pNode->children);
             }
+            return;
         }
 
-		// Only continue, if some node from map was chosen
-		if (pNode != NULL)
-		{
-			// Add current word when no letters in input are left
-			if (i >= count)
-			{
-				// Adds word to found words
-				addFuzzyWord(collectedWord, pNode->wordState, rFoundWords);
-
-				// This constraint means, that no words shorter than input can be added
-				// (but words like "Aaal" because of DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH)
-			}
-
-			// Add words which have the collected word as prefix, if wished
-			if (mayAddLongerWords)
-			{
-				addLongerWords(collectedWord, *pNode, DICTIONARY_MAX_FOLLOWING_WORDS, rFoundWords);
-			}
-		}
-    }
+        // Current letter
+        const char16_t c = rInput[state.inputIndex];
 
-    int Dictionary::addLongerWords(
-        const std::u16string& rCollectedWord,
-        const Node& rNode,
-        int remainingWords,
-        std::set<std::u16string>& rFoundWords) const
-    {
-        if(remainingWords > 0) // should be not necessary
+        // Go over children of node
+        for (uint i = 0; i < rNode.edgeCount; i++)
         {
-            // Go over children of node and add all words until "remainingWords" counter is too low
-            for(const auto& rNodeMapEntry : rNode.children)
+            const Edge& rEdge = mEdges[rNode.firstEdge + i];
+            SearchState child = state;
+            child.node = rEdge.target;
+            child.parent = stateIndex;
+            child.letter = rEdge.letter;
+
+            if (rEdge.letter == c)
             {
-                // Collected word
-                std::u16string collectedWord = rCollectedWord + rNodeMapEntry.first;
+                // Letter of input found
+                child.inputIndex = state.inputIndex + 1;
+                pushState(child);
 
-                // Word is only added if here is one (checked by addFuzzyWord method)
-                if(addFuzzyWord(collectedWord, rNodeMapEntry.second.wordState, rFoundWords))
+                // "Al" -> "Aal" should be found  (not enough letters, repeating ones missing)
+                if (state.remainingInputRepeatPauses > 0)
                 {
-                    remainingWords--;
+                    child.inputIndex = state.inputIndex;
+                    child.cost = state.cost + 1;
+                    child.remainingInputRepeatPauses = state.remainingInputRepeatPauses - 1;
+                    pushState(child);
                 }
+            }
 
-                // Break out of for loop when no more words should be added
-                if(remainingWords <= 0) { break; }
-
-                // Do some recursion
-                remainingWords = addLongerWords(collectedWord, rNodeMapEntry.second, remainingWords, rFoundWords);
+            // Suspect input to be incomplete ("Hus" -> "Haus")
+            if (state.remainingInputPauses > 0)
+            {
+                SearchState pauseChild = child;
+                pauseChild.inputIndex = state.inputIndex;
+                pauseChild.cost = state.cost + 1;
+                pauseChild.remainingInputRepeatIgnores = 0;
+                pauseChild.remainingInputRepeatPauses = 0;
+                pauseChild.remainingInputPauses = state.remainingInputPauses - 1;
+                pauseChild.remainingInputIgnores = state.remainingInputIgnores;
+                pauseChild.mayAddLongerWords = false;
+                pushState(pauseChild);
+            }
 
-                // Break out of for loop when no more words should be added
-                if(remainingWords <= 0) { break; }
+            // Ignore some input ("Huus" -> "Haus")
+            if (state.remainingInputIgnores > 0 && rEdge.letter != c)
+            {
+                SearchState ignoreChild = child;
+                ignoreChild.inputIndex = state.inputIndex + 1;
+                ignoreChild.cost = state.cost + 1;
+                ignoreChild.remainingInputRepeatIgnores = 0;
+                ignoreChild.remainingInputRepeatPauses = 0;
+                ignoreChild.remainingInputPauses = state.remainingInputPauses;
+                ignoreChild.remainingInputIgnores = state.remainingInputIgnores - 1;
+                ignoreChild.mayAddLongerWords = false;
+                pushState(ignoreChild);
             }
         }
 
-        // Return how many words may be added further
-        return remainingWords;
+        // "Aaal" -> "Aal" should be found (too many letters)
+        if (state.inputIndex > 0 && state.remainingInputRepeatIgnores > 0 && c == rInput[state.inputIndex - 1])
+        {
+            SearchState child = state;
+            child.parent = stateIndex;
+            child.letter = 0;
+            child.inputIndex = state.inputIndex + 1;
+            child.cost = state.cost + 1;
+            child.remainingInputRepeatIgnores = state.remainingInputRepeatIgnores - 1;
+            pushState(child);
+        }
     }
 
-    bool Dictionary::addFuzzyWord(const std::u16string& rCollectedWord, WordState collectedState, std::set<std::u16string>& rFoundWords) const
+    void Dictionary::pushState(const SearchState& rState) const
     {
-        switch (collectedState)
+        // Frontier is bounded, further states with this cost are dropped
+        std::deque<std::uint32_t>& rQueue = mSearch.frontier[rState.cost];
+        if (rQueue.size() < DICTIONARY_SEARCH_FRONTIER_SIZE)
         {
-        case WordState::BOTH_STARTS:
+            rQueue.push_back((std::uint32_t)mSearch.states.size());
+            mSearch.states.push_back(rState);
+        }
+        else if (!rState.completion)
         {
-            // Make version with upper case
-            std::u16string collectedWordUpper = rCollectedWord;
-            firstCharacterToUpper(collectedWordUpper);
-
-            // Add both cases
-            rFoundWords.insert(collectedWordUpper);
-            rFoundWords.insert(rCollectedWord);
-            return true;
+            mSearch.statesDropped = true; // completions are thrown away at next input anyway
         }
-        case WordState::UPPER_START:
+    }
+
+    bool Dictionary::addFoundWord(std::uint32_t stateIndex, std::vector<std::u16string>& rFoundWords) const
+    {
+        WordState wordState = mNodes[mSearch.states[stateIndex].node].wordState;
+        if (wordState == WordState::NONE)
         {
-            // Add upper case word
-            std::u16string collectedWordUpper = rCollectedWord;
-            firstCharacterToUpper(collectedWordUpper);
-            rFoundWords.insert(collectedWordUpper);
-            return true;
+            // No word added
+            return false;
         }
-        case WordState::LOWER_START:
+
+        // Collect letters from states
+        std::u16string word;
+        for (std::uint32_t i = stateIndex; i != UINT32_MAX; i = mSearch.states[i].parent)
         {
-            // Add lower case word
-            rFoundWords.insert(rCollectedWord);
-            return true;
+            if (mSearch.states[i].letter != 0)
+            {
+                word.push_back(mSearch.states[i].letter);
+            }
         }
-        default:
+        std::reverse(word.begin(), word.end());
+
+        // Add word in stored cases, if not already found
+        std::u16string wordUpper = word;
+        firstCharacterToUpper(wordUpper);
+        bool added = false;
+        if (wordState == WordState::UPPER_START || wordState == WordState::BOTH_STARTS)
         {
-            // No word added
-            return false;
+            if (std::find(rFoundWords.begin(), rFoundWords.end(), wordUpper) == rFoundWords.end())
+            {
+                rFoundWords.push_back(wordUpper);
+                added = true;
+            }
         }
+        if (wordState == WordState::LOWER_START || wordState == WordState::BOTH_STARTS)
+        {
+            if (std::find(rFoundWords.begin(), rFoundWords.end(), word) == rFoundWords.end())
+            {
+                rFoundWords.push_back(word);
+                added = true;
+            }
         }
+        return added;
     }
 }
@@ -4,10 +4,11 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Dictionary class storing given words of an arbitrary language in a prefix
-// tree structure. Some fuzzy word search with recursion is used to find
-// similar words to input. Found words are ordered by levenshtein distance
-// to original input word.
+// Dictionary class storing given words of an arbitrary language in a minimal
+// directed acyclic word graph. Nodes and edges are kept in flat arrays, which
+// can be written to and read from a file as they are. A best-first fuzzy
+// search finds the words which need the fewest corrections of the input and
+// continues the previous search when the input has only grown.
 
 #ifndef DICTIONARY_H_
 #define DICTIONARY_H_
@@ -16,7 +17,9 @@
 
 #include <string>
 #include <vector>
-#include <set>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
 
 namespace eyegui
 {
@@ -24,69 +27,112 @@ namespace eyegui
     {
     public:
 
-        // Constructor
+        // Constructor. Takes list of words or compiled dictionary
         Dictionary(std::string filepath);
 
         // Destructor
         virtual ~Dictionary();
 
+        // Write compiled dictionary to file. Returns whether successful
+        bool writeToFile(std::string filepath) const;
+
         // Check for exact word
         bool checkForWord(const std::u16string& rWord) const;
 
         // Give similar words sorted by probability.
         // First letter can be made upper case for example for beginning of sentences
-        std::vector<std::u16string> similarWords(const std::u16string& rWord, bool makeFirstLetterUpperCase) const;
+        std::vector<std::u16string> similarWords(
+            const std::u16string& rWord,
+            bool makeFirstLetterUpperCase,
+            uint maxCount = WORD_SUGGEST_MAX_SUGGESTIONS) const;
 
     private:
 
-        // Some typedef for the map
-        struct Node;
-        typedef std::map<char16_t, Node> NodeMap;
-
         // Possible states for word, using 1 byte char as structure. None is used for "here is no word"
         enum class WordState : char { NONE, LOWER_START, UPPER_START, BOTH_STARTS };
 
-        // Add single word to dictionary
-        void addWord(const std::u16string& rWord);
-
-        // Convert to lower case. Returns word state
-        WordState convertToLower(std::u16string& rWord) const;
-
-        // Fuzzy search for words. Takes lower case word as input
-        void fuzzyWordSearch(
-            const std::u16string& rInput,
-            uint inputRepeatIgnoreDepth,
-            uint inputRepeatPauseDepth,
-            uint inputPauseDepth,
-            uint inputIgnoreDepth,
-            std::set<std::u16string>& rFoundWords) const;
-        void fuzzyWordSearch(
-            const std::u16string& rInputWord,
-            uint inputStartIndex,
-            std::u16string collectedWord,
-            Node const * pNode,
-            int remainingInputRepeatIgnores, // How many repeating letters of input can be ("Aaal" -> "Aal")
-            int remainingInputRepeatPauses, // How many repeating letters can be added by algorithm ("Al" -> "Aal")
-            int remainingInputPauses, // How many letters in a word could be missing ("Hus" -> "Haus")
-            int reaminingInputIgnores, // How many letters in a word are possible wrong ("Huus" -> "Haus")
-            bool mayAddLongerWords, // Whether longer words, using collected as prefix, should be included
-            std::set<std::u16string>& rFoundWords) const;
-
-        // Add longer words which use collected word as prefix. One word can be lower and upper case, counted as one. Returns how many further words may be added
-        int addLongerWords(const std::u16string& rCollectedWord, const Node& rNode, int remainingWords, std::set<std::u16string>& rFoundWords) const;
-
-        // Add fuzzy word to found words in fuzzy search. Returns whether successful
-        bool addFuzzyWord(const std::u16string& rCollectedWord, WordState collectedState, std::set<std::u16string>& rFoundWords) const;
-
-        // Inner struct for node. Represented letter is implicit coded in map entry which stores node. Buildung up a tree by reusing existing nodes
+        // Node of graph. Edges of node are stored consecutively, sorted by letter
         struct Node
         {
-            NodeMap children; // Further possible letters to form other words
-            WordState wordState = WordState::NONE; // State of word formed by letters from root to here
+            std::uint32_t firstEdge;
+            std::uint16_t edgeCount;
+            WordState wordState; // state of word formed by letters from root to here
+            std::uint8_t reserved;
+        };
+
+        // Edge of graph
+        struct Edge
+        {
+            char16_t letter;
+            std::uint16_t reserved;
+            std::uint32_t target;
+        };
+
+        // State of fuzzy search. Letters of found word are collected by following parents
+        struct SearchState
+        {
+            std::uint32_t node;
+            std::uint32_t parent; // index of previous state
+            std::uint32_t origin; // index of state whose word is completed, if completion
+            char16_t letter; // letter added by this state, zero if none
+            std::uint16_t inputIndex;
+            std::uint8_t cost; // count of corrections
+            std::int8_t remainingInputRepeatIgnores; // How many repeating letters of input can be ("Aaal" -> "Aal")
+            std::int8_t remainingInputRepeatPauses; // How many repeating letters can be added by algorithm ("Al" -> "Aal")
+            std::int8_t remainingInputPauses; // How many letters in a word could be missing ("Hus" -> "Haus")
+            std::int8_t remainingInputIgnores; // How many letters in a word are possible wrong ("Huus" -> "Haus")
+            bool mayAddLongerWords; // Whether longer words, using collected as prefix, should be included
+            bool completion; // State adds letters behind complete input
+        };
+
+        // Fuzzy search, kept to continue it at next input
+        struct Search
+        {
+            std::u16string input; // lower case
+            std::vector<SearchState> states; // all created states
+            std::vector<std::deque<std::uint32_t> > frontier; // states waiting for expansion, one queue per cost
+            std::vector<std::uint32_t> completeStates; // states which consumed complete input
+            bool statesDropped = false; // frontier was full, so continuing would miss words a new search finds
         };
 
+        // Read words from text file. Returns whether successful
+        static bool readWordList(std::string filepath, std::vector<std::pair<std::u16string, WordState> >& rWords);
+
+        // Read compiled dictionary. Returns whether successful
+        bool readFromFile(std::string filepath);
+
+        // Build minimal graph from words
+        void buildGraph(std::vector<std::pair<std::u16string, WordState> > words);
+
+        // Find child of node reached by letter. Returns false if not existing
+        bool findChild(std::uint32_t node, char16_t letter, std::uint32_t& rChild) const;
+
+        // Convert to lower case. Returns word state
+        static WordState convertToLower(std::u16string& rWord);
+
+        // Start new fuzzy search or continue previous one with longer input. Takes lower case word as input
+        void prepareSearch(const std::u16string& rInput) const;
+
+        // Run fuzzy search until enough words are found
+        void runSearch(uint maxCount, std::vector<std::u16string>& rFoundWords) const;
+
+        // Expand state of fuzzy search
+        void expandState(
+            std::uint32_t stateIndex,
+            uint maxCount,
+            std::unordered_map<std::uint32_t, uint>& rCompletionCounts,
+            std::vector<std::u16string>& rFoundWords) const;
+
+        // Add state to frontier of search
+        void pushState(const SearchState& rState) const;
+
+        // Add word of state to found words. Returns whether successful
+        bool addFoundWord(std::uint32_t stateIndex, std::vector<std::u16string>& rFoundWords) const;
+
         // Members
-        std::map<char16_t, Node> mRootMap; // Root map
+        std::vector<Node> mNodes; // first one is root
+        std::vector<Edge> mEdges;
+        mutable Search mSearch;
     };
 }
 
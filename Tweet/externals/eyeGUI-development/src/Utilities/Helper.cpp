@@ -379,4 +379,14 @@ namespace eyegui
             rInput += u"\n";
         }
     }
+
+    std::uint64_t hashBytes(char const * pBytes, size_t count, std::uint64_t hash)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            hash ^= (unsigned char)pBytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
 }
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <algorithm>
+#include <cstdint>
 
 namespace eyegui
 {
@@ -44,6 +45,9 @@ namespace eyegui
     // Streamline LF, CR and CR+LF endings to LF
     void streamlineLineEnding(std::string& rInput, bool addNewLineAtEnd = false);
     void streamlineLineEnding(std::u16string& rInput, bool addNewLineAtEnd = false);
+
+    // FNV-1a hash of bytes, continues given hash to combine multiple inputs
+    std::uint64_t hashBytes(char const * pBytes, size_t count, std::uint64_t hash = 14695981039346656037ull);
 }
 
 #endif // HELPER_H_
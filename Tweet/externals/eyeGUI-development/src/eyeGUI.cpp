@@ -11,6 +11,7 @@
 #include "Layout.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Utilities/Dictionary.h"
 
 // Version
 static const std::string VERSION_STRING = "0.9";
@@ -30,7 +31,9 @@ namespace eyegui
             fontMediumSize,
             fontSmallSize,
             descriptionFontSize,
-            resizeInvisibleLayouts);
+            resizeInvisibleLayouts,
+            graphicsCacheDirectory,
+            layoutCacheDirectory);
     }
 
     Layout* addLayout(GUI* pGUI, std::string filepath, int layer, bool visible)
@@ -106,6 +109,12 @@ namespace eyegui
         return pGUI->addDictionary(filepath);
     }
 
+    bool compileDictionary(std::string wordListFilepath, std::string dictionaryFilepath)
+    {
+        Dictionary dictionary(wordListFilepath);
+        return dictionary.writeToFile(dictionaryFilepath);
+    }
+
     void setValueOfConfigAttribute(
         GUI* pGUI,
         std::string attribute,
@@ -238,6 +247,27 @@ namespace eyegui
         pLayout->setValueOfStyleAttribute(styleName, attribute, value);
     }
 
+    void setValueOfStyleAttribute(
+        Layout* pLayout,
+        std::string styleName,
+        StyleColor attribute,
+        float red,
+        float green,
+        float blue,
+        float alpha)
+    {
+        pLayout->setValueOfStyleAttribute(styleName, attribute, glm::vec4(red, green, blue, alpha));
+    }
+
+    void setValueOfStyleAttribute(
+        Layout* pLayout,
+        std::string styleName,
+        StyleValue attribute,
+        float value)
+    {
+        pLayout->setValueOfStyleAttribute(styleName, attribute, value);
+    }
+
     void setIconOfIconElement(Layout* pLayout, std::string id, std::string iconFilepath)
     {
         pLayout->setIconOfIconElement(id, iconFilepath);
@@ -256,6 +286,21 @@ namespace eyegui
         pLayout->setIconOfIconElement(id, name, width, height, format, pIconData, flipY);
     }
 
+    void setImageOfPicture(Layout* pLayout, std::string id, std::string filepath, ImageAlignment alignment)
+    {
+        pLayout->setImageOfPicture(id, filepath, alignment);
+    }
+
+    void setAppearanceOfBlock(
+        Layout* pLayout,
+        std::string id,
+        bool consumeInput,
+        std::string backgroundFilepath,
+        ImageAlignment backgroundAlignment)
+    {
+        pLayout->setAppearanceOfBlock(id, consumeInput, backgroundFilepath, backgroundAlignment);
+    }
+
     void setImageOfPicture(
         Layout* pLayout,
         std::string id,
@@ -21,7 +21,7 @@ void ActionBarButton::hit(eyegui::Layout* pLayout, std::string id)
         if (id.compare("likeButton") == 0) {
 
             std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-            TwitterApp::getInstance()->getTwitter()->createFavorites(tweetid);
+            TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [tweetid](Twitter* pTwitter) { return pTwitter->createFavorites(tweetid); }, Twitter::Callback());
             TwitterApp::getInstance()->updateCurrentPage();
         }
         if (id.compare("writePNButton") == 0) {
@@ -33,7 +33,7 @@ void ActionBarButton::hit(eyegui::Layout* pLayout, std::string id)
         if (id.compare("dislikeButton") == 0) {
 
             std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-            TwitterApp::getInstance()->getTwitter()->destroyFavorites(tweetid);
+            TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [tweetid](Twitter* pTwitter) { return pTwitter->destroyFavorites(tweetid); }, Twitter::Callback());
             TwitterApp::getInstance()->updateCurrentPage();
         }
 
@@ -66,7 +66,8 @@ void ActionBarButton::hit(eyegui::Layout* pLayout, std::string id)
     }
 
     if (id.compare("followButton") == 0) {
-        TwitterApp::getInstance()->getTwitter()->createFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
+        std::string userId = TwitterApp::getInstance()->actionButtonArea->userId;
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [userId](Twitter* pTwitter) { return pTwitter->createFriendship(userId, true); }, Twitter::Callback());
         TwitterApp::getInstance()->updateCurrentPage();
 
     }
@@ -81,18 +82,19 @@ void ActionBarButton::hit(eyegui::Layout* pLayout, std::string id)
 
     }
     if (id.compare("unfollowButton") == 0) {
-        TwitterApp::getInstance()->getTwitter()->destroyFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
+        std::string userId = TwitterApp::getInstance()->actionButtonArea->userId;
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [userId](Twitter* pTwitter) { return pTwitter->destroyFriendship(userId, true); }, Twitter::Callback());
         TwitterApp::getInstance()->updateCurrentPage();
 
     }
     if (id.compare("retweetButton") == 0) {
         std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-        TwitterApp::getInstance()->getTwitter()->retweet(tweetid);
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [tweetid](Twitter* pTwitter) { return pTwitter->retweet(tweetid); }, Twitter::Callback());
         TwitterApp::getInstance()->updateCurrentPage();
     }
     if (id.compare("deleteButton") == 0) {
         std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-        TwitterApp::getInstance()->getTwitter()->statusDestroy(tweetid);
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [tweetid](Twitter* pTwitter) { return pTwitter->statusDestroy(tweetid); }, Twitter::Callback());
         TwitterApp::getInstance()->updateCurrentPage();
     }
 }
@@ -115,7 +117,9 @@ void ActionBarButton::down(eyegui::Layout* pLayout, std::string id) {
 */
 void ActionBarButton::up(eyegui::Layout* pLayout, std::string id) {
         if (id.compare("writePNButton") == 0) {
-            TwitterApp::getInstance()->getTwitter()->sendDirectMessage(keyWord, TwitterApp::getInstance()->actionButtonArea->userId, true);
+            std::string text = keyWord;
+            std::string userId = TwitterApp::getInstance()->actionButtonArea->userId;
+            TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [text, userId](Twitter* pTwitter) { return pTwitter->sendDirectMessage(text, userId, true); }, Twitter::Callback());
             keyWord="";
         }
 }
@@ -0,0 +1,80 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "src/Eyetracker/GazeFilter.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    double distance(const GazeSample& a, const GazeSample& b)
+    {
+        return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+    }
+
+    std::chrono::milliseconds now()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch());
+    }
+}
+
+void GazeFilter::update(const std::vector<GazeSample>& samples)
+{
+    this->samples.insert(this->samples.end(), samples.begin(), samples.end());
+    if (this->samples.empty())
+    {
+        return;
+    }
+
+    // Forget samples outside of window, but keep newest one for input to stay where it was
+    std::chrono::milliseconds windowStart = now() - std::chrono::milliseconds((long long)(GAZE_FILTER_WINDOW_TIME * 1000));
+    while (this->samples.size() > 1 && this->samples.front().timestamp < windowStart)
+    {
+        this->samples.pop_front();
+    }
+
+    // Gaussian weights over window, so that no weight falls below 0.05
+    const int size = (int)this->samples.size();
+    double sigma = std::sqrt(-std::pow(std::max(size - 1, 1), 2.0) / (2.0 * std::log(0.05)));
+
+    // Newest sample is only used when there is no older one, as it could be an outlier
+    int start = size > 1 ? size - 2 : 0;
+    double sumX = 0;
+    double sumY = 0;
+    double weightSum = 0;
+    int weightIndex = 0;
+    for (int i = start; i >= 0; --i)
+    {
+        const GazeSample& rSample = this->samples[i];
+        if (i < size - 1 && distance(this->samples[i + 1], rSample) > GAZE_FILTER_FIXATION_RADIUS)
+        {
+            // Skip single outlier if next older sample belongs to fixation again
+            if (i > 0 && distance(this->samples[i + 1], this->samples[i - 1]) <= GAZE_FILTER_FIXATION_RADIUS)
+            {
+                continue;
+            }
+            break; // start of fixation reached
+        }
+        double weight = std::exp(-std::pow(weightIndex, 2.0) / (2.0 * sigma * sigma));
+        sumX += rSample.x * weight;
+        sumY += rSample.y * weight;
+        weightSum += weight;
+        weightIndex++;
+    }
+    if (weightSum > 0)
+    {
+        gazeX = sumX / weightSum;
+        gazeY = sumY / weightSum;
+    }
+}
+
+float GazeFilter::getAge() const
+{
+    if (samples.empty())
+    {
+        return std::numeric_limits<float>::max();
+    }
+    return (float)(now() - samples.back().timestamp).count() / 1000.f;
+}
@@ -0,0 +1,48 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Weighted average of gaze samples within current fixation, like the filter of
+// GazeTheWeb - Browse. Samples are walked from newest to oldest with gaussian
+// weights until one is further away than the fixation radius. A single sample
+// outside the radius is skipped as outlier, which delays input by one sample.
+
+#ifndef GAZEFILTER_H
+#define GAZEFILTER_H
+
+#include "src/Eyetracker/GazeSamples.h"
+#include <deque>
+
+// Samples older than this are not filtered, in seconds
+const float GAZE_FILTER_WINDOW_TIME = 1.f;
+
+// Distance of samples still belonging to one fixation, in screen pixels
+const double GAZE_FILTER_FIXATION_RADIUS = 30.0;
+
+class GazeFilter
+{
+public:
+
+    // Add new samples and filter
+    void update(const std::vector<GazeSample>& samples);
+
+    // Whether any sample was received yet
+    bool hasGaze() const { return !this->samples.empty(); }
+
+    // Filtered gaze in screen pixels
+    double getGazeX() const { return gazeX; }
+    double getGazeY() const { return gazeY; }
+
+    // Age of newest sample in seconds
+    float getAge() const;
+
+private:
+
+    // Samples within window, oldest first
+    std::deque<GazeSample> samples;
+
+    // Filtered gaze
+    double gazeX = 0;
+    double gazeY = 0;
+};
+
+#endif // GAZEFILTER_H
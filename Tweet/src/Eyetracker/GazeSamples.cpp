@@ -0,0 +1,49 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "src/Eyetracker/GazeSamples.h"
+#include <mutex>
+
+namespace
+{
+    // Ring, guarded by mutex as eye tracker pushes from its own thread
+    GazeSample ring[GAZE_SAMPLE_CAPACITY];
+    int ringStart = 0;
+    int ringCount = 0;
+    std::mutex ringMutex;
+}
+
+void gaze_push_sample(double x, double y)
+{
+    if (x == 0 && y == 0)
+    {
+        return;
+    }
+    GazeSample sample;
+    sample.x = x;
+    sample.y = y;
+    sample.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch());
+
+    std::lock_guard<std::mutex> lock(ringMutex);
+    ring[(ringStart + ringCount) % GAZE_SAMPLE_CAPACITY] = sample;
+    if (ringCount < GAZE_SAMPLE_CAPACITY)
+    {
+        ringCount++;
+    }
+    else
+    {
+        ringStart = (ringStart + 1) % GAZE_SAMPLE_CAPACITY; // oldest sample was overwritten
+    }
+}
+
+void gaze_fetch_samples(std::vector<GazeSample>& samples)
+{
+    std::lock_guard<std::mutex> lock(ringMutex);
+    for (int i = 0; i < ringCount; i++)
+    {
+        samples.push_back(ring[(ringStart + i) % GAZE_SAMPLE_CAPACITY]);
+    }
+    ringStart = 0;
+    ringCount = 0;
+}
@@ -0,0 +1,36 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Gaze samples are pushed by the callback thread of the eye tracker and fetched
+// by the main loop, which filters them. Samples are kept in a ring of fixed
+// size, so the oldest ones are overwritten when the main loop stalls.
+
+#ifndef GAZESAMPLES_H
+#define GAZESAMPLES_H
+
+#include <vector>
+#include <chrono>
+
+// Capacity of ring, about two seconds at 120Hz
+const int GAZE_SAMPLE_CAPACITY = 256;
+
+// Sample in screen pixels
+struct GazeSample
+{
+    double x;
+    double y;
+    std::chrono::milliseconds timestamp; // time since epoch of steady clock, so wall clock changes do not age samples
+};
+
+/**
+* Push sample, called from eye tracker thread. Samples at origin are dropped, as
+* eye trackers report them when no eye was found.
+*/
+void gaze_push_sample(double x, double y);
+
+/**
+* Move pushed samples to end of given vector, oldest first. Called from main thread.
+*/
+void gaze_fetch_samples(std::vector<GazeSample>& samples);
+
+#endif // GAZESAMPLES_H
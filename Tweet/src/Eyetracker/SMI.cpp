@@ -31,6 +31,7 @@
 //  Modified for "GazeTheWeb - Tweet" application (05/02/2016)
 
 #include "src/Eyetracker/SMI.h"
+#include <algorithm>
 
 #ifdef USEEYETRACKER_IVIEW
 /**
@@ -38,16 +39,14 @@
 */
 int __stdcall SampleCallbackFunction(SampleStruct sampleData)
 {
-    //std::cout << "From Sample Callback X: " << sampleData.leftEye.gazeX << " Y: " << sampleData.leftEye.gazeY << std::endl;
-    eye_tracker_x = sampleData.leftEye.gazeX;
-    eye_tracker_y = sampleData.leftEye.gazeY;
+    // use eye which is found, the other one reports zero
+    gaze_push_sample(
+        (std::max)(sampleData.leftEye.gazeX, sampleData.rightEye.gazeX),
+        (std::max)(sampleData.leftEye.gazeY, sampleData.rightEye.gazeY));
 
     return 1;
 }
 
-double eye_tracker_x = 0;
-double eye_tracker_y = 0;
-
 /**
 * Setup connection to IView Eye Tracker
 */
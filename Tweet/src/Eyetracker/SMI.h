@@ -36,8 +36,7 @@
 #include <stdlib.h>
 #include <iostream>
 #include "iViewXAPI.h"
-
-extern double eye_tracker_x, eye_tracker_y;
+#include "src/Eyetracker/GazeSamples.h"
 
 /**
 * Setup connection to IView Eye Tracker
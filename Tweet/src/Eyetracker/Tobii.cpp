@@ -98,8 +98,7 @@ void OnGazeDataEvent(TX_HANDLE hGazeDataBehavior)
     TX_GAZEPOINTDATAEVENTPARAMS eventParams;
     if (txGetGazePointDataEventParams(hGazeDataBehavior, &eventParams) == TX_RESULT_OK) {
         //printf("Gaze Data: (%.1f, %.1f) timestamp %.0f ms\n", eventParams.X, eventParams.Y, eventParams.Timestamp);
-        eye_tracker_x = eventParams.X;
-        eye_tracker_y = eventParams.Y;
+        gaze_push_sample(eventParams.X, eventParams.Y);
     }
     else {
         printf("Failed to interpret gaze data event packet.\n");
@@ -131,9 +130,6 @@ void TX_CALLCONVENTION HandleEvent(TX_CONSTHANDLE hAsyncData, TX_USERPARAM userP
     txReleaseObject(&hEvent);
 }
 
-double eye_tracker_x = 0;
-double eye_tracker_y = 0;
-
 /**
 * Setup and initialize connection to Tobii Eye Tracker
 */
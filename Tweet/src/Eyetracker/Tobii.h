@@ -13,11 +13,10 @@
 #include <conio.h>
 #include <assert.h>
 #include "eyex/EyeX.h"
+#include "src/Eyetracker/GazeSamples.h"
 
 #pragma comment (lib, "Tobii.EyeX.Client.lib")
 
-extern double eye_tracker_x, eye_tracker_y;
-
 /**
 * Initializes g_hGlobalInteractorSnapshot with an interactor that has the Gaze Point behavior.
 */
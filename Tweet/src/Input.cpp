@@ -3,22 +3,86 @@
 //============================================================================
 
 #include "Input.h"
+#include "src/Eyetracker/GazeFilter.h"
+#include <cmath>
+
+namespace
+{
+    // Filter of eye tracker samples
+    GazeFilter filter;
+
+    // State of mouse override
+    double mouseX = 0;
+    double mouseY = 0;
+    double lastTime = -1;
+    bool mouseOverride = false;
+    bool mouseOverrideInit = false;
+    double mouseOverrideX = 0;
+    double mouseOverrideY = 0;
+    float mouseOverrideTime = 0;
+
+    // Update override of eye tracker by mouse, which starts when mouse is moved far enough in short time
+    void update_mouse_override(double x, double y, float tpf)
+    {
+        if (mouseOverride)
+        {
+            if (x == mouseX && y == mouseY)
+            {
+                mouseOverrideTime -= tpf;
+                mouseOverride = mouseOverrideTime > 0;
+            }
+            else
+            {
+                mouseOverrideTime = INPUT_MOUSE_OVERRIDE_STOP_DURATION;
+            }
+        }
+        else if (mouseOverrideInit)
+        {
+            mouseOverrideTime -= tpf;
+            if (mouseOverrideTime <= 0)
+            {
+                double dx = x - mouseOverrideX;
+                double dy = y - mouseOverrideY;
+                mouseOverride = std::sqrt(dx * dx + dy * dy) >= INPUT_MOUSE_OVERRIDE_INIT_DISTANCE;
+                mouseOverrideInit = false;
+                mouseOverrideTime = INPUT_MOUSE_OVERRIDE_STOP_DURATION;
+            }
+        }
+        else if (x != mouseX || y != mouseY)
+        {
+            mouseOverrideInit = true;
+            mouseOverrideX = x;
+            mouseOverrideY = y;
+            mouseOverrideTime = INPUT_MOUSE_OVERRIDE_INIT_DURATION;
+        }
+        mouseX = x;
+        mouseY = y;
+    }
+}
 
 void input_get_xy(int &x, int &y, GLFWwindow* window) {
-#ifdef USEEYETRACKER_IVIEW
-    x = (int)eye_tracker_x;
-    y = (int)eye_tracker_y;
-#else
-#ifdef USEEYETRACKER_TOBII
-    x = (int)eye_tracker_x;
-    y = (int)eye_tracker_y;
-#else
-    double dx, dy;
-    glfwGetCursorPos(window, &dx, &dy);
-    x = (int)dx;
-    y = (int)dy;
-#endif
-#endif
+    double time = glfwGetTime();
+    float tpf = lastTime < 0 ? 0.f : (float)(time - lastTime);
+    lastTime = time;
+
+    // Mouse is fallback and may override eye tracker
+    double cursorX, cursorY;
+    glfwGetCursorPos(window, &cursorX, &cursorY);
+    update_mouse_override(cursorX, cursorY, tpf);
+
+    // Filter samples pushed by eye tracker since last frame
+    std::vector<GazeSample> samples;
+    gaze_fetch_samples(samples);
+    filter.update(samples);
+
+    if (!mouseOverride && filter.hasGaze() && filter.getAge() < INPUT_MAXIMUM_GAZE_AGE) {
+        x = (int)filter.getGazeX();
+        y = (int)filter.getGazeY();
+    }
+    else {
+        x = (int)cursorX;
+        y = (int)cursorY;
+    }
 }
 
 void input_setup() {
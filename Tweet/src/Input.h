@@ -3,6 +3,12 @@
 //============================================================================
 
 // This class abstractes from the actual input mode (iViewX or TobiiEyeX or Mouse).
+// Samples of the eye tracker are filtered and the mouse overrides them when moved
+// far enough, like in GazeTheWeb - Browse.
+
+#ifndef INPUT_H
+#define INPUT_H
+
 #include "externals/GLFW/include/GLFW/glfw3.h"
 
 #ifdef USEEYETRACKER_IVIEW
@@ -13,6 +19,18 @@
     #include "src/Eyetracker/Tobii.h"
 #endif
 
+// Mouse must be moved this far within init duration to override eye tracker, in pixels
+const float INPUT_MOUSE_OVERRIDE_INIT_DISTANCE = 100.f;
+
+// Duration in which mouse movement is measured, in seconds
+const float INPUT_MOUSE_OVERRIDE_INIT_DURATION = 0.25f;
+
+// Duration without mouse movement until override is stopped, in seconds
+const float INPUT_MOUSE_OVERRIDE_STOP_DURATION = 1.5f;
+
+// Gaze older than this is not used and mouse is taken instead, in seconds
+const float INPUT_MAXIMUM_GAZE_AGE = 1.f;
+
 // Get the x and y value of the input
 void input_get_xy(int &x, int &y, GLFWwindow* window);
 
@@ -21,3 +39,5 @@ void input_setup();
 
 // Disconnect input (only necessary for eye tracker, if mode is mouse nothing will be done here)
 void input_disconnect();
+
+#endif // INPUT_H
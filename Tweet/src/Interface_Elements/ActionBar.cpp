@@ -191,17 +191,7 @@ void ActionBar::renewImage() {
     // Download avatar image:
     std::string str = mediaLinks.at(picIndex);
 
-    // Extract file extension
-    size_t i = str.rfind('.', str.length());
-    std::string ext = str.substr(i + 1, str.length() - i);
-
-    // Set filename using this rule: profile_ + Profile ID + extension
-    std::string filename = "img/tmp/picture_" + str.substr(str.size() - 9, str.size() - 5) + "." + ext;
-
-    std::string path = CONTENT_PATH + std::string("/") + filename;
-    download_image((char*)str.c_str(), (char*)path.c_str());
-    eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-    eyegui::replaceElementWithPicture(pLayout, "shownPicture", filename, alignment, false);
+    show_image(pLayout, "shownPicture", str, "img/invisProf.png");
 }
 
 /**
@@ -4,7 +4,7 @@
 
 #include "ConnectPageArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/imageDownload.h"
+#include "src/TwitterClient/ImageDownload.h"
 #include <string>
 
 /**
@@ -77,7 +77,7 @@ void ConnectPageArea::selectContent(std::string id) {
 				eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/WallActionBar/actionBarWall" +currentlySelected + ".png", alignment);
 				eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
-				eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+				eyegui::setAppearanceOfBlock(pLayout, "rightSide" + currentlySelected, true, "Eprojekt_Design/tweetConnection.png", alignment);
 
 				std::cout << "Result " + id + " has been hit" << std::endl;
 				if (stoi(currentlySelected) >= counter)
@@ -123,12 +123,20 @@ void ConnectPageArea::switchStatus() {
 void ConnectPageArea::showStatus() {
 	if (receivedMessages)
 	{
-		content = TwitterApp::getInstance()->getTwitter()->getDirectMessages();
-		showMessagesReceived();
+		TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "directMessages",
+			[](Twitter* pTwitter) { return pTwitter->getDirectMessages(); },
+			[this](rapidjson::Document& rDocument) {
+			content = std::move(rDocument);
+			showMessagesReceived();
+		});
 	}
 	else {
-		content = TwitterApp::getInstance()->getTwitter()->getDirectMessagesSent();
-		showMessagesSend();
+		TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "directMessagesSent",
+			[](Twitter* pTwitter) { return pTwitter->getDirectMessagesSent(); },
+			[this](rapidjson::Document& rDocument) {
+			content = std::move(rDocument);
+			showMessagesSend();
+		});
 	}
 }
 
@@ -203,22 +211,11 @@ void ConnectPageArea::showMessagesReceived() {
 			// Download avatar image:
 			std::string str = content[i]["sender"]["profile_image_url"].GetString();
 
-			// Extract file extension
-			size_t z = str.rfind('.', str.length());
-			std::string ext = str.substr(z + 1, str.length() - z);
-
-			// Set filename using this rule: profile_ + Profile ID + extension
-			std::string filename = "img/tmp/profile_" + std::string(content[i]["sender"]["id_str"].GetString()) + "." + ext;
-
 			// Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
 			int indexStr = str.find("_normal.");
 			str = str.replace(indexStr, 8, "_400x400.");
 
-			std::string path = CONTENT_PATH + std::string("/") + filename;
-			download_image((char*)str.c_str(), (char*)path.c_str());
-
-			eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-			eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+			show_image(pLayout, "profilePic" + std::to_string(i - index + 1), str, "img/invisProf.png");
 
 		
 		}
@@ -256,22 +253,11 @@ void ConnectPageArea::showMessagesSend() {
 			// Download avatar image:
 			std::string str = content[i]["recipient"]["profile_image_url"].GetString();
 
-			// Extract file extension
-			size_t z = str.rfind('.', str.length());
-			std::string ext = str.substr(z + 1, str.length() - z);
-
-			// Set filename using this rule: profile_ + Profile ID + extension
-			std::string filename = "img/tmp/profile_" + std::string(content[i]["recipient"]["id_str"].GetString()) + "." + ext;
-
 			// Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
 			int indexStr = str.find("_normal.");
 			str = str.replace(indexStr, 8, "_400x400.");
 
-			std::string path = CONTENT_PATH + std::string("/") + filename;
-			download_image((char*)str.c_str(), (char*)path.c_str());
-
-			eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-			eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+			show_image(pLayout, "profilePic" + std::to_string(i - index + 1), str, "img/invisProf.png");
 		}
 		std::string fillUp = " ";
 		for (int r = counter; r < 4; r++)
@@ -74,15 +74,22 @@ void DiscoverPageArea::hide() {
 void DiscoverPageArea::updateDiscoveryChannel() {
 
     if (TwitterApp::getInstance()->hasConnection()) {
-    content = TwitterApp::getInstance()->getTwitter()->getCurrentTrends();
-
-    rapidjson::Document jObj2 = TwitterApp::getInstance()->getTwitter()->suggestionsGetSlugs("de");
-
-    int iSecret = rand() % jObj2.Size();
-
-    suggestions = TwitterApp::getInstance()->getTwitter()->suggestionsGet(jObj2[iSecret]["slug"].GetString(), "de");
-
-    showDiscoveryChannel();
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "currentTrends",
+            [](Twitter* pTwitter) { return pTwitter->getCurrentTrends(); },
+            [this](rapidjson::Document& rDocument) { content = std::move(rDocument); });
+
+        // Suggestions of random slug, both requested on worker thread
+        int random = rand();
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "",
+            [random](Twitter* pTwitter) {
+            rapidjson::Document jObj2 = pTwitter->suggestionsGetSlugs("de");
+            int iSecret = random % jObj2.Size();
+            return pTwitter->suggestionsGet(jObj2[iSecret]["slug"].GetString(), "de");
+        },
+            [this](rapidjson::Document& rDocument) {
+            suggestions = std::move(rDocument);
+            showDiscoveryChannel();
+        });
     }
 }
 
@@ -108,62 +115,29 @@ void DiscoverPageArea::showDiscoveryChannel() {
         // Download avatar image:
         std::string str = suggestions["users"][suggestionnmbr]["profile_image_url"].GetString();
 
-        // Extract file extension
-        size_t i = str.rfind('.', str.length());
-        std::string ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr]["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         int index = str.find("_normal.");
         str = str.replace(index, 8, "_400x400.");
 
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture1", filename, alignment, false);
+        show_image(pLayout, "picture1", str, "img/invisProf.png");
 
         // Download avatar image:
         str = suggestions["users"][suggestionnmbr+1]["profile_image_url"].GetString();
 
-        // Extract file extension
-        i = str.rfind('.', str.length());
-        ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr+1]["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         index = str.find("_normal.");
         str = str.replace(index, 8, "_400x400.");
 
-        path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture2", filename, alignment, false);
+        show_image(pLayout, "picture2", str, "img/invisProf.png");
 
         // Download avatar image:
         str = suggestions["users"][suggestionnmbr + 2]["profile_image_url"].GetString();
 
-        // Extract file extension
-        i = str.rfind('.', str.length());
-        ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr + 2]["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         index = str.find("_normal.");
         str = str.replace(index, 8, "_400x400.");
 
-        path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture3", filename, alignment, false);
+        show_image(pLayout, "picture3", str, "img/invisProf.png");
     }
 }
 
@@ -217,7 +191,7 @@ void DiscoverPageArea::selectTweet(std::string id) {
                 eyegui::setStyleOfElement(pLayout, "action_button_area", "invisible");
                 eyegui::replaceElementWithPicture(pLayout, "suggestion" + currentlySelected, "Eprojekt_Design/selectedProfile.png", alignment);
                 eyegui::setStyleOfElement(pLayout, "suggestion" + currentlySelected, "invisible");
-                eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/profileConnection.png", alignment);
+                eyegui::setAppearanceOfBlock(pLayout, "rightSide" + currentlySelected, true, "Eprojekt_Design/profileConnection.png", alignment);
                 TwitterApp::getInstance()->actionButtonArea->changeToProfilesWithGo(suggestions["users"][(selection - 4+suggestionnmbr)]["id_str"].GetString(),suggestions["users"][(selection-4+ suggestionnmbr)]["following"].GetBool());
                 std::cout << "profile " + currentlySelected + " hit" << std::endl;
             }
@@ -177,7 +177,7 @@ void ProfilePageArea::selectContent(std::string id) {
             {
                 eyegui::replaceElementWithPicture(pLayout, "content" + currentlySelected, "Eprojekt_Design/tweetSelected.png", alignment);
                 eyegui::setStyleOfElement(pLayout, "content" + currentlySelected, "block");
-                eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+                eyegui::setAppearanceOfBlock(pLayout, "rightSide" + currentlySelected, true, "Eprojekt_Design/tweetConnection.png", alignment);
 
 
             }
@@ -220,16 +220,23 @@ void ProfilePageArea::selectContent(std::string id) {
 */
 void ProfilePageArea::updateTimeline(bool reset) {
     if (TwitterApp::getInstance()->hasConnection()) {
-        tweetcontents = (TwitterApp::getInstance()->getTwitter()->getTimelineUser(true, true, 21, currentProfile, true));
-        usercontents = (TwitterApp::getInstance()->getTwitter()->showUser(currentProfile, true));
-        if (tweetcontents.Size() < 3) {
-            std::cout << "Couldnt get 3 Tweets from twitter!" << std::endl;
-        }
-        if (reset)
-        {
-            tweetIndex = 0;
-        }
-        showCurrentProfile();
+        std::string profile = currentProfile;
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "timelineUser:" + profile,
+            [profile](Twitter* pTwitter) { return pTwitter->getTimelineUser(true, true, 21, profile, true); },
+            [this](rapidjson::Document& rDocument) { tweetcontents = std::move(rDocument); });
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "showUser:" + profile,
+            [profile](Twitter* pTwitter) { return pTwitter->showUser(profile, true); },
+            [this, reset](rapidjson::Document& rDocument) {
+            usercontents = std::move(rDocument);
+            if (tweetcontents.Size() < 3) {
+                std::cout << "Couldnt get 3 Tweets from twitter!" << std::endl;
+            }
+            if (reset)
+            {
+                tweetIndex = 0;
+            }
+            showCurrentProfile();
+        });
     }
 }
 
@@ -245,22 +252,11 @@ void ProfilePageArea::showCurrentProfile() {
         // Download avatar image:
         std::string str = usercontents["profile_image_url"].GetString();
 
-        // Extract file extension
-        size_t i = str.rfind('.', str.length());
-        std::string ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(usercontents["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         int index = str.find("_normal.");
         str = str.replace(index, 8, "_400x400.");
 
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic", filename, alignment, false);
+        show_image(pLayout, "profilePic", str, "img/invisProf.png");
     }
     std::string temp = " @";
     eyegui::setContentOfTextBlock(pLayout, "toTheTopButton", usercontents["name"].GetString() + temp + usercontents["screen_name"].GetString());
@@ -103,7 +103,7 @@ void SearchPageArea::selectContent(std::string id) {
             eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/SearchActionBar/actionBarSearch" + currentlySelected + ".png", alignment);
             eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
-            eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+            eyegui::setAppearanceOfBlock(pLayout, "rightSide" + currentlySelected, true, "Eprojekt_Design/tweetConnection.png", alignment);
 
             std::cout << "Result " + id + " has been hit" << std::endl;
             if (stoi(currentlySelected)>=counter)
@@ -285,18 +285,27 @@ void SearchPageArea::search() {
     index = 0;
     if (searchWord=="") return;
     if (TwitterApp::getInstance()->hasConnection()) {
+        std::string word = searchWord;
         if (userSearch)
         {
-            content = TwitterApp::getInstance()->getTwitter()->userSearch(searchWord, "80");
-            contentExists = true;
-            currentcontisuser = true;
-            showUsers();
+            TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "userSearch:" + word,
+                [word](Twitter* pTwitter) { return pTwitter->userSearch(word, "80"); },
+                [this](rapidjson::Document& rDocument) {
+                content = std::move(rDocument);
+                contentExists = true;
+                currentcontisuser = true;
+                showUsers();
+            });
         }
         else {
-            content = TwitterApp::getInstance()->getTwitter()->search(searchWord, "80");
-            contentExists = true;
-            currentcontisuser = false;
-            showTweets();
+            TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "search:" + word,
+                [word](Twitter* pTwitter) { return pTwitter->search(word, "80"); },
+                [this](rapidjson::Document& rDocument) {
+                content = std::move(rDocument);
+                contentExists = true;
+                currentcontisuser = false;
+                showTweets();
+            });
         }
     }
 }
@@ -318,22 +327,11 @@ void SearchPageArea::showTweets() {
         // Download avatar image:
         std::string str = content["statuses"][i]["user"]["profile_image_url"].GetString();
 
-            // Extract file extension
-            size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content["statuses"][i]["user"]["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         int indexStr = str.find("_normal.");
         str = str.replace(indexStr, 8, "_400x400.");
 
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+        show_image(pLayout, "profilePic" + std::to_string(i - index + 1), str, "img/invisProf.png");
 
 
     }
@@ -367,22 +365,11 @@ void SearchPageArea::showUsers() {
         // Download avatar image:
         std::string str = content[i]["profile_image_url"].GetString();
 
-        // Extract file extension
-        size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content[i]["id_str"].GetString()) + "." + ext;
-
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
         int indexStr = str.find("_normal.");
         str = str.replace(indexStr, 8, "_400x400.");
 
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+        show_image(pLayout, "profilePic" + std::to_string(i - index + 1), str, "img/invisProf.png");
 
     }
     std::string fillUp = " ";
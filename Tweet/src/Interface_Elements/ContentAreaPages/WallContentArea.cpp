@@ -5,6 +5,7 @@
 #include "WallContentArea.h"
 #include "src/TwitterApp.h"
 #include "src/TwitterClient/ImageDownload.h"
+#include <algorithm>
 #include <string>
 
 /**
@@ -51,23 +52,51 @@ void WallContentArea::hide() {
 
 /**
 * updateNewsFeed function
-* updates timeline of user over Twitter
-* @param[in] bool if the Tweetindex should be reseted to 0
+* updates timeline of user over Twitter. The timeline is kept in a store on disk, which is shown at once when opened
+* @param[in] bool if the Tweetindex should be reseted to 0. Then only tweets newer than the stored ones are requested,
+*            otherwise the newest tweets are requested again to update their likes and retweets
 */
 void WallContentArea::updateNewsFeed(bool reset) {
 
-    if (TwitterApp::getInstance()->hasConnection()) {
-        content = (TwitterApp::getInstance()->getTwitter()->getTimelineHome(""));
+    std::string user = TwitterApp::getInstance()->userID;
+    if (!store || storeUser.compare(user))
+    {
+        store = std::unique_ptr<TweetStore>(new TweetStore(CONTENT_PATH + std::string("/cache/timeline_") + user + ".json"));
+        storeUser = user;
+        store->load();
+        tweetIndex = 0;
+        showTweets();
+    }
 
+    if (TwitterApp::getInstance()->hasConnection()) {
+        std::string sinceId = reset ? store->newestId() : "";
+        bool incremental = !sinceId.empty();
+        TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "timelineHome:" + sinceId,
+            [sinceId](Twitter* pTwitter) { return pTwitter->getTimelineHome(sinceId); },
+            [this, reset, incremental, user](rapidjson::Document& rDocument) {
+            if (storeUser.compare(user))
+            {
+                return;
+            }
+            if (rDocument.IsArray() && !rDocument.Empty())
+            {
+                store->merge(rDocument, incremental);
+                store->save();
+            }
 
-        if (content.Size() < 4) {
-            std::cout << "Couldnt get 4 Tweets from twitter!" << std::endl;
-        }
-        if (reset)
-        {
-            tweetIndex = 0;
-        }
-        showTweets();
+            if (store->size() < 4) {
+                std::cout << "Couldnt get 4 Tweets from twitter!" << std::endl;
+            }
+            if (reset)
+            {
+                tweetIndex = 0;
+            }
+            else
+            {
+                tweetIndex = std::max(0, std::min(tweetIndex, (int)store->size() - 4));
+            }
+            showTweets();
+        });
     }
 }
 
@@ -77,12 +106,16 @@ void WallContentArea::updateNewsFeed(bool reset) {
 * @param[in] i is the int for how much will be scrolled
 */
 void WallContentArea::scrollUp(int i) {
-    if (tweetIndex + 4+i <content.Size())
+    if (!store)
+    {
+        return;
+    }
+    if (tweetIndex + 4+i < (int)store->size())
     {
         tweetIndex += i;
     }
     else {
-        tweetIndex = content.Size() - 4;
+        tweetIndex = std::max(0, (int)store->size() - 4);
     }
     showTweets();
 }
@@ -110,7 +143,7 @@ void WallContentArea::scrollDown(int i) {
 * @param[out] string of the ID of the tweet
 */
 std::string WallContentArea::getTweetIdAt(int i) {
-    return content[i + tweetIndex]["id_str"].GetString();
+    return store->at(i + tweetIndex).id;
 }
 
 /**
@@ -120,7 +153,7 @@ std::string WallContentArea::getTweetIdAt(int i) {
 * @param[out] string of the ID of the user
 */
 std::string WallContentArea::getTweetUser(int i) {
-    return content[i + tweetIndex]["user"]["id_str"].GetString();
+    return store->userOf(store->at(i + tweetIndex)).id;
 }
 
 /**
@@ -130,7 +163,7 @@ std::string WallContentArea::getTweetUser(int i) {
 * @param[out] bool if the the tweet was favorited
 */
 bool WallContentArea::getLikedAt(int i) {
-    return content[i + tweetIndex]["favorited"].GetBool();
+    return store->at(i + tweetIndex).favorited;
 }
 
 /**
@@ -153,7 +186,7 @@ bool WallContentArea::getOwnAt(int i) {
 * @param[out] bool if the the tweet was retweeted
 */
 bool WallContentArea::getRetweetedAt(int i) {
-    return content[i + tweetIndex]["retweeted"].GetBool();
+    return store->at(i + tweetIndex).retweeted;
 }
 
 /**
@@ -162,36 +195,28 @@ bool WallContentArea::getRetweetedAt(int i) {
 * shows the the tweets wich where found
 */
 void WallContentArea::showTweets() {
+    if (!store)
+    {
+        return;
+    }
     std::string temp = "\n";
-    for (rapidjson::SizeType i = tweetIndex; (i < content.Size()) && (i < tweetIndex + 4); i++) {
-        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i-tweetIndex)], content[i]["user"]["name"].GetString()+temp+content[i]["text"].GetString());
-		if (content[i].HasMember("retweeted_status")) {
-		eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(content[i]["retweeted_status"]["favorite_count"].GetInt()));
-		}
-		else {
-	    eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(content[i]["favorite_count"].GetInt()));
-		}
-        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 2], "Retweets: " + std::to_string(content[i]["retweet_count"].GetInt()));
+    for (int i = tweetIndex; (i < (int)store->size()) && (i < tweetIndex + 4); i++) {
+        const StoredTweet& rTweet = store->at(i);
+        const StoredUser& rUser = store->userOf(rTweet);
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i-tweetIndex)], rUser.name+temp+rTweet.text);
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(rTweet.favoriteCount));
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 2], "Retweets: " + std::to_string(rTweet.retweetCount));
 
         // Download avatar image:
-        std::string str = content[i]["user"]["profile_image_url"].GetString();
-
-        // Extract file extension
-        size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content[i]["user"]["id_str"].GetString()) + "." + ext;
+        std::string str = rUser.profileImageUrl;
 
         // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
+        size_t index = str.find("_normal.");
+        if (index != std::string::npos) {
+            str = str.replace(index, 8, "_400x400.");
+        }
 
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic"+std::to_string(i - tweetIndex+1), filename, alignment, false);
+        show_image(pLayout, "profilePic"+std::to_string(i - tweetIndex+1), str, "img/invisProf.png");
     }
 }
 
@@ -221,7 +246,7 @@ void WallContentArea::selectTweet(std::string id) {
                     selectTweet("1");
                     return;
                 }
-                if (stoi(currentlySelected) == 3 && tweetIndex != content.Size() - 4)
+                if (stoi(currentlySelected) == 3 && tweetIndex != (int)store->size() - 4)
                 {
                     scrollUp(1);
                     selectTweet("2");
@@ -236,16 +261,12 @@ void WallContentArea::selectTweet(std::string id) {
                 eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
 
-                eyegui::replaceElementWithPicture(pLayout, "rightSide"+currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+                eyegui::setAppearanceOfBlock(pLayout, "rightSide"+currentlySelected, true, "Eprojekt_Design/tweetConnection.png", alignment);
 
                 std::cout << "Tweet " + id + " has been hit" << std::endl;
-                if (content[stoi(currentlySelected)+tweetIndex]["entities"].HasMember("media"))
+                const std::vector<std::string>& links = store->at(stoi(currentlySelected) + tweetIndex).mediaUrls;
+                if (!links.empty())
                 {
-                    std::vector<std::string> links;
-                    for (int i = 0; i < content[stoi(currentlySelected) + tweetIndex]["extended_entities"]["media"].Size(); i++)
-                    {
-                        links.push_back(content[stoi(currentlySelected) + tweetIndex]["extended_entities"]["media"][i]["media_url"].GetString());
-                    }
                     TwitterApp::getInstance()->actionButtonArea->mediaLinks = links;
                     TwitterApp::getInstance()->actionButtonArea->changeToTweetsWithPics(getTweetIdAt(stoi(currentlySelected)), getTweetUser(stoi(currentlySelected)), getLikedAt(stoi(currentlySelected)), getRetweetedAt(stoi(currentlySelected)), getOwnAt(stoi(currentlySelected)));
 
@@ -7,6 +7,8 @@
 #include "src/Interface_Elements/Element.h"
 #include "src/Buttons/WallButton.h"
 #include "src/TwitterClient/TwitterClient.h"
+#include "src/TwitterClient/TweetStore.h"
+#include <memory>
 #include <thread>
 
 class WallContentArea : public Element {
@@ -33,7 +35,8 @@ private:
     bool getOwnAt(int i);
     std::string currentlySelected = "none";
     std::shared_ptr<WallButton> wallButtonListener = std::shared_ptr<WallButton>(new WallButton);
-    rapidjson::Document content;
+    std::unique_ptr<TweetStore> store; // home timeline of current user
+    std::string storeUser; // user the store belongs to
     int buttonFrames[4];
     int textFrames[4];
     std::string textboxes[12] = {	"textBlock1_1","textBlock1_2","textBlock1_3",
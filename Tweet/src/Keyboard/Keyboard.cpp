@@ -5,6 +5,7 @@
 #include "Keyboard.h"
 #include "src/TwitterApp.h"
 #include <string>
+#include <algorithm>
 
 /**
 * Constructor for the Keyboard
@@ -19,6 +20,7 @@ Keyboard::Keyboard(eyegui::Layout* pLayout, eyegui::Layout* pLayout2) {
 
 //Singletons have to be set to 0, when they are not instanciated yet
 Keyboard* Keyboard::instance = 0;
+const std::string Keyboard::dicts[] = { "eng.txt", "ger.txt", "french.txt", "dutch.txt" };
 
 /**
 * Creates an instance of the Keyboard
@@ -108,9 +110,12 @@ void Keyboard::init() {
     Word2 = eyegui::addFloatingFrameWithBrick(pLayout2, "bricks/Keyboard/keyboardText2.beyegui", 0.4f, 0.235f, 0.7f, HEIGHT, true);
     Word3 = eyegui::addFloatingFrameWithBrick(pLayout2, "bricks/Keyboard/keyboardText3.beyegui", 0.7f, 0.235f, 0.7f, HEIGHT, true);
 
-    // trie.loadDict("../src/Keyboard/dict.txt");
-    dict = CONTENT_PATH + std::string("/dict/") + "eng.txt"; // "../src/Keyboard/eng.txt";
-    trie.loadDict(dict);
+    // Load all languages, so changing it is instant
+    for (const std::string& file : dicts) {
+        tries[CONTENT_PATH + std::string("/dict/") + file].loadDict(CONTENT_PATH + std::string("/dict/") + file);
+    }
+    dict = CONTENT_PATH + std::string("/dict/") + dicts[0];
+    trie = &tries[dict];
 
     Listener(); // initiating KeyListener for the Keyboard class
 
@@ -123,7 +128,8 @@ void Keyboard::init() {
 * Tweeting string variable "ausgabe" through TwitterApp
 */
 void Keyboard::tweet() {
-    TwitterApp::getInstance()->getTwitter()->statusUpdate(ausgabe);
+    std::string text = ausgabe;
+    TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [text](Twitter* pTwitter) { return pTwitter->statusUpdate(text); }, Twitter::Callback());
     TwitterApp::getInstance()->wallContentArea->updateNewsFeed(true);
     abort();
 }
@@ -134,7 +140,9 @@ void Keyboard::tweet() {
 */
 void Keyboard::respond() {
     //std::cout << tweetid << std::endl;
-    TwitterApp::getInstance()->getTwitter()->reply(ausgabe, tweetid);
+    std::string text = ausgabe;
+    std::string id = tweetid;
+    TwitterApp::getInstance()->getTwitter()->request(Twitter::USER_ACTION, "", [text, id](Twitter* pTwitter) { return pTwitter->reply(text, id); }, Twitter::Callback());
     TwitterApp::getInstance()->wallContentArea->updateNewsFeed(false);
     abort();
 }
@@ -172,10 +180,9 @@ void Keyboard::write(const char key) {
         //-------------------------------------
         //WordCompletion
         if (key == ' ') {
+            trie->learn(previousWord(), tempWord);
             tempWord = "";
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            showWordComp(); // predict next word
         }
         else {
             tempWord += key;
@@ -276,10 +283,11 @@ void Keyboard::write2(char key) {
 void Keyboard::write3(std::string key){
     if (ausgabe.length()<140) {
         if (key == " ") {
+            trie->learn(previousWord(), tempWord);
             tempWord = "";
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            if (useWordComp) {
+                showWordComp(); // predict next word
+            }
         }
         else {
             tempWord += key;
@@ -576,17 +584,27 @@ Todo
 
 /**
 * Functions sets 3 Words of the Trie wordcomplition
-* to the Word Bricks
+* to the Word Bricks. Words which followed the previous word come first
 */
 void Keyboard::showWordComp() {
 
-    v = trie.autocomplete(tempWord);
+    v = trie->predict(previousWord(), tempWord, WORD_COMP_COUNT);
 
     if (v.size() >= 3) {
         Wcount = 3;
     }
 
-    if (v.size() == 1) {
+    if (v.empty()) {
+
+        eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
+        eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
+        eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+
+        word1 = "";
+        word2 = "";
+        word3 = "";
+    }
+    else if (v.size() == 1) {
 
         v[0] = replaceChar2(v[0]);
         eyegui::setContentOfTextBlock(pLayout2, "Word1", v[0]);
@@ -625,6 +643,27 @@ void Keyboard::showWordComp() {
     }
 }
 
+/**
+* Function returns the word before the one currently typed
+* Empty at start of text
+*/
+std::string Keyboard::previousWord() {
+    std::string text = ausgabe.substr(0, currentCursorPos);
+    text.erase(std::remove(text.begin(), text.end(), '\n'), text.end()); // line breaks are only inserted for display
+    if (!tempWord.empty()) {
+        // Word being typed may miss its latest letter in text yet, so cut at last space instead of comparing
+        size_t space = text.find_last_of(' ');
+        text.erase(space == std::string::npos ? 0 : space + 1);
+    }
+    size_t end = text.find_last_not_of(' ');
+    if (end == std::string::npos) {
+        return "";
+    }
+    size_t start = text.find_last_of(' ', end);
+    start = (start == std::string::npos) ? 0 : start + 1;
+    return text.substr(start, end - start + 1);
+}
+
 /**
 * Function which replaces chars in a string
 * To be replaced Chars are all chars not incuded in the EyeGui
@@ -863,6 +902,7 @@ void Keyboard::writeWordComp(int Wordcase){
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
+        tempWord = ""; // chosen word replaces typed one, also when learned
 
         for (char& c : word1) {
             //write2(c);
@@ -880,6 +920,7 @@ void Keyboard::writeWordComp(int Wordcase){
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
+        tempWord = "";
         for (char& c : word2) {
 
             string s(1, c);
@@ -896,6 +937,7 @@ void Keyboard::writeWordComp(int Wordcase){
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
+        tempWord = "";
         for (char& c : word3) {
 
             string s(1, c);
@@ -908,6 +950,7 @@ void Keyboard::writeWordComp(int Wordcase){
         word3 = "";
     }
     useWordComp = true;
+    showWordComp(); // predict next word
 }
 
 //----------------------------------------------------------------------------------
@@ -938,16 +981,14 @@ void Keyboard::addClipboardtoOut() {
 * Function adds ausgabe as a new line to the Dictionary
 */
 void Keyboard::addLinetoDict() {
-    trie.addLinetoDict(dict,ausgabe);
+    trie->addUserWord(ausgabe);
 }
 
 /**
 * Function deletes ausgabe line from the Dictionary, if posssible
 */
 void Keyboard::deleteLineinDict() {
-    trie.deleteLineinDict(dict, ausgabe);
-    trie = Trie("");
-    trie.loadDict(dict);
+    trie->deleteUserWord(ausgabe);
 
     ausgabe = "";
     currentCursorPos = 0;
@@ -987,21 +1028,10 @@ void Keyboard::clearInput() {
 * @param[in] Language integer for the different cases
 */
 void Keyboard::changeDict(int lang) {
-    if (lang == 0) {
-        dict = "../src/Keyboard/eng.txt";
-    }
-    if (lang == 1) {
-        dict = "../src/Keyboard/ger.txt";
+    if (lang >= 0 && (size_t)lang < sizeof(dicts) / sizeof(dicts[0])) {
+        dict = CONTENT_PATH + std::string("/dict/") + dicts[lang];
     }
-    if (lang == 2) {
-        dict = "../src/Keyboard/french.txt";
-    }
-    if (lang == 3) {
-        dict = "../src/Keyboard/dutch.txt";
-    }
-
-    trie = Trie("");
-    trie.loadDict(dict);
+    trie = &tries[dict];
 
     tempWord = " ";
     word1 = "";
@@ -1012,7 +1042,7 @@ void Keyboard::changeDict(int lang) {
     eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
     eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
 
-    v = trie.autocomplete(tempWord);
+    v = trie->autocomplete(tempWord, WORD_COMP_COUNT);
 
     // Bug: has some problems with the first char after loading new Dictionary
     // so we write one char and delete it
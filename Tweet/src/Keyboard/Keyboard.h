@@ -7,6 +7,7 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include "src/Buttons/KeyboardButton.h"
 #include "externals/Trie/trie.h"
+#include <map>
 #include <vector>
 #include <iostream>
 
@@ -67,6 +68,7 @@ public:
     //WordCompletion
     //Default Constructur for Wordcompletion trie-tree
     void showWordComp();
+    std::string previousWord();
     void WordmoveRight();
     void WordmoveLeft();
     void writeWordComp(int);
@@ -79,7 +81,8 @@ public:
     int Wcount;
     std::string  tempWord, word1, word2, word3,dict;
     std::vector<std::string> v;
-    Trie trie = Trie("");
+    std::map<std::string, Trie> tries; // by dictionary, all languages are loaded at init
+    Trie* trie = NULL; // of current dictionary
 
     // Test login
     void setPLayout(eyegui::Layout* newLayout) { this->pLayout = newLayout; }
@@ -91,6 +94,8 @@ private:
     float PosX = 0.0f;
     float PosY = 0.3f;
     float speed = 1.0f;
+    static const size_t WORD_COMP_COUNT = 30; // words offered by Wordcompletion, best first
+    static const std::string dicts[]; // dictionary files, index is language
     bool isUpper = true;
     static Keyboard* instance;
     eyegui::Layout* pLayout;
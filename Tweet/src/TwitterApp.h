@@ -66,8 +66,8 @@ public:
 
     // Login Test
     eyegui::Layout* pLayout;
-    Twitter* twitter;
-    Twitter* null;
+    Twitter* twitter = NULL;
+    Twitter* null = NULL;
     twitCurl account;
     twitCurl account2;
     Keyboard* keyboard;
@@ -4,6 +4,45 @@
 
 #include "ImageDownload.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Cache of downloaded images, relative to CONTENT_PATH. Kept between runs
+    const std::string IMAGE_CACHE_FOLDER = "img/cache";
+    const std::chrono::hours IMAGE_CACHE_EXPIRY = std::chrono::hours(24 * 7);
+    const std::uintmax_t IMAGE_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+    const unsigned int IMAGE_DOWNLOAD_WORKERS = 3;
+    const long IMAGE_DOWNLOAD_CONNECT_TIMEOUT = 10; // seconds
+    const long IMAGE_DOWNLOAD_TIMEOUT = 60; // seconds
+    const long IMAGE_DOWNLOAD_LOW_SPEED_LIMIT = 512; // bytes per second, transfer is aborted when slower...
+    const long IMAGE_DOWNLOAD_LOW_SPEED_TIME = 15; // ...for this many seconds
+    const unsigned int IMAGE_CACHE_TRIM_INTERVAL = 64; // downloads between trimming of cache
+
+    // Shared with workers
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::string> pendingUrls;
+    std::map<std::string, std::vector<std::function<void(std::string)> > > requests; // callbacks by url being downloaded
+    std::vector<std::pair<std::string, std::string> > finished; // url and filename, empty if failed
+    std::vector<std::thread> workers; // started with first download
+    bool stop = false;
+    unsigned int downloadsUntilTrim = 0; // cache is trimmed by worker reaching zero, so also once at start
+    std::atomic<bool> abortTransfers(false); // read by curl without lock, so running downloads end at stop
+
+    // Latest url requested for each picture element, only used by thread using eyeGUI
+    std::map<std::pair<eyegui::Layout*, std::string>, std::string> shownUrls;
+}
+
 /**
 * Removes folder and containing files.
 * @param[in] path
@@ -41,31 +80,271 @@ size_t write_data(void *ptr, size_t size, size_t nmemb, FILE *stream)
 }
 
 /**
-* download_image function
+* Returns filename of image in cache relative to CONTENT_PATH, named by hash of 'url' and its file extension.
 * @param[in] url
-* @param[in] outfilename[FILENAME_MAX]
 */
-void download_image(char* url, char outfilename[FILENAME_MAX]) {
-    // If folder does not exist, create it
-    if (!fs::exists(outfilename)) {
-        std::string str(outfilename);
-        str = extract_file_path(str);
-        fs::create_directories(str);
-    }
-
-    CURL *curl;
-    FILE *fp;
-    CURLcode res;
-    curl = curl_easy_init();
-    if (curl)
-    {
-        fp = fopen(outfilename, "wb");
-        curl_easy_setopt(curl, CURLOPT_URL, url);
+static std::string cache_filename(const std::string& url)
+{
+    // FNV-1a hash of url
+    unsigned long long hash = 14695981039346656037ull;
+    for (char c : url) {
+        hash ^= (unsigned char)c;
+        hash *= 1099511628211ull;
+    }
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", hash);
+
+    // Keep extension, if there is one after last slash. Query and fragment are not part of it
+    std::string path = url.substr(0, url.find_first_of("?#"));
+    std::string ext;
+    size_t dot = path.rfind('.');
+    size_t slash = path.rfind('/');
+    if (dot != std::string::npos && (slash == std::string::npos || dot > slash)) {
+        ext = path.substr(dot);
+    }
+    return IMAGE_CACHE_FOLDER + "/" + name + ext;
+}
+
+/**
+* Returns whether file at 'path' exists and has not expired.
+* @param[in] path
+*/
+static bool is_fresh(const std::string& path)
+{
+    std::error_code error;
+    auto time = fs::last_write_time(path, error);
+    return !error && (fs::file_time_type::clock::now() - time) < IMAGE_CACHE_EXPIRY;
+}
+
+/**
+* Progress callback of curl, which aborts the transfer when downloads are stopped.
+* @param[out] int non-zero to abort
+*/
+static int abort_transfer(void*, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+{
+    return abortTransfers ? 1 : 0;
+}
+
+/**
+* Downloads 'url' to 'path' using 'curl', which keeps connections open for the next download.
+* The file only appears after complete download.
+* @param[in] curl
+* @param[in] url
+* @param[in] path
+* @param[out] bool whether successful
+*/
+static bool download_to_file(CURL *curl, const std::string& url, const std::string& path)
+{
+    std::error_code error;
+    fs::create_directories(extract_file_path(path), error);
+
+    std::string temporaryPath = path + ".tmp";
+    FILE *fp = fopen(temporaryPath.c_str(), "wb");
+    if (fp == NULL) {
+        return false;
+    }
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
+    CURLcode res = curl_easy_perform(curl);
+    long responseCode = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+    bool success = (fclose(fp) == 0) && (res == CURLE_OK) && (responseCode == 200);
+
+    if (success) {
+        std::remove(path.c_str()); // rename does not replace existing files on every platform
+        success = (std::rename(temporaryPath.c_str(), path.c_str()) == 0);
+    }
+    if (!success) {
+        std::remove(temporaryPath.c_str());
+    }
+    return success;
+}
+
+/**
+* Removes expired files from cache, then oldest ones until cache fits its size limit.
+*/
+static void trim_cache()
+{
+    std::error_code error;
+    std::vector<std::pair<fs::file_time_type, fs::path> > files;
+    std::uintmax_t size = 0;
+    for (fs::directory_iterator it(CONTENT_PATH + std::string("/") + IMAGE_CACHE_FOLDER, error), end; !error && it != end; it.increment(error)) {
+        fs::path path = it->path();
+        auto time = fs::last_write_time(path, error);
+        if (error || (fs::file_time_type::clock::now() - time) >= IMAGE_CACHE_EXPIRY) {
+            fs::remove(path, error);
+            error.clear();
+            continue;
+        }
+        size += fs::file_size(path, error);
+        files.push_back(std::make_pair(time, path));
+        error.clear();
+    }
+
+    std::sort(files.begin(), files.end());
+    for (auto& file : files) {
+        if (size <= IMAGE_CACHE_MAX_SIZE) {
+            break;
+        }
+        size -= fs::file_size(file.second, error);
+        fs::remove(file.second, error);
+    }
+}
+
+/**
+* Loop of download worker thread.
+*/
+static void work()
+{
+    CURL *curl = curl_easy_init();
+    if (curl) {
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_data);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
-        curl_easy_setopt(curl, CURLOPT_VERBOSE, 1L);
-        res = curl_easy_perform(curl);
+        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, IMAGE_DOWNLOAD_CONNECT_TIMEOUT);
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, IMAGE_DOWNLOAD_TIMEOUT);
+        curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, IMAGE_DOWNLOAD_LOW_SPEED_LIMIT);
+        curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, IMAGE_DOWNLOAD_LOW_SPEED_TIME);
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, abort_transfer);
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // timeouts must not use signals in threads
+    }
+
+    while (true) {
+        // Trim cache at start and every few downloads, so it neither grows in long sessions nor after crashes
+        bool trim = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (downloadsUntilTrim == 0) {
+                downloadsUntilTrim = IMAGE_CACHE_TRIM_INTERVAL;
+                trim = true;
+            }
+        }
+        if (trim) {
+            trim_cache();
+        }
+
+        // Wait for url
+        std::string url;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, []() { return stop || !pendingUrls.empty(); });
+            if (stop) {
+                break;
+            }
+            url = pendingUrls.front();
+            pendingUrls.pop_front();
+        }
+
+        // Download unless cached meanwhile
+        std::string filename = cache_filename(url);
+        std::string path = CONTENT_PATH + std::string("/") + filename;
+        bool success = is_fresh(path) || (curl && download_to_file(curl, url, path));
+
+        // Callbacks are called by thread using eyeGUI
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.push_back(std::make_pair(url, success ? filename : std::string()));
+        if (downloadsUntilTrim > 0) {
+            downloadsUntilTrim--;
+        }
+    }
+
+    if (curl) {
         curl_easy_cleanup(curl);
-        fclose(fp);
     }
 }
+
+/**
+* request_image function
+* @param[in] url
+* @param[in] callback
+*/
+void request_image(std::string url, std::function<void(std::string)> callback) {
+    std::string filename = cache_filename(url);
+    if (is_fresh(CONTENT_PATH + std::string("/") + filename)) {
+        callback(filename);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stop) {
+        return;
+    }
+
+    // Only first request of url is downloaded, others wait for it
+    std::vector<std::function<void(std::string)> >& callbacks = requests[url];
+    callbacks.push_back(callback);
+    if (callbacks.size() == 1) {
+        pendingUrls.push_back(url);
+        if (workers.empty()) {
+            for (unsigned int i = 0; i < IMAGE_DOWNLOAD_WORKERS; i++) {
+                workers.push_back(std::thread(work));
+            }
+        }
+        condition.notify_one();
+    }
+}
+
+/**
+* show_image function
+* @param[in] pLayout
+* @param[in] id
+* @param[in] url
+* @param[in] placeholder
+*/
+void show_image(eyegui::Layout* pLayout, std::string id, std::string url, std::string placeholder) {
+    std::pair<eyegui::Layout*, std::string> element = std::make_pair(pLayout, id);
+    shownUrls[element] = url;
+
+    // Cached images are shown at once, others after download
+    std::string filename = cache_filename(url);
+    if (!is_fresh(CONTENT_PATH + std::string("/") + filename)) {
+        eyegui::replaceElementWithPicture(pLayout, id, placeholder, eyegui::ImageAlignment::ORIGINAL, false);
+    }
+    request_image(url, [element, url](std::string filename) {
+        if (!filename.empty() && shownUrls[element] == url) {
+            eyegui::replaceElementWithPicture(element.first, element.second, filename, eyegui::ImageAlignment::ORIGINAL, false);
+        }
+    });
+}
+
+/**
+* poll_image_downloads function
+*/
+void poll_image_downloads() {
+    // Collect callbacks of finished downloads, call them without lock as they may request further images
+    std::vector<std::pair<std::vector<std::function<void(std::string)> >, std::string> > calls;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& download : finished) {
+            calls.push_back(std::make_pair(std::move(requests[download.first]), download.second));
+            requests.erase(download.first);
+        }
+        finished.clear();
+    }
+    for (auto& call : calls) {
+        for (auto& callback : call.first) {
+            callback(call.second);
+        }
+    }
+}
+
+/**
+* stop_image_downloads function
+*/
+void stop_image_downloads() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+        abortTransfers = true;
+        pendingUrls.clear();
+        requests.clear();
+        finished.clear();
+    }
+    condition.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    shownUrls.clear();
+    trim_cache();
+}
@@ -4,8 +4,11 @@
 
 // Image download is based on libcurl
 #include "externals/twitCurl/twitcurl.h"
+#include "externals/eyeGUI-development/include/eyeGUI.h"
 
 #include <experimental/filesystem>
+#include <functional>
+#include <string>
 
 namespace fs = std::experimental::filesystem;
 
@@ -16,8 +19,31 @@ namespace fs = std::experimental::filesystem;
 void remove_folder(std::string path);
 
 /**
-* Downloads the image specified in 'url' to the location specified in 'outfilename'.
+* Requests the image at 'url'. Images not in the cache or expired there are downloaded by worker threads,
+* requests for an url already being downloaded are merged.
+* 'callback' receives the filename of the image relative to CONTENT_PATH, or an empty string if the download failed.
+* It is called at once for cached images and by 'poll_image_downloads' otherwise.
 * @param[in] url
-* @param[in] outfilename[FILENAME_MAX]
+* @param[in] callback
 */
-void download_image(char* url, char outfilename[FILENAME_MAX]);
+void request_image(std::string url, std::function<void(std::string)> callback);
+
+/**
+* Shows the image at 'url' in the picture element with 'id'. Until the image is downloaded, 'placeholder' is shown.
+* A download finishing after another image has been requested for the same element is not shown.
+* @param[in] pLayout
+* @param[in] id
+* @param[in] url
+* @param[in] placeholder
+*/
+void show_image(eyegui::Layout* pLayout, std::string id, std::string url, std::string placeholder);
+
+/**
+* Calls callbacks of finished downloads. Must be called once per frame by the thread using eyeGUI.
+*/
+void poll_image_downloads();
+
+/**
+* Stops download workers, aborting running downloads, drops callbacks not yet called and trims cache to its size limit.
+*/
+void stop_image_downloads();
@@ -0,0 +1,375 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "TweetStore.h"
+#include "externals/twitCurl/include/rapidjson/writer.h"
+#include "externals/twitCurl/include/rapidjson/stringbuffer.h"
+#include <algorithm>
+#include <cstdio>
+#include <experimental/filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    const int STORE_FILE_VERSION = 1;
+    const unsigned int STORE_MAX_TWEETS = 800;
+    const unsigned int TIMELINE_PAGE_SIZE = 20; // default count of tweets per timeline request
+}
+
+/**
+* Returns whether tweet id 'a' is newer than 'b'. Ids grow with time but exceed the range of double, so compare them as strings.
+* @param[in] a
+* @param[in] b
+*/
+static bool is_newer(const std::string& a, const std::string& b)
+{
+    if (a.size() != b.size()) {
+        return a.size() > b.size();
+    }
+    return a > b;
+}
+
+/**
+* Returns string member 'name' of 'rValue', or empty string if missing.
+* @param[in] rValue
+* @param[in] name
+*/
+static std::string get_string(const rapidjson::Value& rValue, const char* name)
+{
+    if (rValue.IsObject() && rValue.HasMember(name) && rValue[name].IsString()) {
+        return std::string(rValue[name].GetString(), rValue[name].GetStringLength());
+    }
+    return "";
+}
+
+/**
+* Returns integer member 'name' of 'rValue', or zero if missing.
+* @param[in] rValue
+* @param[in] name
+*/
+static int get_int(const rapidjson::Value& rValue, const char* name)
+{
+    if (rValue.IsObject() && rValue.HasMember(name) && rValue[name].IsInt()) {
+        return rValue[name].GetInt();
+    }
+    return 0;
+}
+
+/**
+* Returns boolean member 'name' of 'rValue', or false if missing.
+* @param[in] rValue
+* @param[in] name
+*/
+static bool get_bool(const rapidjson::Value& rValue, const char* name)
+{
+    return rValue.IsObject() && rValue.HasMember(name) && rValue[name].IsBool() && rValue[name].GetBool();
+}
+
+/**
+* Writes 'str' with 'rWriter'.
+* @param[in] rWriter
+* @param[in] str
+*/
+static void write_string(rapidjson::Writer<rapidjson::StringBuffer>& rWriter, const std::string& str)
+{
+    rWriter.String(str.c_str(), (rapidjson::SizeType)str.size());
+}
+
+/**
+* Constructor for the TweetStore Class. Store is empty until loaded.
+* @param[in] filepath of file the store is kept in
+*/
+TweetStore::TweetStore(std::string filepath) {
+    mFilepath = filepath;
+}
+
+/**
+* Loads store from its file, replacing current content.
+* @param[out] bool whether the file existed and was valid
+*/
+bool TweetStore::load() {
+    std::ifstream in(mFilepath.c_str(), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    rapidjson::Document document;
+    document.Parse(buffer.str().c_str());
+    if (document.HasParseError() || !document.IsObject()
+        || get_int(document, "version") != STORE_FILE_VERSION
+        || !document.HasMember("users") || !document["users"].IsArray()
+        || !document.HasMember("tweets") || !document["tweets"].IsArray()) {
+        return false;
+    }
+
+    // Read everything first, so an invalid file leaves the store untouched
+    std::vector<StoredUser> users;
+    std::map<std::string, unsigned int> userIndices;
+    const rapidjson::Value& rUsers = document["users"];
+    for (rapidjson::SizeType i = 0; i < rUsers.Size(); i++) {
+        const rapidjson::Value& rUser = rUsers[i];
+        StoredUser user;
+        user.id = get_string(rUser, "id");
+        user.name = get_string(rUser, "name");
+        user.profileImageUrl = get_string(rUser, "image");
+        userIndices[user.id] = (unsigned int)users.size();
+        users.push_back(user);
+    }
+    std::vector<StoredTweet> tweets;
+    const rapidjson::Value& rTweets = document["tweets"];
+    for (rapidjson::SizeType i = 0; i < rTweets.Size(); i++) {
+        const rapidjson::Value& rTweet = rTweets[i];
+        StoredTweet tweet;
+        tweet.id = get_string(rTweet, "id");
+        tweet.user = (unsigned int)get_int(rTweet, "user");
+        if (tweet.id.empty() || tweet.user >= users.size()) {
+            return false;
+        }
+        tweet.text = get_string(rTweet, "text");
+        tweet.favoriteCount = get_int(rTweet, "likes");
+        tweet.retweetCount = get_int(rTweet, "retweets");
+        tweet.favorited = get_bool(rTweet, "favorited");
+        tweet.retweeted = get_bool(rTweet, "retweeted");
+        if (rTweet.HasMember("media") && rTweet["media"].IsArray()) {
+            for (rapidjson::SizeType j = 0; j < rTweet["media"].Size(); j++) {
+                if (rTweet["media"][j].IsString()) {
+                    tweet.mediaUrls.push_back(rTweet["media"][j].GetString());
+                }
+            }
+        }
+        tweets.push_back(tweet);
+    }
+
+    mUsers = std::move(users);
+    mUserIndices = std::move(userIndices);
+    mTweets = std::move(tweets);
+    return true;
+}
+
+/**
+* Saves store to its file. The file is written to a temporary file first, so an interrupted save keeps the previous one.
+* @param[out] bool whether successful
+*/
+bool TweetStore::save() const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("version");
+    writer.Int(STORE_FILE_VERSION);
+    writer.Key("users");
+    writer.StartArray();
+    for (const StoredUser& rUser : mUsers) {
+        writer.StartObject();
+        writer.Key("id");
+        write_string(writer, rUser.id);
+        writer.Key("name");
+        write_string(writer, rUser.name);
+        writer.Key("image");
+        write_string(writer, rUser.profileImageUrl);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("tweets");
+    writer.StartArray();
+    for (const StoredTweet& rTweet : mTweets) {
+        writer.StartObject();
+        writer.Key("id");
+        write_string(writer, rTweet.id);
+        writer.Key("user");
+        writer.Uint(rTweet.user);
+        writer.Key("text");
+        write_string(writer, rTweet.text);
+        writer.Key("likes");
+        writer.Int(rTweet.favoriteCount);
+        writer.Key("retweets");
+        writer.Int(rTweet.retweetCount);
+        writer.Key("favorited");
+        writer.Bool(rTweet.favorited);
+        writer.Key("retweeted");
+        writer.Bool(rTweet.retweeted);
+        writer.Key("media");
+        writer.StartArray();
+        for (const std::string& rUrl : rTweet.mediaUrls) {
+            write_string(writer, rUrl);
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    std::error_code error;
+    std::experimental::filesystem::create_directories(std::experimental::filesystem::path(mFilepath).parent_path(), error);
+    std::string temporaryFilepath = mFilepath + ".tmp";
+    {
+        std::ofstream out(temporaryFilepath.c_str(), std::ios::binary);
+        if (!out) {
+            return false;
+        }
+        out.write(buffer.GetString(), buffer.GetSize());
+        if (!out) {
+            out.close();
+            std::remove(temporaryFilepath.c_str());
+            return false;
+        }
+    }
+    std::remove(mFilepath.c_str()); // rename does not replace existing files on every platform
+    return std::rename(temporaryFilepath.c_str(), mFilepath.c_str()) == 0;
+}
+
+/**
+* Merges tweets of a timeline response into the store.
+* Received tweets replace stored ones from the oldest received on, so changed counts are updated and deleted tweets disappear.
+* @param[in] rTweets array of tweets as returned by Twitter, other values are ignored
+* @param[in] incremental whether the tweets were requested since the newest stored one. A full page then means tweets
+*            in between may be missing, so older stored tweets are dropped.
+*/
+void TweetStore::merge(const rapidjson::Value& rTweets, bool incremental) {
+    if (!rTweets.IsArray()) {
+        return;
+    }
+    std::vector<StoredTweet> received;
+    for (rapidjson::SizeType i = 0; i < rTweets.Size(); i++) {
+        StoredTweet tweet;
+        if (parseTweet(rTweets[i], tweet)) {
+            received.push_back(tweet);
+        }
+    }
+    if (received.empty()) {
+        return;
+    }
+    std::sort(received.begin(), received.end(), [](const StoredTweet& a, const StoredTweet& b) { return is_newer(a.id, b.id); });
+
+    if (incremental && rTweets.Size() >= TIMELINE_PAGE_SIZE) {
+        mTweets.clear();
+    }
+    else {
+        const std::string oldest = received.back().id;
+        mTweets.erase(std::remove_if(mTweets.begin(), mTweets.end(), [&oldest](const StoredTweet& rTweet) { return !is_newer(oldest, rTweet.id); }), mTweets.end());
+    }
+
+    // All remaining stored tweets are older than received ones
+    mTweets.insert(mTweets.begin(), received.begin(), received.end());
+    if (mTweets.size() > STORE_MAX_TWEETS) {
+        mTweets.resize(STORE_MAX_TWEETS);
+    }
+    compact();
+}
+
+/**
+* Returns count of tweets in store.
+* @param[out] unsigned int
+*/
+unsigned int TweetStore::size() const {
+    return (unsigned int)mTweets.size();
+}
+
+/**
+* Returns tweet at index 'i', newest tweet first.
+* @param[in] i must be smaller than size
+* @param[out] StoredTweet
+*/
+const StoredTweet& TweetStore::at(unsigned int i) const {
+    return mTweets[i];
+}
+
+/**
+* Returns author of 'rTweet'.
+* @param[in] rTweet from this store
+* @param[out] StoredUser
+*/
+const StoredUser& TweetStore::userOf(const StoredTweet& rTweet) const {
+    return mUsers[rTweet.user];
+}
+
+/**
+* Returns id of newest tweet to request newer ones with, or empty string if store is empty.
+* @param[out] string
+*/
+std::string TweetStore::newestId() const {
+    return mTweets.empty() ? "" : mTweets.front().id;
+}
+
+/**
+* Parses tweet as returned by Twitter.
+* @param[in] rTweet
+* @param[out] rStored
+* @param[out] bool whether it was a valid tweet
+*/
+bool TweetStore::parseTweet(const rapidjson::Value& rTweet, StoredTweet& rStored) {
+    rStored.id = get_string(rTweet, "id_str");
+    if (rStored.id.empty() || !rTweet.HasMember("user") || !rTweet["user"].IsObject()) {
+        return false;
+    }
+    rStored.user = addUser(rTweet["user"]);
+    rStored.text = get_string(rTweet, "text");
+
+    // Likes of retweets belong to the retweeted tweet
+    if (rTweet.HasMember("retweeted_status") && rTweet["retweeted_status"].IsObject()) {
+        rStored.favoriteCount = get_int(rTweet["retweeted_status"], "favorite_count");
+    }
+    else {
+        rStored.favoriteCount = get_int(rTweet, "favorite_count");
+    }
+    rStored.retweetCount = get_int(rTweet, "retweet_count");
+    rStored.favorited = get_bool(rTweet, "favorited");
+    rStored.retweeted = get_bool(rTweet, "retweeted");
+
+    // Tweets with media list all of them in extended entities
+    if (rTweet.HasMember("entities") && rTweet["entities"].IsObject() && rTweet["entities"].HasMember("media")
+        && rTweet.HasMember("extended_entities") && rTweet["extended_entities"].IsObject()
+        && rTweet["extended_entities"].HasMember("media") && rTweet["extended_entities"]["media"].IsArray()) {
+        const rapidjson::Value& rMedia = rTweet["extended_entities"]["media"];
+        for (rapidjson::SizeType i = 0; i < rMedia.Size(); i++) {
+            std::string url = get_string(rMedia[i], "media_url");
+            if (!url.empty()) {
+                rStored.mediaUrls.push_back(url);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+* Adds user as returned by Twitter or updates it, if already in store.
+* @param[in] rUser
+* @param[out] unsigned int index of user
+*/
+unsigned int TweetStore::addUser(const rapidjson::Value& rUser) {
+    StoredUser user;
+    user.id = get_string(rUser, "id_str");
+    user.name = get_string(rUser, "name");
+    user.profileImageUrl = get_string(rUser, "profile_image_url");
+
+    auto it = mUserIndices.find(user.id);
+    if (it != mUserIndices.end()) {
+        mUsers[it->second] = user;
+        return it->second;
+    }
+    unsigned int index = (unsigned int)mUsers.size();
+    mUsers.push_back(user);
+    mUserIndices[user.id] = index;
+    return index;
+}
+
+/**
+* Removes users no tweet refers to anymore.
+*/
+void TweetStore::compact() {
+    std::vector<StoredUser> users;
+    std::map<std::string, unsigned int> userIndices;
+    for (StoredTweet& rTweet : mTweets) {
+        const StoredUser& rUser = mUsers[rTweet.user];
+        auto it = userIndices.find(rUser.id);
+        if (it == userIndices.end()) {
+            it = userIndices.insert(std::make_pair(rUser.id, (unsigned int)users.size())).first;
+            users.push_back(rUser);
+        }
+        rTweet.user = it->second;
+    }
+    mUsers = std::move(users);
+    mUserIndices = std::move(userIndices);
+}
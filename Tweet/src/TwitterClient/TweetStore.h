@@ -0,0 +1,61 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+// Local store of a timeline. API responses are parsed once into compact records, which pages read by index.
+// The store is kept on disk, so a timeline shows up at once after start and only newer tweets are downloaded.
+
+#pragma once
+
+#include "externals/twitCurl/include/rapidjson/document.h"
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+* User as referred to by tweets in the store.
+*/
+struct StoredUser {
+    std::string id;
+    std::string name;
+    std::string profileImageUrl;
+};
+
+/**
+* Tweet in the store. Counts of retweets are taken from the retweeted tweet.
+*/
+struct StoredTweet {
+    std::string id;
+    unsigned int user; // index of user in store
+    std::string text;
+    int favoriteCount;
+    int retweetCount;
+    bool favorited;
+    bool retweeted;
+    std::vector<std::string> mediaUrls;
+};
+
+class TweetStore {
+
+public:
+
+    TweetStore(std::string filepath);
+    bool load();
+    bool save() const;
+    void merge(const rapidjson::Value& rTweets, bool incremental);
+    unsigned int size() const;
+    const StoredTweet& at(unsigned int i) const;
+    const StoredUser& userOf(const StoredTweet& rTweet) const;
+    std::string newestId() const;
+
+private:
+
+    bool parseTweet(const rapidjson::Value& rTweet, StoredTweet& rStored);
+    unsigned int addUser(const rapidjson::Value& rUser);
+    void compact();
+
+    std::string mFilepath;
+    std::vector<StoredTweet> mTweets; // newest first
+    std::vector<StoredUser> mUsers;
+    std::map<std::string, unsigned int> mUserIndices; // index of user by id
+};
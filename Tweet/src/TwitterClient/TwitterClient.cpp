@@ -5,6 +5,11 @@
 #include "src/TwitterClient/TwitterClient.h"
 #include "externals/twitCurl/include/rapidjson/document.h"
 #include "externals/twitCurl/include/rapidjson/writer.h"
+#include <algorithm>
+
+// Error code of Twitter API when rate limit is exceeded, and length of its window
+const int RATE_LIMIT_EXCEEDED = 88;
+const std::chrono::minutes RATE_LIMIT_WINDOW(15);
 
 /**
 * Constructor for the Twitter Class
@@ -35,6 +40,14 @@ Twitter::Twitter(twitCurl* pAccount, std::string name, std::string passwort, boo
     mpAccount->oAuthAccessToken();
 }
 
+/**
+* Destructor for the Twitter Class
+* stops worker thread
+*/
+Twitter::~Twitter() {
+    stopRequests();
+}
+
 //JSON ----------------------------------------------------------------------------------------------------------
 
 /**
@@ -66,6 +79,9 @@ rapidjson::Document Twitter::toJSON(std::string string) {
             std::cout << "Error(s) in API call:" << std::endl;
             for (rapidjson::SizeType i = 0; i < jObj["errors"].Size(); i++) {
                 std::cout << jObj["errors"][i]["message"].GetString() << " (Code: " << jObj["errors"][i]["code"].GetInt() << ")" << std::endl;
+                if (jObj["errors"][i]["code"].GetInt() == RATE_LIMIT_EXCEEDED) {
+                    mRateLimitReset = std::chrono::steady_clock::now() + RATE_LIMIT_WINDOW;
+                }
             }
             return NULL;
         }
@@ -74,6 +90,154 @@ rapidjson::Document Twitter::toJSON(std::string string) {
     return jObj;
 }
 
+// ASYNCHRONOUS ----------------------------------------------------------------------------------------------------------
+
+/**
+* Queues a request for the worker thread.
+* Reads with the same key which are not started yet are merged, so the request is only sent once.
+* Refreshing requests wait for user actions and for the rate limit window to pass, if the limit was exceeded.
+*
+* @param[in] priority - USER_ACTION for actions of the user, REFRESH for updates nobody waits for
+* @param[in] key - identifies what is read, i.e. "timelineHome". Empty for requests which change something
+* @param[in] call - the blocking method to execute, i.e. [](Twitter* pTwitter) { return pTwitter->getTimelineHome(""); }
+* @param[in] callback - receives the result when polled, may be empty
+**/
+void Twitter::request(Priority priority, std::string key, Call call, Callback callback) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mStop) {
+        return;
+    }
+
+    // Merge with equal read
+    if (!key.empty()) {
+        auto it = mQueuedReads.find(key);
+        if (it != mQueuedReads.end()) {
+            std::shared_ptr<Request> spRequest = it->second;
+            if (callback) {
+                spRequest->callbacks.push_back(callback);
+            }
+
+            // Move refreshing read forward if user waits for it now
+            std::deque<std::shared_ptr<Request> >& rRefreshQueue = mQueues[REFRESH];
+            auto queued = std::find(rRefreshQueue.begin(), rRefreshQueue.end(), spRequest);
+            if (priority == USER_ACTION && queued != rRefreshQueue.end()) {
+                rRefreshQueue.erase(queued);
+                mQueues[USER_ACTION].push_back(spRequest);
+                mCondition.notify_one();
+            }
+            return;
+        }
+    }
+    else {
+        // Reads after a change must not get the result of reads before it
+        mQueuedReads.clear();
+    }
+
+    std::shared_ptr<Request> spRequest = std::make_shared<Request>();
+    spRequest->key = key;
+    spRequest->call = call;
+    if (callback) {
+        spRequest->callbacks.push_back(callback);
+    }
+    mQueues[priority].push_back(spRequest);
+    if (!key.empty()) {
+        mQueuedReads[key] = spRequest;
+    }
+
+    if (!mWorker.joinable()) {
+        mWorker = std::thread(&Twitter::work, this);
+    }
+    mCondition.notify_one();
+}
+
+/**
+* Calls callbacks of finished requests. Called once per frame by the main loop.
+**/
+void Twitter::pollRequests() {
+    std::vector<std::shared_ptr<Request> > finished;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        finished.swap(mFinished);
+    }
+
+    for (std::shared_ptr<Request>& rspRequest : finished) {
+        // Merged reads get a copy each, last one gets the result itself
+        for (size_t i = 0; i < rspRequest->callbacks.size(); i++) {
+            if (i + 1 < rspRequest->callbacks.size()) {
+                rapidjson::Document copy;
+                copy.CopyFrom(rspRequest->result, copy.GetAllocator());
+                rspRequest->callbacks[i](copy);
+            }
+            else {
+                rspRequest->callbacks[i](rspRequest->result);
+            }
+        }
+    }
+}
+
+/**
+* Stops worker thread after current request. Queued requests and their callbacks are dropped.
+**/
+void Twitter::stopRequests() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+        mQueues[USER_ACTION].clear();
+        mQueues[REFRESH].clear();
+        mQueuedReads.clear();
+        mFinished.clear();
+    }
+    mCondition.notify_all();
+    if (mWorker.joinable()) {
+        mWorker.join();
+    }
+}
+
+/**
+* Loop of worker thread
+**/
+void Twitter::work() {
+    while (true) {
+        // Take user actions first, refreshing only outside of exceeded rate limit
+        std::shared_ptr<Request> spRequest;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (!spRequest) {
+                if (mStop) {
+                    return;
+                }
+                if (!mQueues[USER_ACTION].empty()) {
+                    spRequest = mQueues[USER_ACTION].front();
+                    mQueues[USER_ACTION].pop_front();
+                }
+                else if (!mQueues[REFRESH].empty() && std::chrono::steady_clock::now() >= mRateLimitReset) {
+                    spRequest = mQueues[REFRESH].front();
+                    mQueues[REFRESH].pop_front();
+                }
+                else if (!mQueues[REFRESH].empty()) {
+                    mCondition.wait_until(lock, mRateLimitReset);
+                }
+                else {
+                    mCondition.wait(lock);
+                }
+            }
+
+            // Later reads may have missed changes since now, so do not merge them
+            auto it = mQueuedReads.find(spRequest->key);
+            if (it != mQueuedReads.end() && it->second == spRequest) {
+                mQueuedReads.erase(it);
+            }
+        }
+
+        // Send request and parse response without lock
+        rapidjson::Document result = spRequest->call(this);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        spRequest->result = std::move(result);
+        mFinished.push_back(spRequest);
+    }
+}
+
 // STATUS ----------------------------------------------------------------------------------------------------------
 
 /**
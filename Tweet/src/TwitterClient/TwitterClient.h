@@ -7,6 +7,16 @@
 #include <cstdio>
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 class Twitter {
 
@@ -14,8 +24,19 @@ public:
 
     twitCurl* mpAccount;
     Twitter(twitCurl* pAccount, std::string name, std::string passwort, bool swap);
+    ~Twitter();
     rapidjson::Document toJSON(std::string); // This way?
 
+    // ASYNCHRONOUS
+    // Requests are executed one after another by a worker thread, as twitCurl keeps the state of its last call.
+    // Do not call the blocking methods below directly while requests are pending.
+    enum Priority { USER_ACTION, REFRESH };
+    typedef std::function<rapidjson::Document(Twitter*)> Call;
+    typedef std::function<void(rapidjson::Document&)> Callback;
+    void request(Priority priority, std::string key, Call call, Callback callback);
+    void pollRequests();
+    void stopRequests();
+
     // STATUS
     rapidjson::Document statusUpdate(std::string text);
     rapidjson::Document reply(std::string text, std::string id);
@@ -74,4 +95,24 @@ public:
     // ACCOUNT
     rapidjson::Document getAccountLimit();
     bool isLimit();
+
+private:
+
+    struct Request {
+        std::string key; // empty for requests which change something
+        Call call;
+        std::vector<Callback> callbacks;
+        rapidjson::Document result;
+    };
+
+    void work();
+
+    std::deque<std::shared_ptr<Request> > mQueues[2]; // by priority
+    std::map<std::string, std::shared_ptr<Request> > mQueuedReads; // by key, merged with equal reads until started
+    std::vector<std::shared_ptr<Request> > mFinished;
+    std::thread mWorker; // started with first request
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStop = false;
+    std::chrono::steady_clock::time_point mRateLimitReset; // refreshing waits until then
 };
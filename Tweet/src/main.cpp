@@ -94,6 +94,9 @@ int main(int argc, char* argv[]) {
         }
     #endif
 
+    // libcurl, before any thread uses it
+    curl_global_init(CURL_GLOBAL_ALL);
+
     // GLFW
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -224,6 +227,14 @@ int main(int argc, char* argv[]) {
 		input.gazeX = (int)((float)input.gazeX * (1280.f / (float)resX));
 		input.gazeY = (int)((float)input.gazeY * (800.f / (float)resY));
 
+        // Show images downloaded meanwhile
+        poll_image_downloads();
+
+        // Show results of Twitter requests finished meanwhile
+        if (TwitterApp::getInstance()->getTwitter() != NULL) {
+            TwitterApp::getInstance()->getTwitter()->pollRequests();
+        }
+
         // Render GUI into framebuffer
 		framebuffer.Bind();
         eyegui::Input usedInput = eyegui::updateGUI(login->application->getGUI(), deltaTime, input);
@@ -244,8 +255,11 @@ int main(int argc, char* argv[]) {
 
     input_disconnect();
 
-    // Delete tmp image folder
-    remove_folder(CONTENT_PATH + std::string("/img/tmp"));
+    // Stop image downloads before their callbacks' layouts are deleted
+    stop_image_downloads();
+    if (TwitterApp::getInstance()->getTwitter() != NULL) {
+        TwitterApp::getInstance()->getTwitter()->stopRequests();
+    }
 
     //Destructor
     delete login;
@@ -255,6 +269,7 @@ int main(int argc, char* argv[]) {
 	glDeleteVertexArrays(1, &screenfillingVAO);
 
     // Termination of program
+    curl_global_cleanup();
     glfwTerminate();
     return 0;
 }